@@ -36,6 +36,15 @@ if( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_CALL_LOGGING)
     message(FATAL_ERROR " Shiny Call Logging activated but not Shiny. Use cmake -DPROFILER=Shiny ..")
 endif( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_CALL_LOGGING)
 
+# the timeline trace works with PROFILER=None and PROFILER=Shiny
+if(PROFILE_TIMELINE)
+	if(NOT "${PROFILER}" STREQUAL "None" AND NOT "${PROFILER}" STREQUAL "Shiny")
+		message(FATAL_ERROR " PROFILE_TIMELINE can only be used with PROFILER=None or PROFILER=Shiny.")
+	endif()
+	add_definitions(-DUG_PROFILE_TIMELINE)
+	message(" -- Info: Timeline trace activated.")
+endif(PROFILE_TIMELINE)
+
 
 if(NOT "${PROFILER}" STREQUAL "None")
     if("${PROFILER}" STREQUAL "Shiny")
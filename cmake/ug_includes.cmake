@@ -167,6 +167,7 @@ option(DEBUG_LOGS "Enables debug output. Valid options are: ON, OFF" OFF)
 option(PARALLEL "Enables parallel compilation. Valid options are: ON, OFF" ${MPI_FOUND})
 option(PROFILE_PCL "Enables profiling of the pcl-library. Valid options are ON, OFF" OFF)
 option(SHINY_CALL_LOGGING "Enables Call Logging for Shiny. Valid options are ON, OFF" OFF)
+option(PROFILE_TIMELINE "Records a per thread timeline of profiled regions (Chrome trace export). Valid options are ON, OFF" OFF)
 option(PROFILE_BRIDGE "Enables profiling of bridge objects. Valid options are ON, OFF" OFF)
 option(PCL_DEBUG_BARRIER "Enables debug barriers in the pcl-library. Valid options are ON, OFF" OFF)
 option(LAPACK "Lapack won't be used, even if available. Valid options are ON, OFF" ${lapackDefault})
@@ -263,6 +264,7 @@ message(STATUS "Info: PROFILER:          ${PROFILER} (options are: ${profilerOpt
 message(STATUS "Info: PROFILE_PCL:       ${PROFILE_PCL} (options are: ON, OFF)")
 message(STATUS "Info: CPU_FREQ:          ${CPU_FREQ} (options are: ON, OFF)")
 message(STATUS "Info: PROFILE_BRIDGE:    ${PROFILE_BRIDGE} (options are: ON, OFF)")
+message(STATUS "Info: PROFILE_TIMELINE:  ${PROFILE_TIMELINE} (options are: ON, OFF)")
 message(STATUS "Info: LAPACK:            ${LAPACK} (options are: ON, OFF)")
 message(STATUS "Info: BLAS:              ${BLAS} (options are: ON, OFF)")
 message(STATUS "Info: INTERNAL_BOOST:    ${INTERNAL_BOOST} (options are: ON, OFF)")
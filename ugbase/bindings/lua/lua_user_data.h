@@ -88,6 +88,9 @@ class LuaUserData
 	///	friend class
 		friend class LuaUserDataFactory<TData, dim, TRet>;
 
+	///	base class type
+		typedef StdGlobPosData<LuaUserData<TData, dim, TRet>, TData, dim, TRet> base_type;
+
 	public:
 	///	Constructor
 	/**
@@ -126,7 +129,54 @@ class LuaUserData
 	///	evaluates the data at a given point and time
 		inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const;
 
+	///	sets a callback evaluating the data at a whole array of points
+	/**
+	 * The batch callback is called with one table per coordinate holding the
+	 * coordinates of all points, the time and the subset index. It must return
+	 * one table per component of the data, holding the values at all points,
+	 * e.g. for a number in 2d:
+	 * \code{.lua}
+	 * function SourceBatch(X, Y, t, si)
+	 * 	local V = {}
+	 * 	for i = 1, #X do V[i] = math.sin(X[i])*Y[i] end
+	 * 	return V
+	 * end
+	 * \endcode
+	 * The batch callback is used whenever the data is requested for an array
+	 * of global positions (e.g. by Interpolate), such that only one lua call
+	 * is needed per array instead of one per point. The return flag of
+	 * conditional data is not part of the batch signature. Single points are
+	 * still evaluated by the callback passed to the constructor.
+	 */
+	///{
+		void set_batch_callback(const char* luaCallback);
+		void set_batch_callback(LuaFunctionHandle handle);
+	///}
+
+	///	returns if a batch callback is set
+		bool has_batch_callback() const {return m_batchCallbackRef != LUA_NOREF;}
+
+	///	returns string of required batch callback signature
+		static std::string batch_signature();
+
+	///	returns values for global positions
+		virtual void operator()(TData vValue[],
+		                        const MathVector<dim> vGlobIP[],
+		                        number time, int si, const size_t nip) const;
+
+		using base_type::operator();
+
+	///	lua callbacks must not be called concurrently
+		virtual bool thread_safe() const {return false;}
+
 	protected:
+	///	evaluates the data at an array of points using the batch callback
+		void evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+		                    number time, int si, const size_t nip) const;
+
+	///	frees the reference to the batch callback
+		void free_batch_callback_ref();
+
 	///	sets that LuaUserData is created by LuaUserDataFactory
 		void set_created_from_factory(bool bFromFactory) {m_bFromFactory = bFromFactory;}
 
@@ -136,6 +186,9 @@ class LuaUserData
 
 	///	reference to lua function
 		int m_callbackRef;
+
+	///	reference to lua batch function (LUA_NOREF if not set)
+		int m_batchCallbackRef;
 		
 		#ifdef USE_LUA2C
     	/// LUACompiler type for compiled LUA code
@@ -272,6 +325,9 @@ class LuaUserFunction
 	///	evaluates the data
 		virtual void operator() (TData& out, int numArgs, ...) const;
 
+	///	lua callbacks must not be called concurrently
+		virtual bool thread_safe() const {return false;}
+
 		inline void evaluate (TData& value,
 		                      const MathVector<dim>& globIP,
 		                      number time, int si) const;
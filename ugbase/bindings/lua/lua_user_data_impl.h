@@ -77,6 +77,24 @@ std::string LuaUserData<TData,dim,TRet>::signature()
 	return ss.str();
 }
 
+template <typename TData, int dim, typename TRet>
+std::string LuaUserData<TData,dim,TRet>::batch_signature()
+{
+	std::stringstream ss;
+	ss << "function name(";
+	if(dim >= 1) ss << "X";
+	if(dim >= 2) ss << ", Y";
+	if(dim >= 3) ss << ", Z";
+	ss << ", t, si)\n   ... \n   return ";
+	const int size = lua_traits<TData>::size;
+	for(int i = 0; i < size; ++i){
+		if(i != 0) ss << ", ";
+		ss << "V";
+		if(size > 1) ss << i+1;
+	}
+	ss << "\nend\n(all arguments and returns except t, si are tables of length #X)";
+	return ss.str();
+}
 
 template <typename TData, int dim, typename TRet>
 std::string LuaUserData<TData,dim,TRet>::name()
@@ -90,7 +108,7 @@ std::string LuaUserData<TData,dim,TRet>::name()
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
-	: m_callbackName(luaCallback), m_bFromFactory(false)
+	: m_callbackName(luaCallback), m_batchCallbackRef(LUA_NOREF), m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -117,7 +135,8 @@ LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(LuaFunctionHandle handle)
-	: m_callbackName("__anonymous__lua__function__"), m_bFromFactory(false)
+	: m_callbackName("__anonymous__lua__function__"), m_batchCallbackRef(LUA_NOREF),
+	  m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -349,11 +368,125 @@ evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
 	}
 }
 
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::set_batch_callback(const char* luaCallback)
+{
+//	obtain a reference
+	lua_getglobal(m_L, luaCallback);
+
+//	make sure that the reference is valid
+	if(lua_isnil(m_L, -1)){
+		lua_pop(m_L, 1);
+		UG_THROW(name() << ": Specified lua batch callback "
+						"does not exist: " << luaCallback);
+	}
+
+//	store reference to lua function
+	free_batch_callback_ref();
+	m_batchCallbackRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::set_batch_callback(LuaFunctionHandle handle)
+{
+	free_batch_callback_ref();
+	m_batchCallbackRef = handle.ref;
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::free_batch_callback_ref()
+{
+	if(m_batchCallbackRef != LUA_NOREF){
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+		m_batchCallbackRef = LUA_NOREF;
+	}
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+operator()(TData vValue[], const MathVector<dim> vGlobIP[],
+           number time, int si, const size_t nip) const
+{
+	if(m_batchCallbackRef != LUA_NOREF)
+		evaluate_batch(vValue, vGlobIP, time, si, nip);
+	else
+		base_type::operator()(vValue, vGlobIP, time, si, nip);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+               number time, int si, const size_t nip) const
+{
+	PROFILE_CALLBACK()
+	if(nip == 0) return;
+
+//	push the callback function on the stack
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+
+//  push one table per coordinate on stack
+	for(int d = 0; d < dim; ++d){
+		lua_createtable(m_L, (int)nip, 0);
+		for(size_t ip = 0; ip < nip; ++ip){
+			lua_pushnumber(m_L, vGlobIP[ip][d]);
+			lua_rawseti(m_L, -2, (int)ip + 1);
+		}
+	}
+
+//	push time and subset index on stack
+	lua_traits<number>::push(m_L, time);
+	lua_traits<int>::push(m_L, si);
+
+//	one table per component of the data is returned
+	const int retSize = lua_traits<TData>::size;
+
+//	call lua function
+	if(lua_pcall(m_L, dim + 2, retSize, 0) != 0){
+		std::string msg = lua_tostring(m_L, -1);
+		lua_pop(m_L, 1);
+		UG_THROW(name() << "::operator(...): Error while "
+						"running batch callback, lua message: "<< msg <<".\n"
+						"Use signature as follows:\n"
+						<< batch_signature());
+	}
+
+//	check the returned tables
+	const int first = lua_gettop(m_L) - retSize + 1;
+	for(int c = 0; c < retSize; ++c){
+		if(!lua_istable(m_L, first + c) || lua_objlen(m_L, first + c) < nip){
+			lua_pop(m_L, retSize);
+			UG_THROW(name() << "::operator(...): Batch callback must return "
+							<< retSize << " table(s) of length " << nip << ".\n"
+							"Use signature as follows:\n"
+							<< batch_signature());
+		}
+	}
+
+//	read values
+	for(size_t ip = 0; ip < nip; ++ip){
+		for(int c = 0; c < retSize; ++c)
+			lua_rawgeti(m_L, first + c, (int)ip + 1);
+
+		if(!lua_traits<TData>::check(m_L)){
+			lua_pop(m_L, 2*retSize);
+			UG_THROW(name() << "::operator(...): Batch callback returned a "
+							"non-number value at position " << ip+1 << ".");
+		}
+
+		lua_traits<TData>::read(m_L, vValue[ip]);
+		lua_pop(m_L, retSize);
+	}
+
+//	pop tables
+	lua_pop(m_L, retSize);
+}
+
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::~LuaUserData()
 {
 //	free reference to callback
 	luaL_unref(m_L, LUA_REGISTRYINDEX, m_callbackRef);
+	free_batch_callback_ref();
 
 	if(m_bFromFactory)
 		LuaUserDataFactory<TData,dim,TRet>::remove(m_callbackName);
@@ -301,6 +301,9 @@ class VRLUserLinker
 
 		VRLUserLinker() : initialized(false) {}
 
+	///	java callbacks must not be called concurrently
+		virtual bool thread_safe() const {return false;}
+
 		static std::string name()
 		{
 			std::stringstream ss;
@@ -667,6 +670,9 @@ class VRLUserData
 
 		VRLUserData() : initialized(false) {}
 
+	///	java callbacks must not be called concurrently
+		virtual bool thread_safe() const {return false;}
+
 		static std::string params()
 		{
 			// DO NOT USE underscore for param names (i.e. NO "_x" !!!)
@@ -917,6 +923,9 @@ public:
 ///	returns if grid function is needed for evaluation
 	virtual bool requires_grid_fct() const {return false;}
 
+///	java callbacks must not be called concurrently
+	virtual bool thread_safe() const {return false;}
+
 	void releaseGlobalRefs()
 	{
 		// deleting thread-safe global references
@@ -169,6 +169,60 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "Jacobi", tag);
 	}
 
+//	Chebyshev
+	{
+		typedef Chebyshev<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("Chebyshev").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Chebyshev polynomial smoother (Jacobi-preconditioned)")
+			.add_constructor()
+			.template add_constructor<void (*)(size_t)>("Degree")
+			.add_method("set_degree", &T::set_degree, "", "degree",
+					"sets the degree of the polynomial, i.e. the number of matrix-vector products per step (default 3)")
+			.add_method("set_eigenvalue_ratio", &T::set_eigenvalue_ratio, "", "ratio",
+					"smoothed interval is [lambda_max/ratio, lambda_max] (default 30)")
+			.add_method("set_safety_factor", &T::set_safety_factor, "", "safety",
+					"factor the estimated lambda_max is enlarged by (default 1.1)")
+			.add_method("set_num_lanczos_iterations", &T::set_num_lanczos_iterations, "", "n",
+					"number of Lanczos iterations to estimate lambda_max (default 10)")
+			.add_method("set_spectral_bounds", &T::set_spectral_bounds, "", "lambdaMin#lambdaMax",
+					"sets the bounds of the spectrum of D^{-1}A explicitly, disables the estimation")
+			.add_method("lambda_min", &T::lambda_min, "lambda_min")
+			.add_method("lambda_max", &T::lambda_max, "lambda_max")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Chebyshev", tag);
+	}
+
+//	AggregationAMG
+	{
+		typedef AggregationAMG<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("AggregationAMG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Smoothed aggregation algebraic multigrid")
+			.add_constructor()
+			.add_method("set_smoother", &T::set_smoother, "", "smoother",
+					"sets the smoother for all levels (default Jacobi(0.66))")
+			.add_method("set_base_solver", &T::set_base_solver, "", "baseSolver",
+					"sets the solver on the coarsest level (default AgglomeratingSolver(LU))")
+			.add_method("set_max_levels", &T::set_max_levels, "", "maxLevels")
+			.add_method("set_min_base_size", &T::set_min_base_size, "", "minBaseSize",
+					"coarsening stops if the global number of DoFs is at most minBaseSize")
+			.add_method("set_strength_threshold", &T::set_strength_threshold, "", "eps",
+					"threshold for strong connections (default 0.08)")
+			.add_method("set_prolongation_damping", &T::set_prolongation_damping, "", "omega",
+					"damping of the prolongation smoothing, 0 = plain aggregation (default 2/3)")
+			.add_method("set_num_presmooth", &T::set_num_presmooth, "", "nu1")
+			.add_method("set_num_postsmooth", &T::set_num_postsmooth, "", "nu2")
+			.add_method("set_cycle_type", &T::set_cycle_type, "", "gamma", "1 = V-cycle, 2 = W-cycle")
+			.add_method("set_reuse_setup", &T::set_reuse_setup, "", "bReuse",
+					"reuse the aggregates if the matrix pattern did not change")
+			.add_method("num_levels", &T::num_levels, "numLevels")
+			.add_method("level_size", &T::level_size, "size", "level")
+			.add_method("print_hierarchy", &T::print_hierarchy)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "AggregationAMG", tag);
+	}
+
 //	GaussSeidelBase
 	{
 		typedef GaussSeidelBase<TAlgebra> T;
@@ -176,7 +230,9 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("GaussSeidelBase").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "Gauss-Seidel Base")
 			.add_method("set_sor_relax", &T::set_sor_relax,
-					"", "sor relaxation", "sets sor relaxation parameter");
+					"", "sor relaxation", "sets sor relaxation parameter")
+			.add_method("set_single_precision", &T::set_single_precision,
+					"", "bSingle", "if bSingle=true, the matrix is stored in single precision for the sweeps. default false");
 		reg.add_class_to_group(name, "GaussSeidelBase", tag);
 	}
 
@@ -205,7 +261,7 @@ static void Algebra(Registry& reg, string grp)
 //	Backward GaussSeidel
 	{
 		typedef BackwardGaussSeidel<TAlgebra> T;
-		typedef IPreconditioner<TAlgebra> TBase;
+		typedef GaussSeidelBase<TAlgebra> TBase;
 		string name = string("BackwardGaussSeidel").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "Backward Gauss Seidel Preconditioner")
 				.add_constructor()
@@ -243,6 +299,8 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default false")
 			.add_method("set_disable_preprocessing", &T::set_disable_preprocessing, "", "disable",
 						"set whether preprocessing (notably, LU factorization) is to be disabled - usable when the operator has not changed; use with care")
+			.add_method("set_single_precision", &T::set_single_precision, "", "bSingle",
+						"if bSingle=true, the factorization is stored in single precision. default false")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILU", tag);
 	}
@@ -260,6 +318,8 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_info", &T::set_info,
 						"", "info", "sets storage information output")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default true")
+			.add_method("set_single_precision", &T::set_single_precision, "", "bSingle",
+						"if bSingle=true, the factors L and U are stored in single precision. default false")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILUT", tag);
 	}
@@ -345,6 +405,10 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("AgglomeratingIterator").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "AgglomeratingIterator")
 			.template add_constructor<void (*)(SmartPtr<ILinearIterator<vector_type> > )>("pLinIterator")
+			.add_method("set_agglomeration_group_size", &T::set_agglomeration_group_size, "", "groupSize",
+					"number of processes agglomerated onto one per stage (0 = all at once)")
+			.add_method("set_num_coarse_procs", &T::set_num_coarse_procs, "", "numProcs",
+					"number of processes solving the agglomerated problem")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AgglomeratingIterator", tag);
 	}
@@ -356,6 +420,10 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("AgglomeratingPreconditioner").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "AgglomeratingPreconditioner")
 			.template add_constructor<void (*)(SmartPtr<ILinearIterator<vector_type> > )>("pPreconditioner")
+			.add_method("set_agglomeration_group_size", &T::set_agglomeration_group_size, "", "groupSize",
+					"number of processes agglomerated onto one per stage (0 = all at once)")
+			.add_method("set_num_coarse_procs", &T::set_num_coarse_procs, "", "numProcs",
+					"number of processes solving the agglomerated problem")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AgglomeratingPreconditioner", tag);
 	}
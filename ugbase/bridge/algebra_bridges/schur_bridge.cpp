@@ -131,6 +131,10 @@ typedef typename TAlgebra::vector_type vector_type;
 		string name = string("SchurInverseWithFullMatrix").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "SchurInverseWithFullMatrix")
 			.ADD_CONSTRUCTOR( (SmartPtr<ILinearOperatorInverse<vector_type> > ) )("linOpInverse")
+			.add_method("set_probing_distance", &T::set_probing_distance, "", "distance",
+					"computes the Schur complement by probing with colored unit vectors (0 = exact)")
+			.add_method("set_threshold", &T::set_threshold, "", "threshold",
+					"drops entries below threshold times the column diagonal")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "SchurInverseWithFullMatrix", tag);
 	}
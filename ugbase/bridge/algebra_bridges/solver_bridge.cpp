@@ -250,6 +250,10 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("AgglomeratingSolver").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "AgglomeratingSolver")
 			.ADD_CONSTRUCTOR( (SmartPtr<ILinearOperatorInverse<vector_type, vector_type> > ) )("pLinOp")
+			.add_method("set_agglomeration_group_size", &T::set_agglomeration_group_size, "", "groupSize",
+					"number of processes agglomerated onto one per stage (0 = all at once)")
+			.add_method("set_num_coarse_procs", &T::set_num_coarse_procs, "", "numProcs",
+					"number of processes solving the agglomerated problem")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AgglomeratingSolver", tag);
 	}
@@ -295,6 +299,12 @@ static void Algebra(Registry& reg, string grp)
 		.add_method("set_debug", &T::set_debug)
 		.add_method("test_layouts", &T::test_layouts)
 		.add_method("set_test_one_to_many_layouts", &T::set_test_one_to_many_layouts)
+		.add_method("set_reuse_local_factorizations", &T::set_reuse_local_factorizations, "",
+					"bReuse", "keep local factorizations if the matrix is unchanged")
+		.add_method("set_primal_batch_size", &T::set_primal_batch_size, "",
+					"batchSize", "number of right hand sides solved at once when assembling S_PiPi")
+		.add_method("print_phase_timings", &T::print_phase_timings)
+		.add_method("clear_phase_timings", &T::clear_phase_timings)
 		.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "FETI", tag);
 	}
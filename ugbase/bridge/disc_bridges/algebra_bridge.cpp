@@ -52,6 +52,7 @@
 #include "lib_disc/time_disc/time_disc_interface.h"
 #include "lib_disc/time_disc/theta_time_step.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
 #include "lib_disc/operator/non_linear_operator/newton_solver/newton.h"
@@ -243,9 +244,30 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("set_dirichlet_values", &T::set_dirichlet_values)
 			.add_method("init_op_and_rhs", &T::init_op_and_rhs)
 			.add_method("level", &T::level)
+			.add_method("set_complete_interface_rows", &T::set_complete_interface_rows, "",
+					"bComplete", "completes interface rows once after assembling for the smoothers")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "AssembledLinearOperator", tag);
 	}
+
+//	MatrixFreeOperator
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeOperator<TAlgebra> T;
+		typedef MatrixOperator<matrix_type, vector_type> TBase;
+		string name = string("MatrixFreeOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp, "Jacobian applied element-wise, only diagonal assembled")
+			.add_constructor()
+			.template add_constructor<void (*)(SmartPtr<IDomainDiscretization<TAlgebra> >)>("DomainDiscretization")
+			.template add_constructor<void (*)(SmartPtr<IDomainDiscretization<TAlgebra> >, const GridLevel&)>("DomainDiscretization#GridLevel")
+			.add_method("set_discretization", &T::set_discretization)
+			.add_method("set_level", &T::set_level)
+			.add_method("set_dirichlet_values", &T::set_dirichlet_values)
+			.add_method("init_op_and_rhs", &T::init_op_and_rhs)
+			.add_method("level", &T::level)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeOperator", tag);
+	}
 	
 //	NewtonSolver
 	{
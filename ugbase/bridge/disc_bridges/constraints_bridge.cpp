@@ -105,6 +105,8 @@ static void DomainAlgebra(Registry& reg, string grp)
 		string name = string("OneSideP1Constraints").append(suffix);
 		reg.add_class_<T, baseT>(name, grp)
 			.add_constructor()
+			.add_method("set_use_interpolation", &T::set_use_interpolation, "", "use cached interpolation matrix")
+			.add_method("invalidate_interpolation", &T::invalidate_interpolation)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "OneSideP1Constraints", tag);
 	}
@@ -116,6 +118,8 @@ static void DomainAlgebra(Registry& reg, string grp)
 		string name = string("SymP1Constraints").append(suffix);
 		reg.add_class_<T, baseT>(name, grp)
 			.add_constructor()
+			.add_method("set_use_interpolation", &T::set_use_interpolation, "", "use cached interpolation matrix")
+			.add_method("invalidate_interpolation", &T::invalidate_interpolation)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "SymP1Constraints", tag);
 	}
@@ -157,6 +161,7 @@ static void DomainAlgebra(Registry& reg, string grp)
 						"", "LuaCallback#Function#Subsets")
 #endif
 			.add_method("clear", &T::clear)
+			.add_method("invalidate_dof_cache", &T::invalidate_dof_cache)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "DirichletBoundary", tag);
 	}
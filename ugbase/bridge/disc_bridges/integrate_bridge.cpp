@@ -44,6 +44,7 @@
 #include "lib_disc/function_spaces/grid_function.h"
 #include "lib_disc/function_spaces/integrate.h"
 #include "lib_disc/function_spaces/integrate_flux.h"
+#include "lib_disc/function_spaces/integrate_test.h"
 
 #include "lib_disc/quadrature/quad_test.h"
 
@@ -110,6 +111,20 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_function("Integral",static_cast<number (*)(SmartPtr<TFct>, const char*)>(Integral<TFct>),grp, "Integral", "GridFunction#Component");
 	}
 
+//	Integrals
+	{
+		typedef std::vector<SmartPtr<UserData<number,dim> > > TDataVec;
+		reg.add_function("Integrals", static_cast<std::vector<number> (*)(const TDataVec&, SmartPtr<TFct>, const char*, number, int, std::string)>(&Integrals<TFct>), grp, "Integrals", "Data#GridFunction#Subsets#Time#QuadOrder#QuadType", "integrates several data in one element pass with one global reduction");
+		reg.add_function("Integrals", static_cast<std::vector<number> (*)(const TDataVec&, SmartPtr<TFct>, const char*, number, int)>(&Integrals<TFct>), grp, "Integrals", "Data#GridFunction#Subsets#Time#QuadOrder");
+		reg.add_function("Integrals", static_cast<std::vector<number> (*)(const TDataVec&, SmartPtr<TFct>, const char*, number)>(&Integrals<TFct>), grp, "Integrals", "Data#GridFunction#Subsets#Time");
+		reg.add_function("Integrals", static_cast<std::vector<number> (*)(const TDataVec&, SmartPtr<TFct>, const char*)>(&Integrals<TFct>), grp, "Integrals", "Data#GridFunction#Subsets");
+		reg.add_function("Integrals", static_cast<std::vector<number> (*)(const TDataVec&, SmartPtr<TFct>)>(&Integrals<TFct>), grp, "Integrals", "Data#GridFunction");
+
+		reg.add_function("Integrals",static_cast<std::vector<number> (*)(SmartPtr<TFct>, const char*, const char*, int)>(Integrals<TFct>),grp, "Integrals", "GridFunction#Components#Subsets#QuadOrder", "integrates several components in one element pass with one global reduction");
+		reg.add_function("Integrals",static_cast<std::vector<number> (*)(SmartPtr<TFct>, const char*, const char*)>(Integrals<TFct>),grp, "Integrals", "GridFunction#Components#Subsets");
+		reg.add_function("Integrals",static_cast<std::vector<number> (*)(SmartPtr<TFct>, const char*)>(Integrals<TFct>),grp, "Integrals", "GridFunction#Components");
+	}
+
 //	L2Error
 	{
 		reg.add_function("L2Error",static_cast<number (*)(SmartPtr<TFct>, const char*, SmartPtr<TFct>, const char*, int, const char*)>(&L2Error<TFct>), grp);
@@ -140,6 +155,19 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_function("L2Norm",static_cast<number (*)(SmartPtr<TFct>, const char*, int)>(&L2Norm<TFct>),grp);
 	}
 
+//	L2Norms
+	{
+		reg.add_function("L2Norms",static_cast<std::vector<number> (*)(SmartPtr<TFct>, const char*, int, const char*)>(&L2Norms<TFct>),grp, "L2Norms", "GridFunction#Components#QuadOrder#Subsets", "l2-norms of several components in one element pass with one global reduction");
+		reg.add_function("L2Norms",static_cast<std::vector<number> (*)(SmartPtr<TFct>, const char*, int)>(&L2Norms<TFct>),grp, "L2Norms", "GridFunction#Components#QuadOrder");
+	}
+
+//	consistency checks for Integrals and L2Norms
+	{
+		typedef std::vector<SmartPtr<UserData<number,dim> > > TDataVec;
+		reg.add_function("TestIntegrals", static_cast<void (*)(const TDataVec&, SmartPtr<TFct>, const char*, number, int)>(&TestIntegrals<TFct>), grp, "", "Data#GridFunction#Subsets#Time#QuadOrder");
+		reg.add_function("TestL2Norms", &TestL2Norms<TFct>, grp, "", "GridFunction#Components#QuadOrder");
+	}
+
 //	IntegrateNormalGradientOnManifold
 	{
 		reg.add_function("IntegrateNormalGradientOnManifold",static_cast<number (*)(TFct&, const char*, const char*, const char*)>(&IntegrateNormalGradientOnManifold<TFct>),grp, "Integral", "GridFunction#Component#BoundarySubset#InnerSubset");
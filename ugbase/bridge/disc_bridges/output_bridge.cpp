@@ -46,6 +46,7 @@
 #include "lib_disc/function_spaces/approximation_space.h"
 
 #include "lib_disc/io/vtkoutput.h"
+#include "lib_disc/io/checkpoint.h"
 #include "common/profiler/profiler.h"
 
 #include "../util_overloaded.h"
@@ -226,6 +227,22 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_function("SaveVectorCSV",
 						 &SaveVectorCSV<function_type>, grp, "", "b#filename|save-dialog");
 	}
+
+//	Checkpoint
+	{
+		typedef Checkpoint<TDomain, TAlgebra> T;
+		string name = string("Checkpoint").append(suffix);
+		reg.add_class_<T>(name, grp, "Checkpoint of domain and grid functions for restarts")
+			.add_constructor()
+			.add_method("add", &T::add, "", "gridFunction", "adds a grid function")
+			.add_method("clear", &T::clear, "", "", "removes all grid functions")
+			.add_method("num_functions", &T::num_functions, "number of grid functions")
+			.add_method("write", &T::write, "", "filename|save-dialog", "writes domain and grid functions")
+			.add_method("read_domain", &T::read_domain, "", "domain#filename|load-dialog", "reads the domain")
+			.add_method("read_functions", &T::read_functions, "", "", "restores the added grid functions")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Checkpoint", tag);
+	}
 }
 
 /**
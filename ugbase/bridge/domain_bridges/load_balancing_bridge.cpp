@@ -44,6 +44,7 @@
 
 #ifdef UG_PARALLEL
 	#include "lib_disc/parallelization/domain_load_balancer.h"
+	#include "lib_grid/parallelization/distribution.h"
 	#include "lib_grid/parallelization/load_balancer.h"
 	#include "lib_grid/parallelization/load_balancer_util.h"
 	#include "lib_grid/parallelization/partitioner_dynamic_bisection.h"
@@ -261,6 +262,16 @@ static void Common(Registry& reg, string grp) {
 				.add_method("problems_occurred", &T::problems_occurred);
 	}
 
+//	settings and statistics of grid distribution
+	reg.add_function("SetGridDistributionChunkSize", &SetGridDistributionChunkSize, grp,
+					 "", "numBytes", "maximal size of a single message during grid distribution");
+	reg.add_function("SetGridDistributionMaxPendingBytes", &SetGridDistributionMaxPendingBytes, grp,
+					 "", "numBytes", "bounds the serialized data buffered for sending during grid distribution (0: no bound)");
+	reg.add_function("EnableGridDistributionCompression", &EnableGridDistributionCompression, grp,
+					 "", "enable", "compresses serialized grid data during grid distribution");
+	reg.add_function("PrintGridDistributionStatistics", &PrintGridDistributionStatistics, grp,
+					 "", "", "prints data volume and timings of the last grid distribution");
+
 	#ifdef UG_DIM_1
 	{
 		typedef ug::Domain<1>	TDomain;
@@ -34,6 +34,8 @@
 #include "bridge/bridge.h"
 #include "common/profiler/profiler.h"
 #include "common/profiler/profile_node.h"
+#include "common/profiler/timeline_trace.h"
+#include "common/profiler/solver_telemetry.h"
 #include "ug.h" // Required for UGOutputProfileStatsOnExit.
 #include <string>
 #include <sstream>
@@ -178,6 +180,35 @@ void RegisterBridge_Profiler(Registry &reg, string parentGroup)
 					 grp,
 	                 "", "filename|save-dialog|endings=[\"txt\"]", "writes txt file with call log");
 
+	reg.add_function("WriteTimelineTrace", &WriteTimelineTrace, grp,
+	                 "", "filename|save-dialog|endings=[\"json\"]", "writes the timeline of all threads and processes in Chrome trace format (needs cmake -DPROFILE_TIMELINE=ON)");
+	reg.add_function("SetTimelineTraceEnabled", &SetTimelineTraceEnabled, grp, "", "bEnable");
+	reg.add_function("SetTimelineTraceMinDuration", &SetTimelineTraceMinDuration, grp,
+	                 "", "minDuration", "only regions lasting at least minDuration seconds are recorded");
+	reg.add_function("SetTimelineTraceBufferSize", &SetTimelineTraceBufferSize, grp,
+	                 "", "numEvents", "number of events kept per thread");
+	reg.add_function("ClearTimelineTrace", &ClearTimelineTrace, grp);
+
+	reg.add_function("EnableSolverTelemetry", &EnableSolverTelemetry, grp,
+	                 "", "bEnable", "records per iteration timings of the solver phases (disabled by default)");
+	reg.add_function("ClearSolverTelemetry", &ClearSolverTelemetry, grp);
+	reg.add_function("WriteSolverTelemetryJSON", &WriteSolverTelemetryJSON, grp,
+	                 "", "filename|save-dialog|endings=[\"json\"]#bAggregate",
+	                 "writes the recorded solves per process or, if bAggregate, summarized over all processes");
+	reg.add_function("WriteSolverTelemetryCSV", &WriteSolverTelemetryCSV, grp,
+	                 "", "filename|save-dialog|endings=[\"csv\"]#bAggregate",
+	                 "writes the recorded solves per process or, if bAggregate, summarized over all processes");
+	reg.add_function("PrintSolverTelemetry", &PrintSolverTelemetry, grp);
+	reg.add_function("SolverTelemetryNumSolves", &SolverTelemetryNumSolves, grp, "numSolves");
+	reg.add_function("SolverTelemetrySolveName", &SolverTelemetrySolveName, grp, "name", "solve");
+	reg.add_function("SolverTelemetryNumIterations", &SolverTelemetryNumIterations, grp, "numIterations", "solve");
+	reg.add_function("SolverTelemetryConverged", &SolverTelemetryConverged, grp, "bConverged", "solve");
+	reg.add_function("SolverTelemetryDefect", &SolverTelemetryDefect, grp, "defect", "solve#iteration");
+	reg.add_function("SolverTelemetrySolveTime", &SolverTelemetrySolveTime, grp, "time", "solve");
+	reg.add_function("SolverTelemetryPhaseTime", &SolverTelemetryPhaseTime, grp, "time", "solve#phase");
+	reg.add_function("SolverTelemetryIterationPhaseTime", &SolverTelemetryIterationPhaseTime, grp,
+	                 "time", "solve#iteration#phase");
+
 	reg.add_function("UpdateProfiler", &UpdateProfiler_BridgeImpl, grp);
 
 	reg.add_function("SetShinyCallLoggingMaxFrequency", &SetShinyCallLoggingMaxFrequency, grp, "", "maxFreq");
@@ -0,0 +1,727 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include "solver_telemetry.h"
+#include "common/log.h"
+#include "common/error.h"
+#include "common/stopwatch.h"
+
+#ifdef UG_CXX11
+	#include <chrono>
+#endif
+
+#ifdef UG_OPENMP
+	#include <omp.h>
+#endif
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+
+bool SolverTelemetry::s_bEnabled = false;
+
+namespace{
+
+///	global state of the telemetry
+struct TelemetryData
+{
+	vector<string> vPhaseName;
+	map<string, int> mPhaseId;
+	map<pair<string, int>, int> mLevelPhaseId;
+	vector<char> vPhaseActive;
+
+	vector<SolverTelemetry::Solve> vSolve;
+	vector<size_t> vOpen;	///< stack of open solves
+	vector<SolverTelemetry::Phase> vPending;	///< time outside of any solve
+};
+
+TelemetryData& Data()
+{
+	static TelemetryData data;
+	return data;
+}
+
+void AddPhase(vector<SolverTelemetry::Phase>& vPhase, int id, double time, size_t count)
+{
+	if((size_t)id >= vPhase.size()) vPhase.resize(id+1);
+	vPhase[id].time += time;
+	vPhase[id].count += count;
+}
+
+void AddPhases(vector<SolverTelemetry::Phase>& vPhase,
+               const vector<SolverTelemetry::Phase>& vAdd)
+{
+	for(size_t i = 0; i < vAdd.size(); ++i)
+		if(vAdd[i].count > 0)
+			AddPhase(vPhase, (int)i, vAdd[i].time, vAdd[i].count);
+}
+
+///	closes stale solves until numKeep solves are left open
+void CloseOpen(size_t numKeep, double t)
+{
+	TelemetryData& d = Data();
+	while(d.vOpen.size() > numKeep){
+		SolverTelemetry::Solve& s = d.vSolve[d.vOpen.back()];
+		s.open = false;
+		s.converged = false;
+		s.tEnd = t;
+		s.vCurrent.clear();
+		d.vOpen.pop_back();
+	}
+}
+
+///	returns the position of the solve fed by owner in the open stack or -1
+int FindOpen(const void* owner)
+{
+	TelemetryData& d = Data();
+	for(int i = (int)d.vOpen.size() - 1; i >= 0; --i)
+		if(d.vSolve[d.vOpen[i]].owner == owner)
+			return i;
+	return -1;
+}
+
+int FindPhase(const char* phase)
+{
+	TelemetryData& d = Data();
+	map<string, int>::const_iterator it = d.mPhaseId.find(phase);
+	if(it == d.mPhaseId.end()) return -1;
+	return it->second;
+}
+
+const SolverTelemetry::Solve& GetSolve(size_t solve)
+{
+	const vector<SolverTelemetry::Solve>& vSolve = Data().vSolve;
+	UG_COND_THROW(solve >= vSolve.size(), "SolverTelemetry: solve " << solve
+	              << " requested, but only " << vSolve.size() << " recorded.");
+	return vSolve[solve];
+}
+
+double PhaseTime(const vector<SolverTelemetry::Phase>& vPhase, int id)
+{
+	if(id < 0 || (size_t)id >= vPhase.size()) return 0.0;
+	return vPhase[id].time;
+}
+
+string JSONString(const string& s)
+{
+	stringstream ss;
+	ss << '"';
+	for(size_t i = 0; i < s.size(); ++i){
+		switch(s[i]){
+			case '"': ss << "\\\""; break;
+			case '\\': ss << "\\\\"; break;
+			case '\n': ss << "\\n"; break;
+			case '\t': ss << "\\t"; break;
+			default: ss << s[i];
+		}
+	}
+	ss << '"';
+	return ss.str();
+}
+
+string CSVString(const string& s)
+{
+	if(s.find_first_of(",\"\n") == string::npos) return s;
+	string res = "\"";
+	for(size_t i = 0; i < s.size(); ++i){
+		if(s[i] == '"') res += '"';
+		res += s[i];
+	}
+	return res + "\"";
+}
+
+void WritePhasesJSON(ostream& out, const vector<SolverTelemetry::Phase>& vPhase)
+{
+	const vector<string>& vName = Data().vPhaseName;
+	out << "{";
+	bool first = true;
+	for(size_t i = 0; i < vPhase.size(); ++i){
+		if(vPhase[i].count == 0) continue;
+		if(!first) out << ", ";
+		first = false;
+		out << JSONString(vName[i]) << ": {\"time\": " << vPhase[i].time
+			<< ", \"count\": " << vPhase[i].count << "}";
+	}
+	out << "}";
+}
+
+///	returns the file name used by this process for per process output
+string ProcessFilename(const string& filename)
+{
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1){
+		stringstream ss;
+		size_t dot = filename.find_last_of('.');
+		size_t slash = filename.find_last_of('/');
+		if(dot == string::npos || (slash != string::npos && dot < slash))
+			dot = filename.size();
+		ss << filename.substr(0, dot) << "_p" << pcl::ProcRank()
+			<< filename.substr(dot);
+		return ss.str();
+	}
+#endif
+	return filename;
+}
+
+///	summary of all solves with the same name, aggregated over all processes
+struct AggregatedTelemetry
+{
+	vector<string> vSolverName;
+	vector<string> vPhaseName;
+	int numProcs;
+
+//	for each solver name: num solves, num iterations, time, then for each
+//	phase: time, count
+	size_t num_values() const {return 3 + 2*vPhaseName.size();}
+	vector<double> vMin, vMax, vSum;
+
+	double value(const vector<double>& v, size_t solver, size_t i) const
+		{return v[solver*num_values() + i];}
+};
+
+void MergeNames(vector<string>& vName)
+{
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1){
+		vector<char> send, recv;
+		for(size_t i = 0; i < vName.size(); ++i){
+			send.insert(send.end(), vName[i].begin(), vName[i].end());
+			send.push_back('\0');
+		}
+		pcl::ProcessCommunicator pc;
+		pc.allgatherv(recv, send);
+		size_t start = 0;
+		for(size_t i = 0; i < recv.size(); ++i){
+			if(recv[i] == '\0'){
+				vName.push_back(string(&recv[start], i - start));
+				start = i + 1;
+			}
+		}
+	}
+#endif
+	sort(vName.begin(), vName.end());
+	vName.erase(unique(vName.begin(), vName.end()), vName.end());
+}
+
+///	has to be called on all processes
+void Aggregate(AggregatedTelemetry& agg)
+{
+	TelemetryData& d = Data();
+	const vector<SolverTelemetry::Solve>& vSolve = d.vSolve;
+
+	agg.vSolverName.clear();
+	for(size_t s = 0; s < vSolve.size(); ++s)
+		agg.vSolverName.push_back(vSolve[s].name);
+	MergeNames(agg.vSolverName);
+
+	agg.vPhaseName.clear();
+	for(size_t i = 0; i < d.vPhaseName.size(); ++i)
+		agg.vPhaseName.push_back(d.vPhaseName[i]);
+	MergeNames(agg.vPhaseName);
+
+	map<string, size_t> mSolver, mPhase;
+	for(size_t i = 0; i < agg.vSolverName.size(); ++i) mSolver[agg.vSolverName[i]] = i;
+	for(size_t i = 0; i < agg.vPhaseName.size(); ++i) mPhase[agg.vPhaseName[i]] = i;
+
+	const size_t numValues = agg.num_values();
+	vector<double> vLocal(agg.vSolverName.size() * numValues, 0.0);
+	for(size_t s = 0; s < vSolve.size(); ++s){
+		const SolverTelemetry::Solve& solve = vSolve[s];
+		double* v = &vLocal[mSolver[solve.name] * numValues];
+		v[0] += 1;
+		v[1] += solve.vIteration.size() - 1;
+		v[2] += (solve.open ? SolverTelemetry::now() : solve.tEnd) - solve.tStart;
+		for(size_t i = 0; i < solve.vTotal.size(); ++i){
+			if(solve.vTotal[i].count == 0) continue;
+			const size_t p = mPhase[d.vPhaseName[i]];
+			v[3 + 2*p] += solve.vTotal[i].time;
+			v[4 + 2*p] += solve.vTotal[i].count;
+		}
+	}
+
+	agg.numProcs = 1;
+	agg.vMin = agg.vMax = agg.vSum = vLocal;
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1 && !vLocal.empty()){
+		pcl::ProcessCommunicator pc;
+		agg.numProcs = pcl::NumProcs();
+		pc.allreduce(vLocal, agg.vMin, PCL_RO_MIN);
+		pc.allreduce(vLocal, agg.vMax, PCL_RO_MAX);
+		pc.allreduce(vLocal, agg.vSum, PCL_RO_SUM);
+	}
+	else if(pcl::NumProcs() > 1)
+		agg.numProcs = pcl::NumProcs();
+#endif
+}
+
+bool IsOutputProc()
+{
+#ifdef UG_PARALLEL
+	return pcl::ProcRank() == 0;
+#else
+	return true;
+#endif
+}
+
+void WriteStatJSON(ostream& out, const AggregatedTelemetry& agg, size_t s, size_t i)
+{
+	out << "{\"min\": " << agg.value(agg.vMin, s, i)
+		<< ", \"max\": " << agg.value(agg.vMax, s, i)
+		<< ", \"avg\": " << agg.value(agg.vSum, s, i) / agg.numProcs << "}";
+}
+
+void WriteStatCSV(ostream& out, const AggregatedTelemetry& agg, size_t s, size_t i)
+{
+	out << agg.value(agg.vMin, s, i) << "," << agg.value(agg.vMax, s, i)
+		<< "," << agg.value(agg.vSum, s, i) / agg.numProcs << "\n";
+}
+
+}// end anonymous namespace
+
+
+void SolverTelemetry::enable(bool bEnable)
+{
+	s_bEnabled = bEnable;
+}
+
+void SolverTelemetry::clear()
+{
+	TelemetryData& d = Data();
+	d.vSolve.clear();
+	d.vOpen.clear();
+	d.vPending.clear();
+}
+
+int SolverTelemetry::phase_id(const std::string& name)
+{
+	TelemetryData& d = Data();
+	map<string, int>::iterator it = d.mPhaseId.find(name);
+	if(it != d.mPhaseId.end()) return it->second;
+
+	const int id = (int)d.vPhaseName.size();
+	d.vPhaseName.push_back(name);
+	d.vPhaseActive.push_back(0);
+	d.mPhaseId[name] = id;
+	return id;
+}
+
+int SolverTelemetry::level_phase_id(const char* name, int lev)
+{
+	TelemetryData& d = Data();
+	const pair<string, int> key(name, lev);
+	map<pair<string, int>, int>::iterator it = d.mLevelPhaseId.find(key);
+	if(it != d.mLevelPhaseId.end()) return it->second;
+
+	stringstream ss; ss << "mg_l" << lev << "_" << name;
+	const int id = phase_id(ss.str());
+	d.mLevelPhaseId[key] = id;
+	return id;
+}
+
+const std::string& SolverTelemetry::phase_name(int id)
+{
+	const vector<string>& vName = Data().vPhaseName;
+	UG_COND_THROW(id < 0 || (size_t)id >= vName.size(),
+	              "SolverTelemetry: invalid phase id " << id);
+	return vName[id];
+}
+
+size_t SolverTelemetry::num_phases()
+{
+	return Data().vPhaseName.size();
+}
+
+double SolverTelemetry::now()
+{
+#ifdef UG_CXX11
+	return std::chrono::duration<double>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+	return get_clock_s();
+#endif
+}
+
+bool SolverTelemetry::start_phase(int id)
+{
+#ifdef UG_OPENMP
+	if(omp_in_parallel()) return false;
+#endif
+	char& active = Data().vPhaseActive[id];
+	if(active) return false;
+	active = 1;
+	return true;
+}
+
+void SolverTelemetry::stop_phase(int id, double tStart)
+{
+	TelemetryData& d = Data();
+	d.vPhaseActive[id] = 0;
+	if(!s_bEnabled) return;
+
+	const double dt = now() - tStart;
+	if(d.vOpen.empty()){
+		AddPhase(d.vPending, id, dt, 1);
+		return;
+	}
+	Solve& s = d.vSolve[d.vOpen.back()];
+	AddPhase(s.vCurrent, id, dt, 1);
+	AddPhase(s.vTotal, id, dt, 1);
+}
+
+void SolverTelemetry::begin_solve(const void* owner, const std::string& name,
+                                  number defect)
+{
+	if(!s_bEnabled) return;
+	TelemetryData& d = Data();
+	const double t = now();
+
+//	a solve still open for this owner has been left by an exception
+	const int pos = FindOpen(owner);
+	if(pos >= 0) CloseOpen(pos, t);
+
+	Solve s;
+	s.name = name;
+	s.parent = d.vOpen.empty() ? -1 : (int)d.vOpen.back();
+	s.depth = (int)d.vOpen.size();
+	s.owner = owner;
+	s.open = true;
+	s.converged = false;
+	s.tStart = s.tEnd = s.tLast = t;
+
+	Iteration it;
+	it.defect = defect;
+	it.wallTime = 0.0;
+	it.vPhase.swap(d.vPending);
+	s.vTotal = it.vPhase;
+	s.vIteration.push_back(it);
+
+	d.vOpen.push_back(d.vSolve.size());
+	d.vSolve.push_back(s);
+}
+
+void SolverTelemetry::iteration(const void* owner, number defect)
+{
+	if(!s_bEnabled) return;
+	const int pos = FindOpen(owner);
+	if(pos < 0) return;
+
+	TelemetryData& d = Data();
+	const double t = now();
+	CloseOpen(pos + 1, t);
+
+	Solve& s = d.vSolve[d.vOpen[pos]];
+	s.vIteration.push_back(Iteration());
+	Iteration& it = s.vIteration.back();
+	it.defect = defect;
+	it.wallTime = t - s.tLast;
+	it.vPhase.swap(s.vCurrent);
+	s.tLast = t;
+}
+
+void SolverTelemetry::end_solve(const void* owner, bool converged)
+{
+	if(!s_bEnabled) return;
+	const int pos = FindOpen(owner);
+	if(pos < 0) return;
+
+	TelemetryData& d = Data();
+	const double t = now();
+	CloseOpen(pos + 1, t);
+
+	Solve& s = d.vSolve[d.vOpen[pos]];
+	s.open = false;
+	s.converged = converged;
+	s.tEnd = t;
+	s.vCurrent.clear();
+	d.vOpen.pop_back();
+}
+
+const std::vector<SolverTelemetry::Solve>& SolverTelemetry::solves()
+{
+	return Data().vSolve;
+}
+
+void SolverTelemetry::write_json(const std::string& filename, bool bAggregate)
+{
+	stringstream out;
+	out.precision(10);
+
+	if(bAggregate){
+		AggregatedTelemetry agg;
+		Aggregate(agg);
+		if(!IsOutputProc()) return;
+
+		out << "{\"num_procs\": " << agg.numProcs << ",\n \"solvers\": [";
+		for(size_t s = 0; s < agg.vSolverName.size(); ++s){
+			if(s > 0) out << ",";
+			out << "\n  {\"name\": " << JSONString(agg.vSolverName[s]);
+			out << ",\n   \"num_solves\": "; WriteStatJSON(out, agg, s, 0);
+			out << ",\n   \"num_iterations\": "; WriteStatJSON(out, agg, s, 1);
+			out << ",\n   \"time\": "; WriteStatJSON(out, agg, s, 2);
+			out << ",\n   \"phases\": {";
+			bool first = true;
+			for(size_t p = 0; p < agg.vPhaseName.size(); ++p){
+				if(agg.value(agg.vMax, s, 4 + 2*p) == 0) continue;
+				if(!first) out << ",";
+				first = false;
+				out << "\n    " << JSONString(agg.vPhaseName[p]) << ": {\"time\": ";
+				WriteStatJSON(out, agg, s, 3 + 2*p);
+				out << ", \"count\": ";
+				WriteStatJSON(out, agg, s, 4 + 2*p);
+				out << "}";
+			}
+			out << "}}";
+		}
+		out << "\n]}\n";
+	}
+	else{
+		const vector<Solve>& vSolve = Data().vSolve;
+#ifdef UG_PARALLEL
+		out << "{\"rank\": " << pcl::ProcRank() << ",\n \"solves\": [";
+#else
+		out << "{\"rank\": 0,\n \"solves\": [";
+#endif
+		for(size_t s = 0; s < vSolve.size(); ++s){
+			const Solve& solve = vSolve[s];
+			if(s > 0) out << ",";
+			out << "\n  {\"id\": " << s << ", \"name\": " << JSONString(solve.name)
+				<< ", \"parent\": " << solve.parent << ", \"depth\": " << solve.depth
+				<< ", \"converged\": " << (solve.converged ? "true" : "false")
+				<< ", \"time\": " << (solve.open ? now() : solve.tEnd) - solve.tStart
+				<< ",\n   \"phases\": ";
+			WritePhasesJSON(out, solve.vTotal);
+			out << ",\n   \"iterations\": [";
+			for(size_t i = 0; i < solve.vIteration.size(); ++i){
+				const Iteration& it = solve.vIteration[i];
+				if(i > 0) out << ",";
+				out << "\n    {\"iteration\": " << i << ", \"defect\": " << it.defect
+					<< ", \"time\": " << it.wallTime << ", \"phases\": ";
+				WritePhasesJSON(out, it.vPhase);
+				out << "}";
+			}
+			out << "]}";
+		}
+		out << "\n]}\n";
+	}
+
+	const string name = bAggregate ? filename : ProcessFilename(filename);
+	fstream f(name.c_str(), ios::out);
+	UG_COND_THROW(!f.is_open(), "SolverTelemetry: could not open " << name);
+	f << out.str();
+}
+
+void SolverTelemetry::write_csv(const std::string& filename, bool bAggregate)
+{
+	stringstream out;
+	out.precision(10);
+
+	if(bAggregate){
+		AggregatedTelemetry agg;
+		Aggregate(agg);
+		if(!IsOutputProc()) return;
+
+		out << "solver,phase,quantity,min,max,avg\n";
+		for(size_t s = 0; s < agg.vSolverName.size(); ++s){
+			const string name = CSVString(agg.vSolverName[s]);
+			out << name << ",,num_solves,"; WriteStatCSV(out, agg, s, 0);
+			out << name << ",,num_iterations,"; WriteStatCSV(out, agg, s, 1);
+			out << name << ",,time,"; WriteStatCSV(out, agg, s, 2);
+			for(size_t p = 0; p < agg.vPhaseName.size(); ++p){
+				if(agg.value(agg.vMax, s, 4 + 2*p) == 0) continue;
+				const string phase = CSVString(agg.vPhaseName[p]);
+				out << name << "," << phase << ",time,"; WriteStatCSV(out, agg, s, 3 + 2*p);
+				out << name << "," << phase << ",count,"; WriteStatCSV(out, agg, s, 4 + 2*p);
+			}
+		}
+	}
+	else{
+		int rank = 0;
+#ifdef UG_PARALLEL
+		rank = pcl::ProcRank();
+#endif
+		const vector<Solve>& vSolve = Data().vSolve;
+		const vector<string>& vPhaseName = Data().vPhaseName;
+
+	//	one line per iteration (phase "iteration") and per phase timed in it
+		out << "rank,solve,solver,parent,depth,converged,iteration,defect,phase,time,count\n";
+		for(size_t s = 0; s < vSolve.size(); ++s){
+			const Solve& solve = vSolve[s];
+			stringstream prefix;
+			prefix << rank << "," << s << "," << CSVString(solve.name) << ","
+				<< solve.parent << "," << solve.depth << "," << solve.converged << ",";
+			for(size_t i = 0; i < solve.vIteration.size(); ++i){
+				const Iteration& it = solve.vIteration[i];
+				out << prefix.str() << i << "," << it.defect << ",iteration,"
+					<< it.wallTime << ",1\n";
+				for(size_t p = 0; p < it.vPhase.size(); ++p){
+					if(it.vPhase[p].count == 0) continue;
+					out << prefix.str() << i << "," << it.defect << ","
+						<< CSVString(vPhaseName[p]) << "," << it.vPhase[p].time
+						<< "," << it.vPhase[p].count << "\n";
+				}
+			}
+		}
+	}
+
+	const string name = bAggregate ? filename : ProcessFilename(filename);
+	fstream f(name.c_str(), ios::out);
+	UG_COND_THROW(!f.is_open(), "SolverTelemetry: could not open " << name);
+	f << out.str();
+}
+
+void SolverTelemetry::print()
+{
+	TelemetryData& d = Data();
+	const vector<Solve>& vSolve = d.vSolve;
+
+//	summarize per solver name, in order of first appearance
+	vector<string> vName;
+	map<string, size_t> mName;
+	vector<size_t> vNumSolves, vNumIter;
+	vector<double> vTime;
+	vector<vector<Phase> > vPhase;
+	for(size_t s = 0; s < vSolve.size(); ++s){
+		const Solve& solve = vSolve[s];
+		map<string, size_t>::iterator it = mName.find(solve.name);
+		size_t i;
+		if(it == mName.end()){
+			i = vName.size();
+			mName[solve.name] = i;
+			vName.push_back(solve.name);
+			vNumSolves.push_back(0); vNumIter.push_back(0); vTime.push_back(0.0);
+			vPhase.push_back(vector<Phase>());
+		}
+		else i = it->second;
+		vNumSolves[i]++;
+		vNumIter[i] += solve.vIteration.size() - 1;
+		vTime[i] += (solve.open ? now() : solve.tEnd) - solve.tStart;
+		AddPhases(vPhase[i], solve.vTotal);
+	}
+
+	UG_LOG("Solver telemetry (" << vSolve.size() << " solves):\n");
+	for(size_t i = 0; i < vName.size(); ++i){
+		UG_LOG("  " << vName[i] << ": " << vNumSolves[i] << " solves, "
+		       << vNumIter[i] << " iterations, " << vTime[i] << " s\n");
+		for(size_t p = 0; p < vPhase[i].size(); ++p){
+			if(vPhase[i][p].count == 0) continue;
+			UG_LOG("    " << left << setw(24) << d.vPhaseName[p] << right
+			       << setw(12) << vPhase[i][p].time << " s  "
+			       << setw(10) << vPhase[i][p].count << " calls\n");
+		}
+	}
+}
+
+
+void EnableSolverTelemetry(bool bEnable)
+{
+	SolverTelemetry::enable(bEnable);
+}
+
+void ClearSolverTelemetry()
+{
+	SolverTelemetry::clear();
+}
+
+void WriteSolverTelemetryJSON(const char* filename, bool bAggregate)
+{
+	SolverTelemetry::write_json(filename, bAggregate);
+}
+
+void WriteSolverTelemetryCSV(const char* filename, bool bAggregate)
+{
+	SolverTelemetry::write_csv(filename, bAggregate);
+}
+
+void PrintSolverTelemetry()
+{
+	SolverTelemetry::print();
+}
+
+size_t SolverTelemetryNumSolves()
+{
+	return SolverTelemetry::solves().size();
+}
+
+std::string SolverTelemetrySolveName(size_t solve)
+{
+	return GetSolve(solve).name;
+}
+
+size_t SolverTelemetryNumIterations(size_t solve)
+{
+	return GetSolve(solve).vIteration.size() - 1;
+}
+
+bool SolverTelemetryConverged(size_t solve)
+{
+	return GetSolve(solve).converged;
+}
+
+number SolverTelemetryDefect(size_t solve, size_t iteration)
+{
+	const SolverTelemetry::Solve& s = GetSolve(solve);
+	UG_COND_THROW(iteration >= s.vIteration.size(), "SolverTelemetry: iteration "
+	              << iteration << " of solve " << solve << " requested, but only "
+	              << s.vIteration.size() << " recorded.");
+	return s.vIteration[iteration].defect;
+}
+
+double SolverTelemetrySolveTime(size_t solve)
+{
+	const SolverTelemetry::Solve& s = GetSolve(solve);
+	return (s.open ? SolverTelemetry::now() : s.tEnd) - s.tStart;
+}
+
+double SolverTelemetryPhaseTime(size_t solve, const char* phase)
+{
+	return PhaseTime(GetSolve(solve).vTotal, FindPhase(phase));
+}
+
+double SolverTelemetryIterationPhaseTime(size_t solve, size_t iteration,
+                                         const char* phase)
+{
+	const SolverTelemetry::Solve& s = GetSolve(solve);
+	UG_COND_THROW(iteration >= s.vIteration.size(), "SolverTelemetry: iteration "
+	              << iteration << " of solve " << solve << " requested, but only "
+	              << s.vIteration.size() << " recorded.");
+	return PhaseTime(s.vIteration[iteration].vPhase, FindPhase(phase));
+}
+
+}// end of namespace ug
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__PROFILER__SOLVER_TELEMETRY__
+#define __H__UG__COMMON__PROFILER__SOLVER_TELEMETRY__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "common/types.h"
+
+namespace ug{
+
+/**
+ * Collects machine readable timings of the solver phases per iteration.
+ *
+ * A solve is opened and closed by the convergence checks (start, update and
+ * post), so every iterative solver using one of the standard convergence
+ * checks is recorded with its defect history. The solvers, the geometric
+ * multigrid cycle and the newton solver time their phases (spmv, dot,
+ * precond_apply, mg_l<lev>_presmooth, assemble_jacobian, ...) with
+ * SolverTelemetryTimer. The time of a phase is charged to the iteration of
+ * the innermost open solve in which it ends. Time spent while no solve is
+ * open is charged to iteration 0 of the next solve (e.g. the assembling of
+ * the start defect of a newton solver).
+ *
+ * Phase times are inclusive, i.e. the time of 'spmv' inside a pre-smoother
+ * is contained in both 'spmv' and 'mg_l<lev>_presmooth'. A phase nested into
+ * itself (e.g. a preconditioner used inside a preconditioner) is only timed
+ * at the outermost level.
+ *
+ * The collector is disabled by default. Then every hook only costs the check
+ * of a global flag. It is not thread safe: timers started inside of OpenMP
+ * parallel regions are ignored.
+ */
+class SolverTelemetry
+{
+	public:
+	///	accumulated time of a phase
+		struct Phase
+		{
+			Phase() : time(0.0), count(0) {}
+			double time;
+			size_t count;
+		};
+
+	///	a recorded iteration
+		struct Iteration
+		{
+			number defect;			///< defect after this iteration
+			double wallTime;		///< time since the previous iteration
+			std::vector<Phase> vPhase;	///< indexed by phase id
+		};
+
+	///	a recorded solve
+		struct Solve
+		{
+			std::string name;
+			int parent;				///< index of the enclosing solve or -1
+			int depth;				///< nesting depth (0 for outermost solves)
+			const void* owner;		///< convergence check feeding this solve
+			bool open;
+			bool converged;
+			double tStart, tEnd, tLast;
+			std::vector<Iteration> vIteration;	///< iteration 0 is the start
+			std::vector<Phase> vCurrent;	///< phases of the running iteration
+			std::vector<Phase> vTotal;		///< phases of the whole solve
+		};
+
+	public:
+	///	returns if telemetry is recorded
+		static bool enabled() {return s_bEnabled;}
+
+	///	enables or disables the recording
+		static void enable(bool bEnable);
+
+	///	removes all recorded solves (phase ids remain valid)
+		static void clear();
+
+	///	returns the id of a phase, registers the phase if needed
+		static int phase_id(const std::string& name);
+
+	///	returns the id of the phase "mg_l<lev>_<name>"
+		static int level_phase_id(const char* name, int lev);
+
+	///	returns the name of a phase
+		static const std::string& phase_name(int id);
+
+	///	number of registered phases
+		static size_t num_phases();
+
+	///	opens a solve fed by owner with the start defect
+		static void begin_solve(const void* owner, const std::string& name,
+		                        number defect);
+
+	///	records the end of an iteration of the solve fed by owner
+		static void iteration(const void* owner, number defect);
+
+	///	closes the solve fed by owner
+		static void end_solve(const void* owner, bool converged);
+
+	///	returns the current time in seconds
+		static double now();
+
+	///	starts timing of a phase, returns false if the phase is not timed
+		static bool start_phase(int id);
+
+	///	stops timing of a phase and charges the elapsed time
+		static void stop_phase(int id, double tStart);
+
+	///	recorded solves
+		static const std::vector<Solve>& solves();
+
+	///	writes all solves in JSON format
+	/**
+	 * If bAggregate is false, every process writes its own solves with
+	 * all iterations to filename (with "_p<rank>" inserted before the file
+	 * extension in parallel runs). If bAggregate is true, the solves are
+	 * summarized per solver name and the min/max/avg over all processes is
+	 * written by process 0. In that case the method has to be called on all
+	 * processes.
+	 */
+		static void write_json(const std::string& filename, bool bAggregate);
+
+	///	writes all solves in CSV format (one line per iteration and phase)
+	/// \sa write_json
+		static void write_csv(const std::string& filename, bool bAggregate);
+
+	///	prints a summary per solver name
+		static void print();
+
+	private:
+		static bool s_bEnabled;
+};
+
+
+///	times a phase of a solver for SolverTelemetry
+/**
+ * The timer is started on construction and stopped on destruction or by a
+ * call to end(). If the telemetry is disabled or id is negative, nothing is
+ * recorded.
+ */
+class SolverTelemetryTimer
+{
+	public:
+		explicit SolverTelemetryTimer(int id) : m_id(-1), m_tStart(0.0)
+		{
+			if(SolverTelemetry::enabled() && id >= 0 && SolverTelemetry::start_phase(id)){
+				m_id = id;
+				m_tStart = SolverTelemetry::now();
+			}
+		}
+
+		~SolverTelemetryTimer() {end();}
+
+		void end()
+		{
+			if(m_id >= 0){
+				SolverTelemetry::stop_phase(m_id, m_tStart);
+				m_id = -1;
+			}
+		}
+
+	private:
+		int m_id;
+		double m_tStart;
+};
+
+
+///	enables or disables solver telemetry (default: disabled)
+void EnableSolverTelemetry(bool bEnable);
+
+///	removes all recorded solves
+void ClearSolverTelemetry();
+
+///	writes the recorded solves in JSON format (see SolverTelemetry::write_json)
+void WriteSolverTelemetryJSON(const char* filename, bool bAggregate);
+
+///	writes the recorded solves in CSV format (see SolverTelemetry::write_csv)
+void WriteSolverTelemetryCSV(const char* filename, bool bAggregate);
+
+///	prints a summary of the recorded solves per solver name
+void PrintSolverTelemetry();
+
+///	number of recorded solves on this process
+size_t SolverTelemetryNumSolves();
+
+///	name of a recorded solve
+std::string SolverTelemetrySolveName(size_t solve);
+
+///	number of iterations of a recorded solve (without the start)
+size_t SolverTelemetryNumIterations(size_t solve);
+
+///	returns if a recorded solve converged
+bool SolverTelemetryConverged(size_t solve);
+
+///	defect after an iteration of a recorded solve (0 is the start defect)
+number SolverTelemetryDefect(size_t solve, size_t iteration);
+
+///	wall time of a recorded solve
+double SolverTelemetrySolveTime(size_t solve);
+
+///	time spent in a phase during a recorded solve
+double SolverTelemetryPhaseTime(size_t solve, const char* phase);
+
+///	time spent in a phase during an iteration of a recorded solve
+double SolverTelemetryIterationPhaseTime(size_t solve, size_t iteration,
+                                         const char* phase);
+
+}
+
+
+///	starts a timer for the phase 'name' (a string literal) in the current scope
+#define SOLVER_TELEMETRY_BEGIN(var, name)\
+	static const int var##_telemetryId = ug::SolverTelemetry::phase_id(name);\
+	ug::SolverTelemetryTimer var(var##_telemetryId)
+
+///	starts a timer for the phase "mg_l<lev>_<name>" in the current scope
+#define SOLVER_TELEMETRY_LEVEL_BEGIN(var, name, lev)\
+	ug::SolverTelemetryTimer var(ug::SolverTelemetry::enabled() ?\
+		ug::SolverTelemetry::level_phase_id(name, lev) : -1)
+
+///	stops a timer before the end of its scope
+#define SOLVER_TELEMETRY_END(var)	var.end()
+
+#endif /* __H__UG__COMMON__PROFILER__SOLVER_TELEMETRY__ */
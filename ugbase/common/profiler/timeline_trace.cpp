@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "timeline_trace.h"
+#include "common/log.h"
+#include "common/error.h"
+
+#ifdef UG_PROFILE_TIMELINE
+	#ifdef UG_CXX11
+		#include <chrono>
+	#else
+		#include <time.h>
+	#endif
+#endif
+
+#ifdef UG_PARALLEL
+#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+
+#ifdef UG_PROFILE_TIMELINE
+
+bool TimelineTrace::s_bEnabled = true;
+unsigned long long TimelineTrace::s_minDuration = 0;
+size_t TimelineTrace::s_bufferSize = 65536;
+UG_TIMELINE_THREAD_LOCAL TimelineTrace::ThreadBuffer* TimelineTrace::s_pThreadBuffer = NULL;
+TimelineTrace::ThreadBuffer* volatile TimelineTrace::s_pFirstBuffer = NULL;
+int volatile TimelineTrace::s_numThreads = 0;
+
+//	reference point for the conversion of ticks to nanoseconds
+static const unsigned long long s_refTicks = TimelineTrace::ticks();
+static const unsigned long long s_refNs = TimelineTrace::now();
+
+
+TimelineTrace::ThreadBuffer::
+ThreadBuffer(size_t capacity, int index) :
+	events(capacity), next(0), numRecorded(0), depth(0), threadIndex(index), pNext(NULL)
+{}
+
+
+unsigned long long TimelineTrace::now()
+{
+#ifdef UG_CXX11
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+
+double TimelineTrace::ns_per_tick()
+{
+#ifdef UG_TIMELINE_RDTSC
+//	make sure the calibration interval is long enough
+	unsigned long long ns = now();
+	while(ns - s_refNs < 10000000)
+		ns = now();
+	return double(ns - s_refNs) / double(ticks() - s_refTicks);
+#else
+	return 1.0;
+#endif
+}
+
+
+long long TimelineTrace::ticks_to_ns(unsigned long long t, double nsPerTick)
+{
+	return (long long) s_refNs + (long long)((double)((long long)(t - s_refTicks)) * nsPerTick);
+}
+
+
+TimelineTrace::ThreadBuffer* TimelineTrace::create_thread_buffer()
+{
+	ThreadBuffer* tb = new ThreadBuffer(s_bufferSize > 0 ? s_bufferSize : 1,
+	                                    __sync_fetch_and_add(&s_numThreads, 1));
+//	push to the front of the global list
+	do{
+		tb->pNext = s_pFirstBuffer;
+	}while(!__sync_bool_compare_and_swap(&s_pFirstBuffer, tb->pNext, tb));
+	return tb;
+}
+
+
+void TimelineTrace::end_latest()
+{
+	ThreadBuffer* tb = thread_buffer();
+	if(tb->depth == 0) return;
+	tb->depth--;
+	if(tb->depth >= MAX_DEPTH) return;
+
+	OpenRegion &r = tb->open[tb->depth];
+	if(r.owner) r.owner->deactivate();
+	if(r.start == 0 || !s_bEnabled) return;
+
+	const unsigned long long duration = ticks() - r.start;
+	if(duration < s_minDuration) return;
+
+	Event &e = tb->events[tb->next];
+	e.name = r.name;
+	e.group = r.group;
+	e.start = r.start;
+	e.duration = duration;
+	if(++tb->next == tb->events.size()) tb->next = 0;
+	tb->numRecorded++;
+}
+
+
+static void WriteJSONString(ostream &out, const char* str)
+{
+	out << '"';
+	for(; *str; ++str)
+	{
+		if(*str == '"' || *str == '\\') out << '\\';
+		if((unsigned char)(*str) >= 0x20) out << *str;
+	}
+	out << '"';
+}
+
+/**
+ * writes the events of all threads of this process as comma separated
+ * chrome trace events (without enclosing brackets).
+ * \param offset	added to all time stamps (ns)
+ */
+static void WriteTimelineEvents(ostream &out, int rank, long long offset)
+{
+	const double nsPerTick = TimelineTrace::ns_per_tick();
+	bool bFirst = true;
+	for(TimelineTrace::ThreadBuffer* tb = TimelineTrace::first_buffer(); tb != NULL; tb = tb->pNext)
+	{
+		if(!bFirst) out << ",\n";
+		bFirst = false;
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":"
+			<< tb->threadIndex << ",\"args\":{\"name\":\"thread " << tb->threadIndex << "\"}}";
+
+		const size_t capacity = tb->events.size();
+		const size_t num = tb->numRecorded < capacity ? tb->numRecorded : capacity;
+		const size_t first = tb->numRecorded < capacity ? 0 : tb->next;
+		for(size_t i=0; i<num; i++)
+		{
+			const TimelineTrace::Event &e = tb->events[(first + i) % capacity];
+			out << ",\n{\"name\":";
+			WriteJSONString(out, e.name);
+			out << ",\"cat\":";
+			WriteJSONString(out, e.group ? e.group : "ug");
+			out << ",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":" << tb->threadIndex
+				<< ",\"ts\":" << (TimelineTrace::ticks_to_ns(e.start, nsPerTick) + offset) * 1e-3
+				<< ",\"dur\":" << e.duration * nsPerTick * 1e-3 << "}";
+		}
+		if(tb->numRecorded > capacity)
+			UG_LOG("WriteTimelineTrace: thread " << tb->threadIndex << " dropped the oldest "
+					<< tb->numRecorded - capacity << " events. Increase the buffer size "
+					"with SetTimelineTraceBufferSize.\n");
+	}
+	if(!bFirst) out << ",\n";
+	out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+		<< ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+}
+
+#endif // UG_PROFILE_TIMELINE
+
+
+void WriteTimelineTrace(const char *filename)
+{
+#ifdef UG_PROFILE_TIMELINE
+	stringstream ss;
+	ss.precision(15);
+
+#ifdef UG_PARALLEL
+//	time stamps are shifted to the clock of process 0, using the time
+//	measured directly after a barrier
+	pcl::ProcessCommunicator pc;
+	pc.barrier();
+	long long localNow = (long long) TimelineTrace::now();
+	long long rootNow = localNow;
+	pc.broadcast(&rootNow, 1, PCL_DT_LONG_LONG_INT, 0);
+	WriteTimelineEvents(ss, pcl::ProcRank(), rootNow - localNow);
+
+	pcl::InterfaceCommunicator<pcl::SingleLevelLayout<pcl::OrderedInterface<size_t, vector> > > ic;
+	if(pcl::ProcRank() != 0)
+	{
+		BinaryBuffer buf;
+		Serialize(buf, ss.str());
+		ic.send_raw(0, buf.buffer(), buf.write_pos(), false);
+		ic.communicate();
+		return;
+	}
+#else
+	WriteTimelineEvents(ss, 0, 0);
+#endif
+
+	fstream f(filename, ios::out);
+	UG_COND_THROW(!f.is_open(), "WriteTimelineTrace: could not open " << filename);
+	f << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	f << ss.str();
+
+#ifdef UG_PARALLEL
+	vector<BinaryBuffer> buffers(pcl::NumProcs()-1);
+	for(int i=1; i<pcl::NumProcs(); i++)
+		ic.receive_raw(i, buffers[i-1]);
+	ic.communicate();
+
+	for(int i=1; i<pcl::NumProcs(); i++)
+	{
+		string s;
+		Deserialize(buffers[i-1], s);
+		f << ",\n" << s;
+	}
+#endif
+	f << "\n]}\n";
+	UG_LOG("Wrote timeline trace to " << filename << ".\n");
+#else
+	UG_LOG("Did NOT write timeline trace since it is disabled (enable with cmake -DPROFILE_TIMELINE=ON ..)\n");
+#endif
+}
+
+
+void SetTimelineTraceEnabled(bool bEnable)
+{
+#ifdef UG_PROFILE_TIMELINE
+	TimelineTrace::s_bEnabled = bEnable;
+#endif
+}
+
+void SetTimelineTraceMinDuration(double minDuration)
+{
+#ifdef UG_PROFILE_TIMELINE
+	UG_COND_THROW(minDuration < 0, "minimal duration has to be >= 0, is " << minDuration);
+	TimelineTrace::s_minDuration = (unsigned long long)(minDuration * 1e9 / TimelineTrace::ns_per_tick());
+#endif
+}
+
+void SetTimelineTraceBufferSize(size_t numEvents)
+{
+#ifdef UG_PROFILE_TIMELINE
+	TimelineTrace::s_bufferSize = numEvents;
+#endif
+}
+
+void ClearTimelineTrace()
+{
+#ifdef UG_PROFILE_TIMELINE
+	for(TimelineTrace::ThreadBuffer* tb = TimelineTrace::first_buffer(); tb != NULL; tb = tb->pNext)
+	{
+		tb->next = 0;
+		tb->numRecorded = 0;
+	}
+#endif
+}
+
+}
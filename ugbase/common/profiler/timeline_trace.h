@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__PROFILER__TIMELINE_TRACE__
+#define __H__UG__COMMON__PROFILER__TIMELINE_TRACE__
+
+#include <cstddef>
+#include <vector>
+
+namespace ug{
+
+/**
+ * writes the recorded timeline of all threads of all processes to a file in
+ * the Chrome trace event format (JSON). The file can be viewed with
+ * chrome://tracing or https://ui.perfetto.dev. Every process is shown as
+ * "pid" = rank, every thread as "tid".
+ * Has to be called on all processes. No thread must record regions while
+ * the trace is written.
+ * \param filename	name of the file (written by process 0)
+ */
+void WriteTimelineTrace(const char *filename);
+
+///	enables or disables recording at runtime (default: enabled)
+void SetTimelineTraceEnabled(bool bEnable);
+
+/**
+ * only regions lasting at least minDuration seconds are recorded. Shorter
+ * regions only cost two clock reads, so with a threshold of e.g. 1e-4 the
+ * timeline can be kept enabled in production runs.
+ */
+void SetTimelineTraceMinDuration(double minDuration);
+
+/**
+ * sets the number of events kept per thread (default 65536). If the buffer
+ * is full, the oldest events are overwritten. Only affects threads which
+ * did not record yet.
+ */
+void SetTimelineTraceBufferSize(size_t numEvents);
+
+///	removes all recorded events
+void ClearTimelineTrace();
+
+}
+
+
+#ifdef UG_PROFILE_TIMELINE
+
+#ifdef UG_CXX11
+	#define UG_TIMELINE_THREAD_LOCAL thread_local
+#else
+	#define UG_TIMELINE_THREAD_LOCAL __thread
+#endif
+
+//	on x86 the time stamp counter is read directly, it is much cheaper than a clock call
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	#define UG_TIMELINE_RDTSC
+	#include <x86intrin.h>
+#endif
+
+namespace ug{
+
+class AutoTimelineRegion;
+
+/**
+ * Per thread recorder of profiled regions.
+ *
+ * Every thread owns a ring buffer of complete events (name, start, duration)
+ * and a stack of the currently open regions. Nothing is shared between
+ * threads while recording, the buffer of a thread is only registered once
+ * in a global lock-free list. Time stamps are taken in ticks (the time stamp
+ * counter on x86, nanoseconds of a monotonic clock otherwise) and converted
+ * when the trace is written.
+ */
+class TimelineTrace
+{
+	public:
+	///	a recorded region
+		struct Event
+		{
+			const char* name;
+			const char* group;
+			unsigned long long start;	///< in ticks
+			unsigned long long duration;	///< in ticks
+		};
+
+	///	an open region
+		struct OpenRegion
+		{
+			const char* name;
+			const char* group;
+			unsigned long long start;
+			AutoTimelineRegion* owner;
+		};
+
+	///	maximal nesting depth of regions recorded
+		static const size_t MAX_DEPTH = 256;
+
+	///	recorder of one thread
+		struct ThreadBuffer
+		{
+			ThreadBuffer(size_t capacity, int threadIndex);
+
+			std::vector<Event> events;	///< ring buffer
+			size_t next;				///< position of the next event
+			unsigned long long numRecorded;
+			OpenRegion open[MAX_DEPTH];
+			size_t depth;
+			int threadIndex;
+			ThreadBuffer* pNext;		///< next buffer in the global list
+		};
+
+	public:
+	///	opens a region on the calling thread
+		static inline void begin(const char* name, const char* group, AutoTimelineRegion* owner)
+		{
+			ThreadBuffer* tb = thread_buffer();
+			if(tb->depth < MAX_DEPTH)
+			{
+				OpenRegion &r = tb->open[tb->depth];
+				r.name = name; r.group = group; r.owner = owner;
+			//	regions opened while disabled are tracked, but not recorded
+				r.start = s_bEnabled ? ticks() : 0;
+			}
+			tb->depth++;
+		}
+
+	///	closes the latest region of the calling thread
+		static void end_latest();
+
+	///	returns the current time in nanoseconds
+		static unsigned long long now();
+
+	///	returns the current time in ticks
+		static inline unsigned long long ticks()
+		{
+#ifdef UG_TIMELINE_RDTSC
+			return __rdtsc();
+#else
+			return now();
+#endif
+		}
+
+	///	returns the length of a tick in nanoseconds
+		static double ns_per_tick();
+
+	///	converts a tick time stamp to the time returned by now()
+		static long long ticks_to_ns(unsigned long long t, double nsPerTick);
+
+	///	returns the buffer of the calling thread, creates it if needed
+		static inline ThreadBuffer* thread_buffer()
+		{
+			if(s_pThreadBuffer == NULL) s_pThreadBuffer = create_thread_buffer();
+			return s_pThreadBuffer;
+		}
+
+		static ThreadBuffer* first_buffer()	{return s_pFirstBuffer;}
+
+	public:
+		static bool s_bEnabled;
+		static unsigned long long s_minDuration;	///< in ticks
+		static size_t s_bufferSize;
+
+	private:
+		static ThreadBuffer* create_thread_buffer();
+
+		static UG_TIMELINE_THREAD_LOCAL ThreadBuffer* s_pThreadBuffer;
+		static ThreadBuffer* volatile s_pFirstBuffer;
+		static int volatile s_numThreads;
+};
+
+///	closes its region when it goes out of scope, unless already closed by PROFILE_END
+class AutoTimelineRegion
+{
+	public:
+		AutoTimelineRegion(const char* name, const char* group) : m_bActive(true)
+		{
+			TimelineTrace::begin(name, group, this);
+		}
+		~AutoTimelineRegion()
+		{
+			if(m_bActive) TimelineTrace::end_latest();
+		}
+		void deactivate()	{m_bActive = false;}
+
+	private:
+		bool m_bActive;
+};
+
+}
+
+#define PROFILE_TIMELINE_BEGIN(id, name, group)		\
+		ug::AutoTimelineRegion __timeline_##id(name, group);
+
+#define PROFILE_TIMELINE_END()						\
+		ug::TimelineTrace::end_latest();
+
+#else
+
+#define PROFILE_TIMELINE_BEGIN(id, name, group)
+#define PROFILE_TIMELINE_END()
+
+#endif // UG_PROFILE_TIMELINE
+
+#endif /* __H__UG__COMMON__PROFILER__TIMELINE_TRACE__ */
@@ -101,6 +101,9 @@ class BinaryBuffer
 	///	sets the write position.
 		void set_write_pos(size_t pos);
 
+	///	swaps the contents (including read- and write-position) with the given buffer
+		void swap(BinaryBuffer& buf);
+
 	private:
 		std::vector<char>	m_data;
 		size_t				m_readPos;
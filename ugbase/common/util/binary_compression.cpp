@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <cstring>
+#include <vector>
+#include "binary_compression.h"
+#include "common/error.h"
+
+namespace ug{
+
+namespace{
+
+const uint32 COMPRESSION_MAGIC = 0x5A4C4755;	// "UGLZ"
+const byte METHOD_STORED = 0;
+const byte METHOD_LZ = 1;
+const size_t HEADER_SIZE = sizeof(uint32) + sizeof(byte) + sizeof(uint64);
+
+const size_t MIN_MATCH = 4;
+const size_t MAX_OFFSET = 65535;
+const int HASH_LOG = 16;
+
+inline uint32 Read32(const byte* p)
+{
+	uint32 v;
+	memcpy(&v, p, sizeof(uint32));
+	return v;
+}
+
+inline uint32 Hash(uint32 v)
+{
+	return (v * 2654435761U) >> (32 - HASH_LOG);
+}
+
+///	writes a length which exceeded the 4 bits in the token as a sequence of 255-bytes
+inline byte* WriteLength(byte* op, size_t len)
+{
+	while(len >= 255){
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = (byte)len;
+	return op;
+}
+
+inline byte* WriteSequence(byte* op, const byte* lit, size_t numLit,
+						   size_t offset, size_t matchLen)
+{
+	byte* token = op++;
+	const size_t ml = (matchLen > 0) ? matchLen - MIN_MATCH : 0;
+	*token = (byte)(((numLit < 15) ? numLit : 15) << 4) | (byte)((ml < 15) ? ml : 15);
+
+	if(numLit >= 15)
+		op = WriteLength(op, numLit - 15);
+	memcpy(op, lit, numLit);
+	op += numLit;
+
+	if(matchLen > 0){
+		*op++ = (byte)(offset & 0xFF);
+		*op++ = (byte)(offset >> 8);
+		if(ml >= 15)
+			op = WriteLength(op, ml - 15);
+	}
+	return op;
+}
+
+inline size_t ReadLength(const byte*& ip, const byte* ipEnd, size_t len)
+{
+	if(len != 15) return len;
+	byte b;
+	do{
+		UG_COND_THROW(ip >= ipEnd, "DecompressBinaryData: Corrupted data.");
+		b = *ip++;
+		len += b;
+	}while(b == 255);
+	return len;
+}
+
+void WriteHeader(byte* op, byte method, uint64 rawSize)
+{
+	memcpy(op, &COMPRESSION_MAGIC, sizeof(uint32));
+	op[sizeof(uint32)] = method;
+	memcpy(op + sizeof(uint32) + sizeof(byte), &rawSize, sizeof(uint64));
+}
+
+}//	end of anonymous namespace
+
+
+bool IsCompressedBinaryData(const char* data, size_t size)
+{
+	if(size < HEADER_SIZE) return false;
+	uint32 magic;
+	memcpy(&magic, data, sizeof(uint32));
+	return magic == COMPRESSION_MAGIC;
+}
+
+size_t UncompressedBinaryDataSize(const char* data, size_t size)
+{
+	UG_COND_THROW(!IsCompressedBinaryData(data, size),
+				  "UncompressedBinaryDataSize: Data was not compressed by CompressBinaryData.");
+	uint64 rawSize;
+	memcpy(&rawSize, data + sizeof(uint32) + sizeof(byte), sizeof(uint64));
+	return (size_t)rawSize;
+}
+
+void CompressBinaryData(BinaryBuffer& out, const char* data, size_t size)
+{
+	const byte* in = reinterpret_cast<const byte*>(data);
+
+//	worst case: all literals plus length bytes and the header
+	const size_t maxSize = HEADER_SIZE + size + size / 255 + 16;
+	const size_t startPos = out.write_pos();
+	out.reserve(startPos + maxSize);
+	byte* const opStart = reinterpret_cast<byte*>(out.buffer()) + startPos;
+	byte* op = opStart + HEADER_SIZE;
+
+//	the hash table stores the position + 1 of the last occurrence of a 4-byte pattern
+	std::vector<uint32> vTable((size_t)1 << HASH_LOG, 0);
+
+	size_t anchor = 0;
+	size_t ip = 0;
+
+//	positions are stored as uint32 in the hash table. Larger blocks are
+//	stored without compression (the grid serialization never produces those
+//	in practice since data is sent in chunks anyway).
+	if(size >= MIN_MATCH && size < 0xFFFFFFFF){
+		const size_t ipLimit = size - MIN_MATCH;
+		while(ip <= ipLimit){
+			const uint32 seq = Read32(in + ip);
+			const uint32 h = Hash(seq);
+			const size_t ref = vTable[h];
+			vTable[h] = (uint32)(ip + 1);
+
+			if(ref > 0 && ip - (ref - 1) <= MAX_OFFSET && Read32(in + ref - 1) == seq)
+			{
+				const size_t matchPos = ref - 1;
+				size_t len = MIN_MATCH;
+				while(ip + len < size && in[matchPos + len] == in[ip + len])
+					++len;
+
+				op = WriteSequence(op, in + anchor, ip - anchor, ip - matchPos, len);
+				ip += len;
+				anchor = ip;
+			}
+			else{
+			//	skip faster through incompressible regions
+				ip += 1 + ((ip - anchor) >> 6);
+			}
+		}
+	}
+
+//	trailing literals
+	op = WriteSequence(op, in + anchor, size - anchor, 0, 0);
+
+	size_t compSize = op - opStart;
+	if(compSize >= HEADER_SIZE + size){
+	//	compression didn't pay off. Store the data instead.
+		WriteHeader(opStart, METHOD_STORED, size);
+		memcpy(opStart + HEADER_SIZE, data, size);
+		compSize = HEADER_SIZE + size;
+	}
+	else
+		WriteHeader(opStart, METHOD_LZ, size);
+
+	out.set_write_pos(startPos + compSize);
+}
+
+void DecompressBinaryData(BinaryBuffer& out, const char* data, size_t size)
+{
+	const size_t rawSize = UncompressedBinaryDataSize(data, size);
+	const byte method = (byte)data[sizeof(uint32)];
+
+	const size_t startPos = out.write_pos();
+	out.reserve(startPos + rawSize);
+	byte* const opStart = reinterpret_cast<byte*>(out.buffer()) + startPos;
+	byte* const opEnd = opStart + rawSize;
+	byte* op = opStart;
+
+	const byte* ip = reinterpret_cast<const byte*>(data) + HEADER_SIZE;
+	const byte* const ipEnd = reinterpret_cast<const byte*>(data) + size;
+
+	if(method == METHOD_STORED){
+		UG_COND_THROW((size_t)(ipEnd - ip) != rawSize,
+					  "DecompressBinaryData: Corrupted data.");
+		memcpy(op, ip, rawSize);
+		op += rawSize;
+	}
+	else if(method == METHOD_LZ){
+		while(ip < ipEnd){
+			const byte token = *ip++;
+
+		//	literals
+			const size_t numLit = ReadLength(ip, ipEnd, token >> 4);
+			UG_COND_THROW(numLit > (size_t)(ipEnd - ip) || numLit > (size_t)(opEnd - op),
+						  "DecompressBinaryData: Corrupted data.");
+			memcpy(op, ip, numLit);
+			op += numLit;
+			ip += numLit;
+
+		//	the last sequence only contains literals
+			if(ip == ipEnd) break;
+
+		//	match
+			UG_COND_THROW(ipEnd - ip < 2, "DecompressBinaryData: Corrupted data.");
+			const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+			ip += 2;
+			const size_t matchLen = ReadLength(ip, ipEnd, token & 15) + MIN_MATCH;
+			UG_COND_THROW(offset == 0 || offset > (size_t)(op - opStart)
+						  || matchLen > (size_t)(opEnd - op),
+						  "DecompressBinaryData: Corrupted data.");
+
+		//	copy byte by byte if source and target overlap
+			const byte* match = op - offset;
+			if(offset >= matchLen)
+				memcpy(op, match, matchLen);
+			else{
+				for(size_t i = 0; i < matchLen; ++i)
+					op[i] = match[i];
+			}
+			op += matchLen;
+		}
+	}
+	else{
+		UG_THROW("DecompressBinaryData: Unknown compression method " << (int)method);
+	}
+
+	UG_COND_THROW(op != opEnd, "DecompressBinaryData: Size mismatch after decompression.");
+	out.set_write_pos(startPos + rawSize);
+}
+
+}//	end of namespace
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__binary_compression__
+#define __H__UG__binary_compression__
+
+#include <cstddef>
+#include "binary_buffer.h"
+
+namespace ug{
+
+/// \addtogroup ugbase_common_util
+/// \{
+
+///	Compresses a block of binary data and appends the result to the given buffer.
+/**	A fast, dependency free LZ77 variant (similar to the LZ4 block format) is
+ * used. It is meant for data which is sent between processes, e.g. serialized
+ * grids, where byte-patterns repeat frequently. If the data can't be compressed,
+ * it is stored uncompressed, so that the output is at most a few bytes larger
+ * than the input.
+ *
+ * The output starts with a small header which identifies compressed data
+ * (see ug::IsCompressedBinaryData) and which stores the uncompressed size.*/
+void CompressBinaryData(BinaryBuffer& out, const char* data, size_t size);
+
+///	Decompresses data written by ug::CompressBinaryData and appends it to the given buffer.
+/**	Throws an error if the data is corrupted.*/
+void DecompressBinaryData(BinaryBuffer& out, const char* data, size_t size);
+
+///	returns true if the given data starts with the header of ug::CompressBinaryData.
+bool IsCompressedBinaryData(const char* data, size_t size);
+
+///	returns the uncompressed size of data written by ug::CompressBinaryData.
+size_t UncompressedBinaryDataSize(const char* data, size_t size);
+
+// end group ugbase_common_util
+/// \}
+
+}//	end of namespace
+
+#endif
@@ -34,6 +34,9 @@
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+#include "lib_algebra/cpu_algebra/multi_vector.h"
+
 namespace ug
 {
 
@@ -200,6 +203,96 @@ void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const
 	gs_step_UR(A, c, c, relaxFactor);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	gs_step_LL, gs_step_UR, sgs_step for MultiVector
+/**
+ * \brief Performs a forward gauss-seidel-step for all vectors of a MultiVector.
+ * Every matrix row is read once for all vectors.
+ * \sa gs_step_LL
+ */
+template<typename Matrix_type, typename TValue>
+void gs_step_LL(const Matrix_type &A, MultiVector<TValue> &c, const MultiVector<TValue> &d, const number relaxFactor)
+{
+	const size_t k = c.num_cols();
+	std::vector<TValue> s(k);
+
+	for(size_t i=0; i < c.size(); i++)
+	{
+		const TValue* di = d.row(i);
+		for(size_t j=0; j<k; j++) s[j] = di[j];
+
+		for(typename Matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i)
+		&& it.index() < i; ++it)
+		{
+			const TValue* cc = c.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(s[j], 1.0, s[j], -1.0, it.value(), cc[j]);
+		}
+
+		TValue* ci = c.row(i);
+		const typename Matrix_type::value_type &aii = A(i,i);
+		for(size_t j=0; j<k; j++)
+			InverseMatMult(ci[j], relaxFactor, aii, s[j]);
+	}
+}
+
+/**
+ * \brief Performs a backward gauss-seidel-step for all vectors of a MultiVector.
+ * \sa gs_step_UR
+ */
+template<typename Matrix_type, typename TValue>
+void gs_step_UR(const Matrix_type &A, MultiVector<TValue> &c, const MultiVector<TValue> &d, const number relaxFactor)
+{
+	const size_t k = c.num_cols();
+	std::vector<TValue> s(k);
+
+	if(c.size() == 0) return;
+	size_t i = c.size()-1;
+	do
+	{
+		const TValue* di = d.row(i);
+		for(size_t j=0; j<k; j++) s[j] = di[j];
+		typename Matrix_type::const_row_iterator diag = A.get_connection(i, i);
+
+		typename Matrix_type::const_row_iterator it = diag; ++it;
+		for(; it != A.end_row(i); ++it)
+		{
+			const TValue* cc = c.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(s[j], 1.0, s[j], -1.0, it.value(), cc[j]);
+		}
+
+		TValue* ci = c.row(i);
+		for(size_t j=0; j<k; j++)
+			InverseMatMult(ci[j], relaxFactor, diag.value(), s[j]);
+	} while(i-- != 0);
+}
+
+/**
+ * \brief Performs a symmetric gauss-seidel step for all vectors of a MultiVector.
+ * \sa sgs_step
+ */
+template<typename Matrix_type, typename TValue>
+void sgs_step(const Matrix_type &A, MultiVector<TValue> &c, const MultiVector<TValue> &d, const number relaxFactor)
+{
+	gs_step_LL(A, c, d, relaxFactor);
+
+	const size_t k = c.num_cols();
+	TValue s;
+	for(size_t i = 0; i<c.size(); i++)
+	{
+		TValue* ci = c.row(i);
+		const typename Matrix_type::value_type &aii = A(i,i);
+		for(size_t j=0; j<k; j++)
+		{
+			s = ci[j];
+			MatMult(ci[j], 1.0, aii, s);
+		}
+	}
+
+	gs_step_UR(A, c, c, relaxFactor);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	diag_step
 /**
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__SINGLE_PRECISION_UTIL__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__SINGLE_PRECISION_UTIL__
+
+#include <vector>
+#include "common/profiler/profiler.h"
+#include "lib_algebra/cpu_algebra/sparsematrix.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+/// value type used to store preconditioner matrices in single precision
+/**
+ * Preconditioner and smoother sweeps are bandwidth-bound and need only low
+ * accuracy, such that their matrices may be stored in single precision while
+ * the vectors and the outer iteration are kept in double precision. This is
+ * available for scalar algebras only. For block types the value type is
+ * unchanged and 'available' is false.
+ */
+template <typename TValue>
+struct single_precision_traits
+{
+	static const bool available = false;
+	typedef TValue value_type;
+	typedef SparseMatrix<TValue> matrix_type;
+};
+
+template <>
+struct single_precision_traits<double>
+{
+	static const bool available = true;
+	typedef float value_type;
+	typedef SparseMatrix<float> matrix_type;
+};
+
+///	copies a sparse matrix into a sparse matrix of another value type
+/**
+ * The sparsity pattern is copied, the values are converted.
+ * \param[out]	dest	copy of src
+ * \param[in]	src		matrix to copy
+ */
+template <typename TDestValue, typename TSrcValue>
+void CopySparseMatrixValues(SparseMatrix<TDestValue>& dest,
+                            const SparseMatrix<TSrcValue>& src)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename SparseMatrix<TSrcValue>::const_row_iterator const_row_iterator;
+	typedef typename SparseMatrix<TDestValue>::connection connection;
+
+	dest.resize_and_clear(src.num_rows(), src.num_cols());
+
+	std::vector<connection> vCon;
+	for(size_t i = 0; i < src.num_rows(); ++i)
+	{
+		vCon.clear();
+		for(const_row_iterator it = src.begin_row(i); it != src.end_row(i); ++it)
+			vCon.push_back(connection(it.index(), static_cast<TDestValue>(it.value())));
+		if(!vCon.empty())
+			dest.set_matrix_row(i, &vCon[0], vCon.size());
+	}
+	dest.defragment();
+}
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__SINGLE_PRECISION_UTIL__ */
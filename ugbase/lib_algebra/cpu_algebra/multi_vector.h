@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__MULTI_VECTOR__
+#define __H__UG__CPU_ALGEBRA__MULTI_VECTOR__
+
+#include <vector>
+#include "common/common.h"
+#include "../common/operations_vec.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+/// \{
+
+/**
+ * A dense block of k vectors of the same size, stored interleaved: the k
+ * entries of row i are stored contiguously. Operations with a sparse matrix
+ * (MatMult, gs_step_LL, invert_L, ...) then read every matrix entry once for
+ * all k vectors, instead of streaming the matrix k times.
+ *
+ * This is a local (process-wise) container, it has no parallel storage type.
+ */
+template <typename TValueType>
+class MultiVector
+{
+	public:
+		typedef TValueType value_type;
+
+	public:
+		MultiVector() : m_size(0), m_numCols(0) {}
+
+		MultiVector(size_t size, size_t numCols)
+			: m_values(size*numCols), m_size(size), m_numCols(numCols)
+		{}
+
+	///	resizes to size rows and numCols vectors, values are not kept
+		void resize(size_t size, size_t numCols)
+		{
+			m_values.resize(size*numCols);
+			m_size = size;
+			m_numCols = numCols;
+		}
+
+	///	number of rows (size of each vector)
+		size_t size() const {return m_size;}
+
+	///	number of vectors
+		size_t num_cols() const {return m_numCols;}
+
+	///	entry of vector j in row i
+		inline value_type& operator () (size_t i, size_t j)
+		{
+			UG_ASSERT(i < m_size && j < m_numCols, "(" << i << ", " << j << ") out of bounds");
+			return m_values[i*m_numCols + j];
+		}
+		inline const value_type& operator () (size_t i, size_t j) const
+		{
+			UG_ASSERT(i < m_size && j < m_numCols, "(" << i << ", " << j << ") out of bounds");
+			return m_values[i*m_numCols + j];
+		}
+
+	///	pointer to the num_cols() entries of row i
+		inline value_type* row(size_t i) {return &m_values[i*m_numCols];}
+		inline const value_type* row(size_t i) const {return &m_values[i*m_numCols];}
+
+	///	sets all entries to d
+		void set(number d)
+		{
+			for(size_t i=0; i<m_values.size(); i++)
+				m_values[i] = d;
+		}
+
+	///	copies v to vector j
+		template<typename TVector>
+		void set_column(size_t j, const TVector &v)
+		{
+			UG_ASSERT(v.size() == m_size, "size mismatch");
+			for(size_t i=0; i<m_size; i++)
+				(*this)(i, j) = v[i];
+		}
+
+	///	copies vector j to v
+		template<typename TVector>
+		void get_column(size_t j, TVector &v) const
+		{
+			UG_ASSERT(v.size() == m_size, "size mismatch");
+			for(size_t i=0; i<m_size; i++)
+				v[i] = (*this)(i, j);
+		}
+
+	private:
+		std::vector<value_type> m_values;
+		size_t m_size;
+		size_t m_numCols;
+};
+
+
+///	calculates dest = beta1 * A * w1 for all vectors of w1
+template<typename TValue, typename TMatrix>
+void MatMult(MultiVector<TValue> &dest, const number &beta1, const TMatrix &A,
+             const MultiVector<TValue> &w1)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_ASSERT(A.num_cols() == w1.size() && A.num_rows() == dest.size()
+	          && dest.num_cols() == w1.num_cols(), "size mismatch");
+	const size_t k = w1.num_cols();
+	for(size_t i=0; i<A.num_rows(); i++)
+	{
+		TValue* d = dest.row(i);
+		for(size_t j=0; j<k; j++)
+			d[j] = 0.0;
+		for(typename TMatrix::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			const TValue* w = w1.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(d[j], 1.0, d[j], beta1, it.value(), w[j]);
+		}
+	}
+}
+
+///	calculates dest = alpha1 * v1 + beta1 * A * w1 for all vectors of w1
+template<typename TValue, typename TMatrix>
+void MatMultAdd(MultiVector<TValue> &dest, const number &alpha1, const MultiVector<TValue> &v1,
+                const number &beta1, const TMatrix &A, const MultiVector<TValue> &w1)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_ASSERT(A.num_cols() == w1.size() && A.num_rows() == dest.size()
+	          && v1.size() == dest.size() && dest.num_cols() == w1.num_cols()
+	          && v1.num_cols() == w1.num_cols(), "size mismatch");
+	const size_t k = w1.num_cols();
+	for(size_t i=0; i<A.num_rows(); i++)
+	{
+		TValue* d = dest.row(i);
+		const TValue* v = v1.row(i);
+		for(size_t j=0; j<k; j++)
+			VecScaleAssign(d[j], alpha1, v[j]);
+		for(typename TMatrix::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			const TValue* w = w1.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(d[j], 1.0, d[j], beta1, it.value(), w[j]);
+		}
+	}
+}
+
+///	calculates dest(:,j) = alpha1[j] * v1(:,j) + alpha2[j] * v2(:,j) for all vectors j
+template<typename TValue>
+void VecScaleAdd(MultiVector<TValue> &dest,
+                 const std::vector<number> &alpha1, const MultiVector<TValue> &v1,
+                 const std::vector<number> &alpha2, const MultiVector<TValue> &v2)
+{
+	UG_ASSERT(dest.size() == v1.size() && dest.size() == v2.size(), "size mismatch");
+	const size_t k = dest.num_cols();
+	for(size_t i=0; i<dest.size(); i++)
+	{
+		TValue* d = dest.row(i);
+		const TValue* a = v1.row(i);
+		const TValue* b = v2.row(i);
+		for(size_t j=0; j<k; j++)
+			VecScaleAdd(d[j], alpha1[j], a[j], alpha2[j], b[j]);
+	}
+}
+
+///	calculates the scalar products res[j] = <v1(:,j), v2(:,j)> for all vectors j
+template<typename TValue>
+void VecProd(std::vector<number> &res, const MultiVector<TValue> &v1, const MultiVector<TValue> &v2)
+{
+	UG_ASSERT(v1.size() == v2.size() && v1.num_cols() == v2.num_cols(), "size mismatch");
+	const size_t k = v1.num_cols();
+	res.assign(k, 0.0);
+	for(size_t i=0; i<v1.size(); i++)
+	{
+		const TValue* a = v1.row(i);
+		const TValue* b = v2.row(i);
+		for(size_t j=0; j<k; j++)
+			VecProdAdd(a[j], b[j], res[j]);
+	}
+}
+
+/// \}
+
+} // namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__MULTI_VECTOR__ */
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include "algebra_misc.h"
 #include "common/math/ugmath.h"
+#include "common/profiler/solver_telemetry.h"
 #include "vector.h" // for urand
 
 #define prefetchReadWrite(a)
@@ -72,6 +73,7 @@ template<typename value_type>
 inline double Vector<value_type>::dotprod(const Vector &w) //const
 {
 	UG_ASSERT(m_size == w.m_size,  *this << " has not same size as " << w);
+	SOLVER_TELEMETRY_BEGIN(tsDot, "dot");
 
 	double sum=0;
 	for(size_t i=0; i<m_size; i++)	sum += VecProd(values[i], w[i]);
@@ -322,6 +324,7 @@ double operator *(const TRANSPOSED<Vector<value_type> > &x, const Vector<value_t
 template<typename value_type>
 inline double Vector<value_type>::norm() const
 {
+	SOLVER_TELEMETRY_BEGIN(tsDot, "dot");
 	double d=0;
 	for(size_t i=0; i<size(); ++i)
 		d+=BlockNorm2(values[i]);
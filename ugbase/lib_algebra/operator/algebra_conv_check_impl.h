@@ -118,6 +118,9 @@ void AlgebraicConvCheck<TVector>::start(const TVector& vec)
 
 	m_currentStep = 0;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::begin_solve(this, m_name, defect());
+
 	if (m_verbose)
 	{
 		UG_LOG("\n");
@@ -202,6 +205,9 @@ void AlgebraicConvCheck<TVector>::update(const TVector& vec)
 
 	m_currentStep++;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::iteration(this, defect());
+
 	if (m_verbose)
 	{
 		for (size_t cmp = 0; cmp < m_vCmpInfo.size(); cmp++)
@@ -297,6 +303,9 @@ bool AlgebraicConvCheck<TVector>::post()
 		if(!cmpFinished) success = false;
 	}
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::end_solve(this, success);
+
 	if(m_verbose){
 		print_offset();
 		UG_LOG(repeat(m_symbol, 5));
@@ -49,6 +49,7 @@
 
 #include "common/common.h"
 #include "common/stopwatch.h"
+#include "common/profiler/solver_telemetry.h"
 #include "lib_disc/function_spaces/approximation_space.h"
 #include "lib_disc/common/function_group.h"
 
@@ -90,6 +90,9 @@ void StdConvCheck<TVector>::start_defect(number initialDefect)
 	m_currentStep = 0;
 	m_ratesProduct = 1;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::begin_solve(this, m_name, m_initialDefect);
+
 	if(m_verbose)
 	{
 		UG_LOG("\n");
@@ -144,6 +147,9 @@ void StdConvCheck<TVector>::update_defect(number newDefect)
 	m_currentStep++;
 	m_ratesProduct *= newDefect/m_lastDefect;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::iteration(this, m_currentDefect);
+
 	if(m_verbose)
 	{
 		print_offset(); UG_LOG(std::setw(4) << step() << ":    " << std::scientific << defect() <<
@@ -209,10 +215,17 @@ bool StdConvCheck<TVector>::post()
 			{
 				print_offset(); UG_LOG("Maximum numbers of "<< m_maxSteps << " iterations reached without convergence.\n");
 			}
-			if (m_supress_unsuccessful) return true;
+			if (m_supress_unsuccessful){
+				if(SolverTelemetry::enabled())
+					SolverTelemetry::end_solve(this, false);
+				return true;
+			}
 		}
 	}
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::end_solve(this, success);
+
 	if(m_verbose)
 	{
 		print_offset();
@@ -34,6 +34,7 @@
 #define LINEAR_SOLVER_PROFILING_H_
 
 #include "common/profiler/profiler.h"
+#include "common/profiler/solver_telemetry.h"
 #define PROFILE_LS
 #ifdef PROFILE_LS
 	#define LS_PROFILE_FUNC()		PROFILE_FUNC_GROUP("LinearSolver algebra")
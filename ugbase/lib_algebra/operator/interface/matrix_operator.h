@@ -35,6 +35,7 @@
 
 #include "linear_operator.h"
 #include "lib_algebra/common/operations_mat/matrix_algebra_types.h"
+#include "common/profiler/solver_telemetry.h"
 
 namespace ug{
 
@@ -65,13 +66,38 @@ class MatrixOperator :	public virtual ILinearOperator<X,Y>,
 		virtual void init() {}
 
 	// 	Apply Operator f = L*u (e.g. d = J(u)*c in iterative scheme)
-		virtual void apply(Y& f, const X& u) {matrix_type::apply(f,u);}
+		virtual void apply(Y& f, const X& u)
+		{
+			SOLVER_TELEMETRY_BEGIN(tsSpmv, "spmv");
+			matrix_type::apply(f,u);
+		}
 
 	// 	Apply Operator, i.e. f = f - L*u;
-		virtual void apply_sub(Y& f, const X& u) {matrix_type::matmul_minus(f,u);}
+		virtual void apply_sub(Y& f, const X& u)
+		{
+			SOLVER_TELEMETRY_BEGIN(tsSpmv, "spmv");
+			matrix_type::matmul_minus(f,u);
+		}
 
 	// 	Access to matrix
 		virtual M& get_matrix() {return *this;};
+
+#ifdef UG_PARALLEL
+	///	matrix with complete rows on all copies of the interface rows (may be invalid)
+	/**
+	 * An assembler may provide this matrix together with the additive matrix.
+	 * Smoothers, that need complete interface rows (see MakeConsistent), then
+	 * copy it instead of exchanging the rows again. Whoever changes the
+	 * matrix has to reset or update it.
+	 */
+		ConstSmartPtr<M> consistent_rows_matrix() const {return m_spConsistentRows;}
+
+	///	sets the matrix with complete interface rows (SPNULL to reset)
+		void set_consistent_rows_matrix(ConstSmartPtr<M> spMat) {m_spConsistentRows = spMat;}
+
+	protected:
+		ConstSmartPtr<M> m_spConsistentRows;
+#endif
 };
 
 template<typename M, typename X, typename Y>
@@ -125,10 +125,12 @@ class IPreconditionedLinearOperatorInverse
 			if(!base_type::init(J, u)) return false;
 
 			LS_PROFILE_BEGIN(LS_InitPrecond);
+			SOLVER_TELEMETRY_BEGIN(tsInitPrecond, "precond_setup");
 			if(m_spPrecond.valid())
 				if(!m_spPrecond->init(J, u))
 					UG_THROW(name() << "::init: Cannot init Preconditioner "
 													"Operator for Operator J.");
+			SOLVER_TELEMETRY_END(tsInitPrecond);
 			LS_PROFILE_END(LS_InitPrecond);
 
 			return true;
@@ -140,10 +142,12 @@ class IPreconditionedLinearOperatorInverse
 			if(!base_type::init(L)) return false;
 
 			LS_PROFILE_BEGIN(LS_InitPrecond);
+			SOLVER_TELEMETRY_BEGIN(tsInitPrecond, "precond_setup");
 			if(m_spPrecond.valid())
 				if(!m_spPrecond->init(L))
 					UG_THROW(name() <<"::prepare: Cannot init Preconditioner "
 														"Operator for Operator L.");
+			SOLVER_TELEMETRY_END(tsInitPrecond);
 			LS_PROFILE_END(LS_InitPrecond);
 
 			return true;
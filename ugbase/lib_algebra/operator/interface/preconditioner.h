@@ -37,6 +37,7 @@
 #include "matrix_operator.h"
 #include "lib_algebra/operator/damping.h"
 #include "lib_algebra/operator/debug_writer.h"
+#include "common/profiler/solver_telemetry.h"
 
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
@@ -258,11 +259,13 @@ class IPreconditioner :
 				UG_THROW(name() << "::init': Passed Operator is invalid.");
 
 		//	Preprocess
+			SOLVER_TELEMETRY_BEGIN(tsSetup, "precond_setup");
 			if(!preprocess(m_spApproxOperator))
 			{
 				UG_LOG("ERROR in '"<<name()<<"::init': Preprocess failed.\n");
 				return false;
 			}
+			SOLVER_TELEMETRY_END(tsSetup);
 
 		//	Remember, that operator has been initialized
 			m_bInit = true;
@@ -302,6 +305,7 @@ class IPreconditioner :
 					m_spApproxOperator->num_rows(), m_spApproxOperator->num_cols());
 
 		// 	apply iterator: c = B*d
+			SOLVER_TELEMETRY_BEGIN(tsApply, "precond_apply");
 			if(!step(m_spApproxOperator, c, d))
 			{
 				UG_LOG("ERROR in '"<<name()<<"::apply': Step Routine failed.\n");
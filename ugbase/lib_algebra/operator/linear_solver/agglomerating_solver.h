@@ -43,6 +43,7 @@
 	#include "lib_algebra/parallelization/collect_matrix.h"
 	#include "lib_algebra/parallelization/parallelization.h"
 	#include "lib_algebra/parallelization/parallelization_util.h"
+	#include "lib_algebra/parallelization/hierarchical_agglomeration.h"
 #endif
 
 namespace ug{
@@ -86,9 +87,27 @@ class AgglomeratingBase : public TBase
 		typedef typename TAlgebra::matrix_type matrix_type;
 
 	public:
+		AgglomeratingBase() : m_pMatrix(NULL), m_bRoot(false), m_bEmpty(false) {}
+
 	// 	Destructor
 		virtual ~AgglomeratingBase() {};
 
+	///	sets the number of processes agglomerated onto one per stage (0 = all at once, default)
+		void set_agglomeration_group_size(size_t groupSize)
+		{
+#ifdef UG_PARALLEL
+			m_agglomeration.set_group_size(groupSize);
+#endif
+		}
+
+	///	sets the number of processes on which the agglomerated problem is solved (default 1)
+		void set_num_coarse_procs(size_t numProcs)
+		{
+#ifdef UG_PARALLEL
+			m_agglomeration.set_num_target_procs(numProcs);
+#endif
+		}
+
 		bool i_am_root()
 		{
 			return m_bRoot;
@@ -106,18 +125,13 @@ class AgglomeratingBase : public TBase
 #ifdef UG_PARALLEL
 			m_bEmpty = A.layouts()->proc_comm().empty();
 			if(m_bEmpty) return true;
-			m_bRoot = pcl::ProcRank() == A.layouts()->proc_comm().get_proc_id(0);
 			PROFILE_FUNC();
 
 			m_spCollectedOp = make_sp(new MatrixOperator<matrix_type, vector_type>());
 			matrix_type &collectedA = m_spCollectedOp->get_matrix();
 
-			CollectMatrixOnOneProc(A, collectedA, agglomerationLayout.master(), agglomerationLayout.slave());
-			agglomerationLayout.comm() = A.layouts()->comm();
-			agglomerationLayout.proc_comm() = A.layouts()->proc_comm();
-
-			m_spLocalAlgebraLayouts = CreateLocalAlgebraLayouts();
-			collectedA.set_layouts(m_spLocalAlgebraLayouts);
+			m_agglomeration.collect_matrix(A, collectedA);
+			m_bRoot = m_agglomeration.participates();
 #else
 			m_bEmpty = false;
 			m_bRoot = true;
@@ -130,21 +144,17 @@ class AgglomeratingBase : public TBase
 		void init_collected_vec(vector_type &collectedX)
 		{
 			if(i_am_root())
-			{
-				matrix_type &collectedA = m_spCollectedOp->get_matrix();
-				collectedX.resize(collectedA.num_rows());
-				collectedX.set_layouts(m_spLocalAlgebraLayouts);
-			}
+				m_agglomeration.init_collected_vector(collectedX);
 		}
 
 		void gather_vector_on_one(vector_type &collectedB, const vector_type &b, ParallelStorageType type)
 		{
-			GatherVectorOnOne(agglomerationLayout, collectedB, b, PST_ADDITIVE);
+			m_agglomeration.gather_vector(collectedB, b);
 		}
 
 		void broadcast_vector_from_one(vector_type &x, const vector_type &collectedX, ParallelStorageType type)
 		{
-			BroadcastVectorFromOne(agglomerationLayout, x, collectedX, PST_CONSISTENT);
+			m_agglomeration.broadcast_vector(x, collectedX);
 		}
 #endif
 
@@ -191,7 +201,8 @@ class AgglomeratingBase : public TBase
 				bSuccess = init_agglomerated(m_spCollectedOp);
 				//UG_DLOG(LIB_ALG_LINEAR_SOLVER, 1,
 				if(collectedX.size() != m_pMatrix->num_rows()) {
-					UG_LOG("Agglomerated on proc 0. Size is " << collectedX.size() << "(was on this proc: "
+					UG_LOG("Agglomerated on " << m_agglomeration.num_target_procs()
+						<< " proc(s). Size is " << collectedX.size() << "(was on this proc: "
 						<< m_pMatrix->num_rows() << ")\n");
 				}
 			}
@@ -291,9 +302,8 @@ class AgglomeratingBase : public TBase
 		matrix_type* m_pMatrix;
 #ifdef UG_PARALLEL
 		vector_type collectedB, collectedX;
-		HorizontalAlgebraLayouts agglomerationLayout;
+		HierarchicalAgglomeration<algebra_type> m_agglomeration;
 		SmartPtr<MatrixOperator<matrix_type, vector_type> > m_spCollectedOp;
-		SmartPtr<AlgebraLayouts> m_spLocalAlgebraLayouts;
 #endif
 
 		bool m_bRoot;
@@ -42,6 +42,8 @@
 
 // extern headers
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 #include <sstream>  // added for 'stringstream'
 
 // own header
@@ -68,6 +70,68 @@
 
 namespace ug{
 
+////////////////////////////////////////////////////////////////////////
+//	FetiTimings implementation
+const char* FetiTimings::name(Phase phase)
+{
+	switch(phase)
+	{
+		case INIT_LAYOUTS:		return "init: layouts";
+		case INIT_DIRICHLET:	return "init: Dirichlet factorization";
+		case INIT_NEUMANN:		return "init: Neumann factorization";
+		case INIT_PRIMAL:		return "init: assemble S_PiPi";
+		case INIT_COARSE:		return "init: coarse problem";
+		case APPLY_DIRICHLET:	return "apply: Dirichlet solves";
+		case APPLY_NEUMANN:		return "apply: Neumann solves";
+		case APPLY_COARSE:		return "apply: coarse problem";
+		case APPLY_TOTAL:		return "apply: total";
+		default:				return "unknown";
+	}
+}
+
+void FetiTimings::print() const
+{
+	pcl::ProcessCommunicator commWorld;
+	double tMin[NUM_PHASES], tMax[NUM_PHASES], tSum[NUM_PHASES];
+	commWorld.allreduce(m_time, tMin, NUM_PHASES, PCL_RO_MIN);
+	commWorld.allreduce(m_time, tMax, NUM_PHASES, PCL_RO_MAX);
+	commWorld.allreduce(m_time, tSum, NUM_PHASES, PCL_RO_SUM);
+
+	UG_LOG("FETI phase timings (" << commWorld.size() << " procs, in s):\n");
+	UG_LOG(std::setw(32) << "phase" << std::setw(8) << "calls" << std::setw(12) << "min"
+	       << std::setw(12) << "avg" << std::setw(12) << "max" << std::setw(10) << "max/avg" << "\n");
+	for(int i = 0; i < NUM_PHASES; ++i)
+	{
+		const double avg = tSum[i] / commWorld.size();
+		UG_LOG(std::setw(32) << name((Phase)i) << std::setw(8) << m_cnt[i]
+		       << std::setw(12) << tMin[i] << std::setw(12) << avg << std::setw(12) << tMax[i]
+		       << std::setw(10) << (avg > 0 ? tMax[i] / avg : 1.0) << "\n");
+	}
+}
+
+///	returns a hash of the pattern and the entries of a matrix
+template <typename TMatrix>
+static size_t MatrixFingerprint(const TMatrix& A)
+{
+	uint64_t hash = 14695981039346656037ULL; // FNV-1a
+	const uint64_t prime = 1099511628211ULL;
+	hash = (hash ^ A.num_rows()) * prime;
+	for(size_t r = 0; r < A.num_rows(); ++r)
+		for(typename TMatrix::const_row_iterator it = A.begin_row(r); it != A.end_row(r); ++it)
+		{
+			hash = (hash ^ it.index()) * prime;
+			const typename TMatrix::value_type& block = it.value();
+			for(size_t i = 0; i < (size_t)GetRows(block); ++i)
+				for(size_t j = 0; j < (size_t)GetCols(block); ++j)
+				{
+					double val = BlockRef(block, i, j);
+					uint64_t bits; memcpy(&bits, &val, sizeof(bits));
+					hash = (hash ^ bits) * prime;
+				}
+		}
+	return (size_t) hash;
+}
+
 
 //	used to inform root over primal connections.
 template <class TValue>
@@ -100,7 +164,8 @@ LocalSchurComplement() :
 	m_pFetiLayouts(NULL),
 	m_spDirichletOperator(new MatrixOperator<matrix_type, vector_type>),
 	m_pDirichletMatrix(NULL),
-	m_spDirichletSolver(NULL)
+	m_spDirichletSolver(NULL),
+	m_pTimings(NULL)
 {
 }
 
@@ -136,9 +201,12 @@ init()
 
 //	init sequential solver for Dirichlet problem
 	if(m_spDirichletSolver.valid())
+	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::INIT_DIRICHLET);
 		if(!m_spDirichletSolver->init(m_spDirichletOperator))
 			UG_THROW("LocalSchurComplement::init: Cannot init "
 					"Sequential Dirichlet Solver for Operator A.");
+	}
 
 //	Debug output of matrices
 	write_debug(m_spDirichletOperator->get_matrix(), "FetiDirichletMatrix.mat");
@@ -213,7 +281,12 @@ apply(vector_type& f, const vector_type& u)
 
 	// (b) invoke Dirichlet solver
 	//	uTmp is consistent afterwards
-	if(!m_spDirichletSolver->apply_return_defect(uTmp, f))
+	bool bDirichletSolved;
+	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::APPLY_DIRICHLET);
+		bDirichletSolved = m_spDirichletSolver->apply_return_defect(uTmp, f);
+	}
+	if(!bDirichletSolved)
 	{
 		UG_LOG_ALL_PROCS("ERROR in 'LocalSchurComplement::apply': "
 						 "Could not solve Dirichlet problem (step 3.b) on Proc "
@@ -376,7 +449,9 @@ PrimalSubassembledMatrixInverse() :
 	m_spRootSchurComplementOp(new MatrixOperator<matrix_type, vector_type>),
 	m_pRootSchurComplementMatrix(NULL),
 	m_statType(""),
-	m_bTestOneToManyLayouts(false)
+	m_bTestOneToManyLayouts(false),
+	m_pTimings(NULL),
+	m_primalBatchSize(16)
 {
 }
 
@@ -441,12 +516,15 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 
 //	init sequential solver for Dirichlet problem
 	if(m_spNeumannSolver.valid())
+	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::INIT_NEUMANN);
 		if(!m_spNeumannSolver->init(m_spNeumannOperator))
 		{
 			UG_LOG("ERROR in 'PrimalSubassembledMatrixInverse::init': Cannot init "
 					"Sequential Neumann Solver for Operator A.\n");
 			return false;
 		}
+	}
 	UG_LOG("done.\n");
 
 //	Debug output of matrices
@@ -593,10 +671,24 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 	m_pFetiLayouts->vec_use_intra_sd_communication(h1);
 	m_pFetiLayouts->vec_use_intra_sd_communication(h2);
 
+//	create help vectors for the batches of unity vectors
+	const size_t batchSize = std::max(m_primalBatchSize, (size_t)1);
+	std::vector<vector_type> vE(batchSize), vH1(batchSize), vH2(batchSize);
+	for(size_t k = 0; k < batchSize; ++k)
+	{
+		vE[k].resize(m_pMatrix->num_rows());
+		vH1[k].resize(m_pMatrix->num_rows());
+		vH2[k].resize(m_pMatrix->num_rows());
+		m_pFetiLayouts->vec_use_intra_sd_communication(vE[k]);
+		m_pFetiLayouts->vec_use_intra_sd_communication(vH1[k]);
+		m_pFetiLayouts->vec_use_intra_sd_communication(vH2[k]);
+	}
+
 	UG_LOG("     %\n");
 	UG_LOG("     %  - assemble entries of 'S_PiPi' (format: '[<proc rank>]: (<from_i> -> <to_j>)') ... \n");
 
 	FETI_PROFILE_BEGIN(PrimalSubassMatInvInit_Assemble_S_PiPi);
+	const double tStartAssemble = get_clock_s();
 //	Now within each feti subdomain, the primal unknowns are looped one after the
 //	other. This is done like the following: Each process loops the number of
 //	procs of the feti subdomain it belongs, and then over their primal unknowns
@@ -616,65 +708,61 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 	{
 		UG_LOG("     %  - [proc " << std::setw(6) << intraFetiSubdomComm.get_proc_id(procInFetiSD) << "]: ");
 
-		// loop over feti subdomain primals (\Pi variables) of current proc in loop
-		for(size_t pvTo_j = 0; pvTo_j < (size_t)vNumPrimalVariablesPerProc[procInFetiSD]; ++pvTo_j)
+		const size_t numPrimalsOfProc = (size_t)vNumPrimalVariablesPerProc[procInFetiSD];
+
+		// loop over feti subdomain primals (\Pi variables) of current proc in
+		// batches, the Neumann problems of a batch are solved at once
+		for(size_t batchBegin = 0; batchBegin < numPrimalsOfProc; batchBegin += batchSize)
 		{
+			const size_t batchEnd = std::min(batchBegin + batchSize, numPrimalsOfProc);
+			const size_t numRHS = batchEnd - batchBegin;
+
 		////////////////////////////////////////
-		// 	1. Create (column) unity vector e_j:
+		// 	1. Create (column) unity vectors e_j:
 		////////////////////////////////////////
-
-		//	keep the matrix id on root, of the primal unknown, that is set to one
-			int unityRootID = vSubdomPrimalRootID[primalCounter++];
-
-		//	reset identity vector to zero for all (primal) unknowns
-			e.set(0.0);
-
-			ss.str(""); // clear stringstream before next loop
-
-		//	set value of unity vector to one if on process and quantity, else 0
-			if(pcl::ProcRank() == intraFetiSubdomComm.get_proc_id(procInFetiSD))
+			for(size_t pvTo_j = batchBegin; pvTo_j < batchEnd; ++pvTo_j)
 			{
-				const IndexLayout::Element localPrimalIndex = vLocalPrimalLocalID[pvTo_j];
-
-				e[localPrimalIndex] = 1.0;
-				ss << std::setw(3) << vPrimalRootIDLUT[localPrimalIndex]; // store for later output
-			} else {
-				ss << "no connection to pvTo_j " << pvTo_j;
-				//continue; // as long as null space of A_{\{I, \Delta\} \Pi} is empty
+				vector_type& e_j = vE[pvTo_j - batchBegin];
+
+			//	reset identity vector to zero for all (primal) unknowns
+				e_j.set(0.0);
+
+			//	set value of unity vector to one if on process and quantity, else 0
+				if(pcl::ProcRank() == intraFetiSubdomComm.get_proc_id(procInFetiSD))
+					e_j[vLocalPrimalLocalID[pvTo_j]] = 1.0;
+
+			////////////////////////////////////////////////////////////////////////
+			// 	2. Apply first matrix A_{\{I, \Delta\} \Pi} to unity vector e^{(p)}:
+			////////////////////////////////////////////////////////////////////////
+			//	build h1 = A_{\{I \Delta\} \Pi} e
+				vector_type& h1_j = vH1[pvTo_j - batchBegin];
+				m_spOperator->apply(h1_j, e_j);
+
+			//	(a1) Set zero dirichlet bnd conds for rhs h1 on_\Pi
+				m_pFetiLayouts->vec_set_on_primal(h1_j, 0.0);
+				m_pFetiLayouts->vec_use_intra_sd_communication(h1_j);
+				h1_j.set_storage_type(PST_ADDITIVE);
+
+			//	(a2) Start with zero iterate (not obligatory)
+				vector_type& h2_j = vH2[pvTo_j - batchBegin];
+				h2_j.set(0.0);
+				m_pFetiLayouts->vec_use_intra_sd_communication(h2_j);
+				h2_j.set_storage_type(PST_CONSISTENT);
 			}
 
-		////////////////////////////////////////////////////////////////////////
-		// 	2. Apply first matrix A_{\{I, \Delta\} \Pi} to unity vector e^{(p)}:
-		////////////////////////////////////////////////////////////////////////
-		//	build h1 = A_{\{I \Delta\} \Pi} e
-			m_spOperator->apply(h1, e);
-
 		///////////////////////////////////////////////////////////////////
 		//	3. Apply A_{\{I \Delta\}\{I\Delta\}}^{-1} by solving "I,\Delta"
-		//	   subsystem problem:
+		//	   subsystem problems:
 		///////////////////////////////////////////////////////////////////
 		//	Solve: A_{\{I \Delta\}  \{I \Delta\} } h2 = h1
-
-		//	(a1) Set zero dirichlet bnd conds for rhs h1 on_\Pi
-			m_pFetiLayouts->vec_set_on_primal(h1, 0.0);
-
-		//	(a2) Start with zero iterate (not obligatory)
-			h2.set(0.0);
-
-		//	(b) Solve dirichlet problem. (Dirichlet rows in A for \Pi dof's are
-		//	    already set in 'SchurComplementInverse::init()'!)
-			m_pFetiLayouts->vec_use_intra_sd_communication(h1);
-			h1.set_storage_type(PST_ADDITIVE);
-			m_pFetiLayouts->vec_use_intra_sd_communication(h2);
-			h2.set_storage_type(PST_CONSISTENT);
-
+		//	(Dirichlet rows in A for \Pi dof's are already set above)
 			FETI_PROFILE_BEGIN(PSMIInit_NeumannSolve_SC);
-			if(!m_spNeumannSolver->apply(h2, h1))
+			if(!solve_neumann_batch(vH2, vH1, numRHS))
 			{
 				UG_LOG_ALL_PROCS("ERROR in 'PrimalSubassembledMatrixInverse::init':"
 						" Could not solve local Neumann problem (inversion of A_I Delta,I Delta)"
 						" to compute Schur complement w.r.t. primal unknowns: "
-								 << procInFetiSD << ", " << pvTo_j << ".\n"); // TODO: info about current repetition of loop? (28102011ih)
+								 << procInFetiSD << ", " << batchBegin << ".\n");
 
 				UG_LOG_ALL_PROCS("ERROR in 'PrimalSubassembledMatrixInverse::init':"
 								" Last defect was " << m_spNeumannSolver->defect() <<
@@ -684,72 +772,73 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 			}
 			FETI_PROFILE_END(PSMIInit_NeumannSolve_SC);
 
-		//	remember for statistic
-			StepConv stepConv;
-			if(!m_statType.empty())
+			for(size_t pvTo_j = batchBegin; pvTo_j < batchEnd; ++pvTo_j)
 			{
-				stepConv.lastDefSC = m_spNeumannSolver->defect();
-				stepConv.numIterSC = m_spNeumannSolver->step();
+			//	keep the matrix id on root, of the primal unknown, that is set to one
+				int unityRootID = vSubdomPrimalRootID[primalCounter++];
 
-				m_mvStepConv[m_statType].push_back(stepConv);
-			}
+				ss.str(""); // clear stringstream before next loop
+				if(pcl::ProcRank() == intraFetiSubdomComm.get_proc_id(procInFetiSD))
+					ss << std::setw(3) << vPrimalRootIDLUT[vLocalPrimalLocalID[pvTo_j]]; // store for later output
+				else
+					ss << "no connection to pvTo_j " << pvTo_j;
 
-		//////////////////////////
-		// 	4. Apply third matrix A_{\Pi \{I, \Delta\}}$ to $h_2^{(p)}
-		//////////////////////////
+			//////////////////////////
+			// 	4. Apply third matrix A_{\Pi \{I, \Delta\}}$ to $h_2^{(p)}
+			//////////////////////////
 
-		//	(a) Set h2 zero on \Pi. This is enforced by neumann solver
+			//	(a) Set h2 zero on \Pi. This is enforced by neumann solver
 
-		//	(b) Apply third matrix: h1 = A h2
-			m_spOperator->apply(h1, h2);
+			//	(b) Apply third matrix: h1 = A h2
+				m_spOperator->apply(h1, vH2[pvTo_j - batchBegin]);
 
-		//	(c) Set entries to zero on I, \Delta (not needed, therefore skipped)
+			//	(c) Set entries to zero on I, \Delta (not needed, therefore skipped)
 
-		///////////////////////////
-		// 	5. Compute first term, application of A_{\Pi \Pi} on unity vector
-		///////////////////////////
+			///////////////////////////
+			// 	5. Compute first term, application of A_{\Pi \Pi} on unity vector
+			///////////////////////////
 
-		//	(a) multiply unity vector with matrix h2 = A e
-			m_spOperator->apply(h2, e);
+			//	(a) multiply unity vector with matrix h2 = A e
+				m_spOperator->apply(h2, vE[pvTo_j - batchBegin]);
 
-		//	(b) Set entries to zero on I, \Delta (not needed, therefore skipped)
+			//	(b) Set entries to zero on I, \Delta (not needed, therefore skipped)
 
-		///////////////////////////
-		// 	6. Add parts to get result
-		///////////////////////////
+			///////////////////////////
+			// 	6. Add parts to get result
+			///////////////////////////
 
-		//	e = h2 - h1
-			m_pFetiLayouts->vec_scale_add_on_primal(e, 1.0, h2, -1.0, h1);
+			//	e = h2 - h1
+				m_pFetiLayouts->vec_scale_add_on_primal(e, 1.0, h2, -1.0, h1);
 
 
-		// 	at this point, we have the contribution of S_ij^{p} in all primal
-		//	unknowns i. Thus, we have to read it and send it to the root process
+			// 	at this point, we have the contribution of S_ij^{p} in all primal
+			//	unknowns i. Thus, we have to read it and send it to the root process
 
-		//	loop process local primal unknowns
-			for(size_t pvFrom_i = 0; pvFrom_i < vLocalPrimalLocalID.size(); ++pvFrom_i)
-			{
-				const IndexLayout::Element localPrimalIndex = vLocalPrimalLocalID[pvFrom_i];
+			//	loop process local primal unknowns
+				for(size_t pvFrom_i = 0; pvFrom_i < vLocalPrimalLocalID.size(); ++pvFrom_i)
+				{
+					const IndexLayout::Element localPrimalIndex = vLocalPrimalLocalID[pvFrom_i];
 
-				UG_LOG("(" << std::setw(3) << vPrimalRootIDLUT[localPrimalIndex] <<
-					   " -> " << ss.str() << ") ");
+					UG_LOG("(" << std::setw(3) << vPrimalRootIDLUT[localPrimalIndex] <<
+						   " -> " << ss.str() << ") ");
 
-			//	read coupling
-				typename vector_type::value_type& entry = e[localPrimalIndex];
+				//	read coupling
+					typename vector_type::value_type& entry = e[localPrimalIndex];
 
-			//	read root index
-				int primalRootID = vPrimalRootIDLUT[localPrimalIndex];
+				//	read root index
+					int primalRootID = vPrimalRootIDLUT[localPrimalIndex];
 
-			//  remember coupling
-				vLocalPrimalConnections.push_back(PrimalConnection(primalRootID,
-				                                                  unityRootID, entry));
+				//  remember coupling
+					vLocalPrimalConnections.push_back(PrimalConnection(primalRootID,
+					                                                  unityRootID, entry));
+				}
+				if ((numPrimalsOfProc !=0) && vLocalPrimalLocalID.size() != 0)
+					UG_LOG(((pvTo_j < numPrimalsOfProc-1) ?
+							"\n     %                   " : "\n"));
 			}
-			if (((size_t)vNumPrimalVariablesPerProc[procInFetiSD] !=0) && vLocalPrimalLocalID.size() != 0)
-				UG_LOG(((pvTo_j < (size_t)vNumPrimalVariablesPerProc[procInFetiSD]-1) ?
-						"\n     %                   " : "\n"));
-
-		} // end loop over feti subdomain primals 'pvTo_j' of current proc
-		if (((size_t)vNumPrimalVariablesPerProc[procInFetiSD] == 0) || vLocalPrimalLocalID.size() == 0)
-			UG_LOG((((size_t)vNumPrimalVariablesPerProc[procInFetiSD] != 0) && (vLocalPrimalLocalID.size() != 0) ? "     %+\n" : "\n"));
+		} // end loop over batches of feti subdomain primals of current proc
+		if ((numPrimalsOfProc == 0) || vLocalPrimalLocalID.size() == 0)
+			UG_LOG("\n");
 	} // end loop over procs in feti subdomain
 
 	UG_LOG("     %  - done.\n");
@@ -771,11 +860,13 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 	std::vector<PrimalConnection> vPrimalConnections;//	only filled on root
 	pcl::ProcessCommunicator commWorld;
 	commWorld.gatherv(vPrimalConnections, vLocalPrimalConnections, m_primalRootProc);
+	if(m_pTimings) m_pTimings->add(FetiTimings::INIT_PRIMAL, get_clock_s() - tStartAssemble);
 	FETI_PROFILE_END(PrimalSubassMatInvInit_Assemble_S_PiPi);
 
 //	build matrix on primalRoot
 	if(pcl::ProcRank() == m_primalRootProc)
 	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::INIT_COARSE);
 		UG_LOG("     %  - On primal root proc: building Schur complement matrix on primal root proc.\n");
 
 	//	get matrix
@@ -901,6 +992,36 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 }
 /* end 'PrimalSubassembledMatrixInverse::init()' */
 
+template <typename TAlgebra>
+bool PrimalSubassembledMatrixInverse<TAlgebra>::
+solve_neumann_batch(std::vector<vector_type>& vX, std::vector<vector_type>& vB,
+                    size_t numRHS)
+{
+	SmartPtr<LU<TAlgebra> > spLU = m_spNeumannSolver.template cast_dynamic<LU<TAlgebra> >();
+	if(spLU.valid())
+	{
+		if(!spLU->apply_multi(vX, vB, numRHS))
+			return false;
+	}
+	else
+	{
+		for(size_t k = 0; k < numRHS; ++k)
+			if(!m_spNeumannSolver->apply(vX[k], vB[k]))
+				return false;
+	}
+
+//	remember for statistic
+	if(!m_statType.empty())
+	{
+		StepConv stepConv;
+		stepConv.lastDefSC = m_spNeumannSolver->defect();
+		stepConv.numIterSC = m_spNeumannSolver->step();
+		for(size_t k = 0; k < numRHS; ++k)
+			m_mvStepConv[m_statType].push_back(stepConv);
+	}
+	return true;
+}
+
 template <typename TAlgebra>
 bool PrimalSubassembledMatrixInverse<TAlgebra>::
 apply_return_defect(vector_type& u, vector_type& f)
@@ -968,7 +1089,12 @@ apply_return_defect(vector_type& u, vector_type& f)
 
 	// (a) invoke Neumann solver to get \f$u_{\{I \Delta\}}^{(p)}\f$
 	FETI_PROFILE_BEGIN(PSMIApply_NeumannSolve_2a);
-	if(!m_spNeumannSolver->apply_return_defect(u, h))
+	bool bNeumannSolved;
+	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::APPLY_NEUMANN);
+		bNeumannSolved = m_spNeumannSolver->apply_return_defect(u, h);
+	}
+	if(!bNeumannSolved)
 	{
 		UG_LOG_ALL_PROCS("ERROR in 'PrimalSubassembledMatrixInverse::apply': "
 						 "Could not solve Neumann problem (step 2.a) on Proc "
@@ -1020,6 +1146,7 @@ apply_return_defect(vector_type& u, vector_type& f)
 //     where it is then consistent.
 	rootF.set(0.0);
 	//pcl::SynchronizeProcesses();			// TMP
+	const double tStartCoarse = get_clock_s();
 	FETI_PROFILE_BEGIN(PSMIApply_VecGather);
 	VecGather(&rootF, &h, m_masterAllToOneLayout, m_slaveAllToOneLayout);
 	FETI_PROFILE_END(PSMIApply_VecGather);
@@ -1058,6 +1185,7 @@ apply_return_defect(vector_type& u, vector_type& f)
 //	5. Broadcast \f$u_{\Pi}\f$ to all Procs. \f$u_{\Pi}\f$ is consistently saved.
 	u.set(0.0);
 	VecBroadcast(&u, &rootU, m_slaveAllToOneLayout, m_masterAllToOneLayout);
+	if(m_pTimings) m_pTimings->add(FetiTimings::APPLY_COARSE, get_clock_s() - tStartCoarse);
 
 //	6.  create help vectors
 	vector_type t;  t.create(u.size());
@@ -1090,7 +1218,11 @@ apply_return_defect(vector_type& u, vector_type& f)
 	uTmp2.set_storage_type(PST_CONSISTENT);
 
 	FETI_PROFILE_BEGIN(PSMIApply_NeumannSolve_7);
-	if(!m_spNeumannSolver->apply_return_defect(uTmp2, t)) // solve with Neumann matrix!
+	{
+		FetiTimings::ScopedTimer timer(m_pTimings, FetiTimings::APPLY_NEUMANN);
+		bNeumannSolved = m_spNeumannSolver->apply_return_defect(uTmp2, t); // solve with Neumann matrix!
+	}
+	if(!bNeumannSolved)
 	{
 		UG_LOG_ALL_PROCS("ERROR in 'PrimalSubassembledMatrixInverse::apply': "
 						 "Could not solve Neumann problem (step 7) on Proc "
@@ -1364,9 +1496,13 @@ FETISolver() :
 	m_spOperator(NULL),
 	m_pMatrix(NULL),
 	m_spDirichletSolver(NULL),
-	m_spNeumannSolver(NULL)
+	m_spNeumannSolver(NULL),
+	m_bReuseFactorizations(false),
+	m_bFactorizationsValid(false),
+	m_matrixFingerprint(0)
 {
-
+	m_LocalSchurComplement.set_timings(&m_timings);
+	m_PrimalSubassembledMatrixInverse.set_timings(&m_timings);
 }
 
 template <typename TAlgebra>
@@ -1392,15 +1528,37 @@ init(SmartPtr<MatrixOperator<matrix_type, vector_type> > A)
 		return false;
 	}
 
+//	keep factorizations if the matrix is unchanged on all procs
+	if(m_bReuseFactorizations)
+	{
+		const size_t fingerprint = MatrixFingerprint(*m_pMatrix);
+		const bool bUnchanged = m_bFactorizationsValid
+								&& fingerprint == m_matrixFingerprint
+								&& m_pMatrix->layouts() == m_spFactorizedLayouts;
+		if(pcl::AllProcsTrue(bUnchanged))
+		{
+			UG_LOG("%   - Matrix unchanged, reusing local factorizations.\n");
+			m_LocalSchurComplement.reuse_init(m_spOperator);
+			m_PrimalSubassembledMatrixInverse.reuse_init(m_spOperator);
+			return true;
+		}
+		m_matrixFingerprint = fingerprint;
+		m_spFactorizedLayouts = m_pMatrix->layouts();
+	}
+	m_bFactorizationsValid = false;
+
 	bool debugLayouts = (debug_writer()==SPNULL) ? false : true;
 
 //	1. create FETI Layouts
 	UG_LOG("\n%   - Create FETI layouts ... ");
 	FETI_PROFILE_BEGIN(FETISolverInit_Create_Layouts);
-	m_fetiLayouts.create_layouts(m_pMatrix->layouts(),
-	                             m_pMatrix->num_rows(),
-	                             *m_pDDInfo,
-	                             debugLayouts);
+	{
+		FetiTimings::ScopedTimer timer(&m_timings, FetiTimings::INIT_LAYOUTS);
+		m_fetiLayouts.create_layouts(m_pMatrix->layouts(),
+		                             m_pMatrix->num_rows(),
+		                             *m_pDDInfo,
+		                             debugLayouts);
+	}
 	FETI_PROFILE_END(FETISolverInit_Create_Layouts);
 	UG_LOG("done.\n");
 
@@ -1489,6 +1647,8 @@ init(SmartPtr<MatrixOperator<matrix_type, vector_type> > A)
 	}
 	FETI_PROFILE_END(FETISolverInit_InitPrimalSubassMatInv);
 
+	m_bFactorizationsValid = m_bReuseFactorizations;
+
 //	status
 	UG_LOG("\n% 'FETISolver::init()' done!\n");
 
@@ -1502,6 +1662,7 @@ apply_return_defect(vector_type& u, vector_type& f)
 {
 //	status
 	UG_LOG("\n% 'FETISolver::apply()':\n");
+	FetiTimings::ScopedTimer timer(&m_timings, FetiTimings::APPLY_TOTAL);
 //	FETI_PROFILE_FUNC(); // should report same times as in section 'applyLinearSolver' (see 'operator_util.h')
 //	FETI_PROFILE_BEGIN(FETISolverApplyReturnDefect); // profiling complete method
 //	This function is used to solve the system Au=f. While the matrix A has
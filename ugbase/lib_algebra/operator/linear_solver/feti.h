@@ -50,6 +50,8 @@
 #include "lib_algebra/operator/interface/matrix_operator_inverse.h"
 #include "lib_algebra/parallelization/parallelization.h"
 #include "lib_algebra/operator/debug_writer.h"
+#include "lib_algebra/operator/linear_solver/lu.h"
+#include "common/stopwatch.h"
 #include "pcl/pcl.h"
 
 /* 
@@ -445,6 +447,76 @@ class FetiLayouts
 
 }; /* end class 'FetiLayouts' */
 
+/// Accumulated wall clock times of the phases of the FETI solver
+/**
+ * The times are accumulated over all calls of init and apply on the current
+ * process until 'clear()' is called. 'print()' reports minimum, average and
+ * maximum over all processes, so that the phase limiting the scalability
+ * (load imbalance in the local solves, size of the coarse problem, ...) can
+ * be identified.
+ */
+class FetiTimings
+{
+	public:
+		enum Phase
+		{
+			INIT_LAYOUTS = 0,
+			INIT_DIRICHLET,		///< factorization of the local Dirichlet problems
+			INIT_NEUMANN,		///< factorization of the local Neumann problems
+			INIT_PRIMAL,		///< assembly of S_{Pi Pi} by local Neumann solves
+			INIT_COARSE,		///< gathering and factorization of the coarse problem
+			APPLY_DIRICHLET,	///< local Dirichlet solves in the local Schur complement
+			APPLY_NEUMANN,		///< local Neumann solves in the primal inverse
+			APPLY_COARSE,		///< gathering and solving of the coarse problem
+			APPLY_TOTAL,		///< complete solve of the dual system
+			NUM_PHASES
+		};
+
+	///	helper accumulating the time of its lifetime to a phase
+		class ScopedTimer
+		{
+			public:
+				ScopedTimer(FetiTimings* pTimings, Phase phase)
+					: m_pTimings(pTimings), m_phase(phase), m_start(get_clock_s()) {}
+				~ScopedTimer()
+				{
+					if(m_pTimings) m_pTimings->add(m_phase, get_clock_s() - m_start);
+				}
+			private:
+				FetiTimings* m_pTimings;
+				Phase m_phase;
+				double m_start;
+		};
+
+	public:
+		FetiTimings() {clear();}
+
+	///	resets all counters
+		void clear()
+		{
+			for(int i = 0; i < NUM_PHASES; ++i) {m_time[i] = 0.0; m_cnt[i] = 0;}
+		}
+
+	///	adds a time (in seconds) to a phase
+		void add(Phase phase, double seconds) {m_time[phase] += seconds; ++m_cnt[phase];}
+
+	///	returns accumulated time (in seconds) of a phase on this process
+		double time(Phase phase) const {return m_time[phase];}
+
+	///	returns the number of timed calls of a phase on this process
+		size_t count(Phase phase) const {return m_cnt[phase];}
+
+	///	returns the name of a phase
+		static const char* name(Phase phase);
+
+	///	prints min / avg / max over all processes (collective)
+		void print() const;
+
+	private:
+		double m_time[NUM_PHASES];
+		size_t m_cnt[NUM_PHASES];
+};
+
 ///	Application of the "jump operator" \f$B_{\Delta}\f$
 /**
  * This function applies \f$B_{\Delta}\f$ to \f$u_{\Delta}\f$. It computes the
@@ -606,6 +678,16 @@ class LocalSchurComplement
 			m_pFetiLayouts = &fetiLayouts;
 		}
 
+	///	sets the timing counters (may be NULL)
+		void set_timings(FetiTimings* pTimings) {m_pTimings = pTimings;}
+
+	///	replaces the operator by one with identical entries, keeping the factorization
+		void reuse_init(SmartPtr<MatrixOperator<matrix_type, vector_type> > A)
+		{
+			m_spOperator = A;
+			m_pMatrix = &m_spOperator->get_matrix();
+		}
+
 	/// implementation of the operator for the solution dependent initialization.
 		void init(const vector_type& u) {init();}
 
@@ -672,6 +754,9 @@ class LocalSchurComplement
 
 		int m_totalIterCntOfInnerSolvers;
 
+	//	timing counters
+		FetiTimings* m_pTimings;
+
 }; /* end class 'LocalSchurComplement' */
 
 /* 1.7 Application of \f${\tilde{S}_{\Delta \Delta}}^{-1}\f$ */ 
@@ -742,6 +827,19 @@ class PrimalSubassembledMatrixInverse
 			m_pFetiLayouts = &fetiLayouts;
 		}
 
+	///	sets the timing counters (may be NULL)
+		void set_timings(FetiTimings* pTimings) {m_pTimings = pTimings;}
+
+	///	sets the number of unit vectors solved for at once when assembling S_{Pi Pi}
+		void set_primal_batch_size(size_t batchSize) {m_primalBatchSize = batchSize;}
+
+	///	replaces the operator by one with identical entries, keeping the factorizations
+		void reuse_init(SmartPtr<MatrixOperator<matrix_type, vector_type> > A)
+		{
+			m_spOperator = A;
+			m_pMatrix = &m_spOperator->get_matrix();
+		}
+
 	// 	Init for Linear Operator L
 		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L);
 
@@ -775,6 +873,16 @@ class PrimalSubassembledMatrixInverse
 	//  destructor
 		virtual ~PrimalSubassembledMatrixInverse() {};
 
+	protected:
+	///	solves the Neumann problem for the first 'numRHS' right hand sides
+	/**
+	 * If the Neumann solver is a LU solver, all right hand sides are solved
+	 * with one sweep over the factorization. Otherwise they are solved one
+	 * after the other.
+	 */
+		bool solve_neumann_batch(std::vector<vector_type>& vX,
+		                         std::vector<vector_type>& vB, size_t numRHS);
+
 	protected:
 	// 	Operator that is inverted by this Inverse Operator ==> from which SC is built (05022011)
 		SmartPtr<MatrixOperator<matrix_type,vector_type> > m_spOperator;
@@ -831,6 +939,12 @@ class PrimalSubassembledMatrixInverse
 
 		int m_totalIterCntOfInnerSolvers;
 
+	//	timing counters
+		FetiTimings* m_pTimings;
+
+	//	number of unit vectors solved for at once in the assembly of S_{Pi Pi}
+		size_t m_primalBatchSize;
+
 }; /* end class 'PrimalSubassembledMatrixInverse' */
 
 /// operator implementation of the FETI-DP solver
@@ -889,6 +1003,7 @@ class FETISolver : public IMatrixOperatorInverse<	typename TAlgebra::matrix_type
 		{
 		//	remember the Dirichlet Solver
 			m_spDirichletSolver = dirichletSolver;
+			m_bFactorizationsValid = false;
 		}
 
 	///	sets the Neumann solver
@@ -896,6 +1011,7 @@ class FETISolver : public IMatrixOperatorInverse<	typename TAlgebra::matrix_type
 		{
 		//	remember the Dirichlet Solver
 			m_spNeumannSolver = neumannSolver;
+			m_bFactorizationsValid = false;
 		}
 
 	///	sets the coarse problem solver
@@ -903,6 +1019,7 @@ class FETISolver : public IMatrixOperatorInverse<	typename TAlgebra::matrix_type
 		{
 		//	remember the coarse problem Solver
 			m_spCoarseProblemSolver = coarseProblemSolver;
+			m_bFactorizationsValid = false;
 		}
 
 	//	set debug output
@@ -974,6 +1091,30 @@ class FETISolver : public IMatrixOperatorInverse<	typename TAlgebra::matrix_type
 			m_PrimalSubassembledMatrixInverse.set_test_one_to_many_layouts(bTest);
 		}
 
+	///	keep the local factorizations and S_{Pi Pi} if init is called with an unchanged matrix
+	/**
+	 * If enabled, init compares a fingerprint of the pattern and the entries
+	 * of the new matrix (and its layouts) with the one of the last init. If
+	 * it is unchanged on all processes, the factorizations of the local
+	 * Dirichlet and Neumann problems and the coarse problem are kept.
+	 */
+		void set_reuse_local_factorizations(bool bReuse) {m_bReuseFactorizations = bReuse;}
+
+	///	sets the number of unit vectors solved for at once when assembling S_{Pi Pi}
+		void set_primal_batch_size(size_t batchSize)
+		{
+			m_PrimalSubassembledMatrixInverse.set_primal_batch_size(batchSize);
+		}
+
+	///	prints accumulated times of the FETI phases (min / avg / max over procs)
+		void print_phase_timings() const {m_timings.print();}
+
+	///	resets the accumulated times of the FETI phases
+		void clear_phase_timings() {m_timings.clear();}
+
+	///	returns the accumulated times of the FETI phases on this process
+		const FetiTimings& phase_timings() const {return m_timings;}
+
 
 	///	solves the reduced system \f$F \lambda = d\f$ with preconditioned cg method
 	///	and returns the last defect of iteration in rhs
@@ -1075,6 +1216,15 @@ class FETISolver : public IMatrixOperatorInverse<	typename TAlgebra::matrix_type
 	// 	It solves \f$S_{\Pi \Pi} u_{\Pi} = \tilde{f}_{\Pi}\f$ 
 		SmartPtr<ILinearOperatorInverse<vector_type> > m_spCoarseProblemSolver;
 
+	//	reuse of factorizations for unchanged matrices
+		bool m_bReuseFactorizations;
+		bool m_bFactorizationsValid;
+		size_t m_matrixFingerprint;
+		ConstSmartPtr<AlgebraLayouts> m_spFactorizedLayouts;
+
+	//	timing counters of the FETI phases
+		FetiTimings m_timings;
+
 	public:
 		void set_domain_decomp_info(pcl::IDomainDecompositionInfo& ddInfo)
 		{
@@ -34,6 +34,7 @@
 #define __H__LIB_ALGEBRA__LAPACK_LU_OPERATOR__
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "common/common.h"
 #include "lib_algebra/operator/interface/matrix_operator_inverse.h"
@@ -354,6 +355,61 @@ class LU
 			return true;
 		}
 
+	///	Compute vU[k] = L^{-1} * vF[k] for the first numRHS vectors
+	/**
+	 * For the dense factorization all right hand sides are solved with one
+	 * sweep over the factors (LAPACK getrs with several right hand sides),
+	 * otherwise they are solved one after the other.
+	 */
+		bool apply_multi(std::vector<vector_type>& vU, const std::vector<vector_type>& vF,
+		                 size_t numRHS)
+		{
+			PROFILE_BEGIN_GROUP(LU_apply_multi, "algebra lu");
+			UG_COND_THROW(vU.size() < numRHS || vF.size() < numRHS,
+			              "LU::apply_multi: not enough vectors for " << numRHS << " right hand sides.");
+
+			if(!m_bDense || !block_traits<typename vector_type::value_type>::is_static
+					|| m_pMatrix->num_rows() == 0)
+			{
+				for(size_t k = 0; k < numRHS; ++k)
+					if(!apply(vU[k], vF[k])) return false;
+				return true;
+			}
+
+			const size_t blockSize = block_traits<typename vector_type::value_type>::static_size;
+			m_multiTmp.resize(m_size * numRHS);
+			for(size_t k = 0; k < numRHS; ++k)
+			{
+#ifdef UG_PARALLEL
+				if(!vF[k].has_storage_type(PST_ADDITIVE))
+				{
+					UG_LOG("ERROR: In 'LU::apply_multi': "
+							"Inadequate storage format of Vector f.\n");
+					return false;
+				}
+#endif
+				UG_ASSERT(vF[k].size() * blockSize == m_size, "Vector and matrix size mismatch");
+				double* pCol = &m_multiTmp[k * m_size];
+				for(size_t i = 0; i < vF[k].size(); ++i)
+					for(size_t j = 0; j < blockSize; ++j)
+						pCol[i*blockSize + j] = BlockRef(vF[k][i], j);
+			}
+
+			m_mat.apply_multi(&m_multiTmp[0], numRHS);
+
+			for(size_t k = 0; k < numRHS; ++k)
+			{
+				const double* pCol = &m_multiTmp[k * m_size];
+				for(size_t i = 0; i < vU[k].size(); ++i)
+					for(size_t j = 0; j < blockSize; ++j)
+						BlockRef(vU[k][i], j) = pCol[i*blockSize + j];
+#ifdef UG_PARALLEL
+				vU[k].set_storage_type(PST_CONSISTENT);
+#endif
+			}
+			return true;
+		}
+
 	/// Compute u = L^{-1} * f AND return defect f := f - L*u
 		virtual bool apply_return_defect(vector_type& u, vector_type& f)
 		{
@@ -397,6 +453,7 @@ class LU
 	/// inverse
 		DenseMatrixInverse<DenseMatrix<VariableArray2<double> > > m_mat;
 		DenseVector<VariableArray1<double> > m_tmp;
+		std::vector<double> m_multiTmp;
 		CPUAlgebra::vector_type m_u;
 		CPUAlgebra::vector_type m_b;
 		size_t m_size;
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__MULTI_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__MULTI_CG__
+
+#include <vector>
+#include <cmath>
+
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#include "lib_algebra/cpu_algebra/multi_vector.h"
+#include "lib_algebra/algebra_common/core_smoothers.h"
+
+namespace ug{
+
+///	identity preconditioner for SolveMultiCG
+struct MultiVectorIdentity
+{
+	template<typename TValue>
+	void apply_multi(MultiVector<TValue> &c, const MultiVector<TValue> &d) {c = d;}
+};
+
+///	symmetric Gauss-Seidel preconditioner for SolveMultiCG
+template<typename TMatrix>
+class MultiVectorSGS
+{
+	public:
+		MultiVectorSGS(const TMatrix &A) : m_A(A) {}
+
+		template<typename TValue>
+		void apply_multi(MultiVector<TValue> &c, const MultiVector<TValue> &d)
+		{
+			c.resize(d.size(), d.num_cols());
+			sgs_step(m_A, c, d, 1.0);
+		}
+
+	private:
+		const TMatrix &m_A;
+};
+
+///	the CG method for several right-hand sides at once
+/**
+ * Solves A x(:,j) = b(:,j) for all vectors j of the MultiVectors x and b
+ * with the (preconditioned) CG method. The iterations of all vectors are
+ * carried out simultaneously (every vector has its own scalars alpha and
+ * beta), so that every matrix-vector product and every preconditioner
+ * application reads the matrix only once for all vectors.
+ *
+ * The matrix is used as it is, i.e. this is a local (process-wise) solver.
+ *
+ * \param A				symmetric positive definite matrix
+ * \param x				(in) start values, (out) solutions
+ * \param b				right-hand sides
+ * \param precond		preconditioner with a method apply_multi(c, d), e.g.
+ * 						MultiVectorIdentity, MultiVectorSGS or ILU
+ * \param reduction		relative reduction of the defect norm of each vector
+ * \param minDefect		absolute defect norm of each vector
+ * \param maxIter		maximal number of iterations
+ * \return				true if all vectors converged
+ */
+template<typename TMatrix, typename TValue, typename TPrecond>
+bool SolveMultiCG(const TMatrix &A, MultiVector<TValue> &x, const MultiVector<TValue> &b,
+                  TPrecond &precond, number reduction, number minDefect, size_t maxIter)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	const size_t n = b.size(), k = b.num_cols();
+	UG_COND_THROW(x.size() != n || x.num_cols() != k || A.num_rows() != n,
+	              "SolveMultiCG: size mismatch.");
+
+	MultiVector<TValue> r(n, k), z(n, k), p(n, k), q(n, k);
+	std::vector<number> one(k, 1.0), alpha(k), beta(k);
+	std::vector<number> rz(k), rzOld(k), pq, rr;
+
+//	r = b - A x
+	MatMultAdd(r, 1.0, b, -1.0, A, x);
+
+	VecProd(rr, r, r);
+	std::vector<number> defect0(k), goal(k);
+	for(size_t j=0; j<k; j++)
+	{
+		defect0[j] = std::sqrt(rr[j]);
+		goal[j] = std::max(reduction * defect0[j], minDefect);
+	}
+
+	precond.apply_multi(z, r);
+	p = z;
+	VecProd(rz, r, z);
+
+	for(size_t iter=0; ; iter++)
+	{
+	//	check convergence of all vectors
+		size_t numConverged = 0;
+		for(size_t j=0; j<k; j++)
+			if(std::sqrt(rr[j]) <= goal[j]) numConverged++;
+		UG_DLOG(LIB_ALG_LINEAR_SOLVER, 2, "SolveMultiCG: iteration " << iter << ", "
+				<< numConverged << " of " << k << " vectors converged.\n");
+		if(numConverged == k) return true;
+		if(iter == maxIter) return false;
+
+	//	q = A p
+		MatMult(q, 1.0, A, p);
+		VecProd(pq, p, q);
+
+	//	converged vectors are not updated any more
+		for(size_t j=0; j<k; j++)
+			alpha[j] = (std::sqrt(rr[j]) <= goal[j] || pq[j] == 0.0) ? 0.0 : rz[j] / pq[j];
+
+	//	x = x + alpha p, r = r - alpha q
+		VecScaleAdd(x, one, x, alpha, p);
+		for(size_t j=0; j<k; j++) alpha[j] = -alpha[j];
+		VecScaleAdd(r, one, r, alpha, q);
+		VecProd(rr, r, r);
+
+	//	z = M^{-1} r, p = z + beta p
+		precond.apply_multi(z, r);
+		rzOld.swap(rz);
+		VecProd(rz, r, z);
+		for(size_t j=0; j<k; j++)
+			beta[j] = (rzOld[j] == 0.0) ? 0.0 : rz[j] / rzOld[j];
+		VecScaleAdd(p, one, z, beta, p);
+	}
+}
+
+} // namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__MULTI_CG__ */
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__AGGREGATION_AMG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__AGGREGATION_AMG__
+
+#include <vector>
+#include <string>
+
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/operator/interface/linear_operator_inverse.h"
+#include "lib_algebra/operator/preconditioner/jacobi.h"
+#include "lib_algebra/operator/linear_solver/lu.h"
+#include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+///		Smoothed aggregation AMG
+/**
+ * Algebraic multigrid preconditioner based on smoothed aggregation
+ * (Vanek, Mandel, Brezina).
+ *
+ * On every level the strongly connected DoFs (\f$ |a_{ij}| \ge \epsilon
+ * \sqrt{|a_{ii}||a_{jj}|} \f$) are grouped into aggregates. Every aggregate
+ * becomes a coarse DoF, the tentative prolongation is the piecewise constant
+ * interpolation from the aggregates and is smoothed by one damped Jacobi step,
+ * \f$ P = (I - \omega D^{-1} A) P_{tent} \f$. The coarse matrices are the
+ * Galerkin products \f$ A_c = P^T A P \f$ computed by CreateAsMultiplyOf.
+ *
+ * In parallel, aggregation is decoupled: only DoFs owned by a process (inner
+ * and master DoFs) are aggregated there. Slave DoFs are prolongated from the
+ * aggregate of their master copy, which becomes a coarse slave DoF on the
+ * slave process. The coarse interfaces are derived from the fine interfaces,
+ * such that P is consistent and \f$ A_c \f$ is additive again. The Jacobi
+ * smoothing of P is only applied to rows of inner DoFs, whose matrix row is
+ * complete on the process. The coarsest level is solved by the base solver,
+ * by default an AgglomeratingSolver with LU.
+ *
+ * If reuse of the setup is enabled and the sparsity pattern of the matrix is
+ * unchanged on the next init, the aggregates are kept and only P, the coarse
+ * matrices, the smoothers and the base solver are recomputed.
+ *
+ * The smoothed prolongation is only supported for scalar algebras; for block
+ * algebras the tentative prolongation (plain aggregation) is used.
+ *
+ *	References:
+ * <ul>
+ * <li> P. Vanek, J. Mandel, M. Brezina. Algebraic multigrid by smoothed
+ * 		aggregation for second and fourth order elliptic problems.
+ * 		Computing 56 (1996)
+ * </ul>
+ */
+template <typename TAlgebra>
+class AggregationAMG : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix Operator type
+		typedef typename IPreconditioner<TAlgebra>::matrix_operator_type matrix_operator_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	protected:
+		using base_type::set_debug;
+		using base_type::debug_writer;
+		using base_type::write_debug;
+
+	public:
+	///	default constructor
+		AggregationAMG();
+
+	/// clone constructor
+		AggregationAMG(const AggregationAMG<TAlgebra> &parent);
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new AggregationAMG<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Destructor
+		virtual ~AggregationAMG() {}
+
+	///	sets the smoother used on all levels (cloned for each level)
+		void set_smoother(SmartPtr<ILinearIterator<vector_type> > smoother)
+		{
+			UG_COND_THROW(smoother.invalid(), "AggregationAMG: smoother is NULL.");
+			m_spSmoother = smoother;
+		}
+
+	///	sets the solver on the coarsest level
+		void set_base_solver(SmartPtr<ILinearOperatorInverse<vector_type> > baseSolver)
+		{
+			UG_COND_THROW(baseSolver.invalid(), "AggregationAMG: base solver is NULL.");
+			m_spBaseSolver = baseSolver;
+		}
+
+	///	sets the maximal number of levels (including the finest)
+		void set_max_levels(size_t maxLevels) {m_maxLevels = maxLevels;}
+
+	///	coarsening stops if the global number of DoFs is at most this number
+		void set_min_base_size(size_t minBaseSize) {m_minBaseSize = minBaseSize;}
+
+	///	sets the strength threshold epsilon for the aggregation (default 0.08)
+		void set_strength_threshold(number eps) {m_strengthThreshold = eps;}
+
+	///	sets the damping of the prolongation smoothing (0 = plain aggregation, default 2/3)
+		void set_prolongation_damping(number omega) {m_prolongationDamping = omega;}
+
+	///	sets the number of pre- and postsmoothing steps
+		void set_num_presmooth(size_t nu1) {m_numPreSmooth = nu1;}
+		void set_num_postsmooth(size_t nu2) {m_numPostSmooth = nu2;}
+
+	///	sets the cycle type (1 = V-cycle, 2 = W-cycle)
+		void set_cycle_type(size_t gamma) {m_gamma = gamma;}
+
+	///	if enabled, the aggregates are reused for matrices with unchanged pattern
+		void set_reuse_setup(bool bReuse) {m_bReuseSetup = bReuse;}
+
+	///	returns the number of levels of the last setup
+		size_t num_levels() const {return m_vLevel.size();}
+
+	///	returns the global number of DoFs on a level
+		size_t level_size(size_t lev) const;
+
+	///	prints sizes and operator complexity of the hierarchy
+		void print_hierarchy() const;
+
+	///	returns information about configuration parameters
+		virtual std::string config_string() const;
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "AggregationAMG";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp);
+
+	///	Step routine, computes c = B*d with one cycle
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d);
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	data of one level
+		struct Level
+		{
+		///	level matrix
+			SmartPtr<MatrixOperator<matrix_type, vector_type> > spA;
+
+		///	prolongation from the next coarser level and its transpose
+			SmartPtr<matrix_type> spP, spR;
+
+		///	aggregate (coarse index) of each DoF, -1 for isolated DoFs
+			std::vector<int> vAggregate;
+
+		///	number of coarse DoFs, local and incl. coarse slave copies
+			size_t numCoarse;
+
+		///	smoother
+			SmartPtr<ILinearIterator<vector_type> > spSmoother;
+
+		///	help vectors (correction, defect, temporary)
+			SmartPtr<vector_type> spC, spD, spT;
+
+		///	global number of DoFs
+			size_t globalSize;
+
+#ifdef UG_PARALLEL
+		///	layouts of the next coarser level
+			SmartPtr<AlgebraLayouts> spCoarseLayouts;
+#endif
+		};
+
+	///	computes the whole hierarchy
+		void setup_hierarchy(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp);
+
+	///	recomputes the values of the hierarchy for a matrix with unchanged pattern
+		void update_hierarchy();
+
+	///	aggregates the owned DoFs of a level and creates the coarse layouts,
+	///	returns the number of aggregates
+		size_t aggregate(Level& lev, const std::vector<bool>& vOwned);
+
+	///	computes (tentative, smoothed) P and R of a level from its aggregates
+		void create_transfer(Level& lev, const std::vector<bool>& vInner);
+
+	///	computes the coarse matrix Ac = R*A*P of a level
+		void create_coarse_matrix(Level& lev, matrix_type& Ac);
+
+	///	marks owned (non-slave) and inner (no interface) DoFs
+		void mark_owned_and_inner(const matrix_type& A, std::vector<bool>& vOwned,
+		                          std::vector<bool>& vInner) const;
+
+	///	returns the global number of DoFs of a matrix
+		size_t global_size(const matrix_type& A) const;
+
+	///	inits smoothers, help vectors and base solver
+		void init_smoothers_and_base();
+
+	///	creates a vector with the size and layouts of the level matrix
+		SmartPtr<vector_type> create_level_vector(const Level& lev) const;
+
+	///	performs one cycle on level l, d is updated
+		void lmgc(size_t l, vector_type& c, vector_type& d);
+
+	///	hash of the sparsity pattern
+		size_t pattern_fingerprint(const matrix_type& A) const;
+
+	protected:
+	///	smoother prototype
+		SmartPtr<ILinearIterator<vector_type> > m_spSmoother;
+
+	///	base solver
+		SmartPtr<ILinearOperatorInverse<vector_type> > m_spBaseSolver;
+
+	///	parameters
+		size_t m_maxLevels, m_minBaseSize;
+		number m_strengthThreshold, m_prolongationDamping;
+		size_t m_numPreSmooth, m_numPostSmooth, m_gamma;
+		bool m_bReuseSetup;
+
+	///	levels, the last one is solved by the base solver
+		std::vector<Level> m_vLevel;
+
+	///	fingerprint of the finest matrix pattern of the last setup
+		size_t m_patternFingerprint;
+};
+
+} // end namespace ug
+
+#include "aggregation_amg_impl.h"
+
+#endif
@@ -0,0 +1,615 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__AGGREGATION_AMG_IMPL__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__AGGREGATION_AMG_IMPL__
+
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <algorithm>
+
+#include "aggregation_amg.h"
+#include "common/util/string_util.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_util.h"
+#endif
+
+namespace ug{
+
+///	adds the contribution of a_ij to the smoothed prolongation entry p
+/**
+ * p -= omega * a_ii^{-1} a_ij. Only implemented for scalar entries, returns
+ * false for block entries (plain aggregation is used then).
+ */
+template <typename T>
+inline bool AMGSmoothProlongationEntry(T& p, number omega, const T& aii, const T& aij)
+{
+	return false;
+}
+
+inline bool AMGSmoothProlongationEntry(double& p, number omega, const double& aii, const double& aij)
+{
+	p -= omega * aij / aii;
+	return true;
+}
+
+template <typename TAlgebra>
+AggregationAMG<TAlgebra>::
+AggregationAMG()
+	: m_maxLevels(20), m_minBaseSize(500),
+	  m_strengthThreshold(0.08), m_prolongationDamping(2.0/3.0),
+	  m_numPreSmooth(2), m_numPostSmooth(2), m_gamma(1),
+	  m_bReuseSetup(false), m_patternFingerprint(0)
+{
+	m_spSmoother = make_sp(new Jacobi<TAlgebra>(0.66));
+	m_spBaseSolver = make_sp(new AgglomeratingSolver<TAlgebra>(make_sp(new LU<TAlgebra>())));
+}
+
+template <typename TAlgebra>
+AggregationAMG<TAlgebra>::
+AggregationAMG(const AggregationAMG<TAlgebra> &parent)
+	: base_type(parent),
+	  m_spSmoother(parent.m_spSmoother), m_spBaseSolver(parent.m_spBaseSolver),
+	  m_maxLevels(parent.m_maxLevels), m_minBaseSize(parent.m_minBaseSize),
+	  m_strengthThreshold(parent.m_strengthThreshold),
+	  m_prolongationDamping(parent.m_prolongationDamping),
+	  m_numPreSmooth(parent.m_numPreSmooth), m_numPostSmooth(parent.m_numPostSmooth),
+	  m_gamma(parent.m_gamma), m_bReuseSetup(parent.m_bReuseSetup),
+	  m_patternFingerprint(0)
+{}
+
+template <typename TAlgebra>
+size_t AggregationAMG<TAlgebra>::
+level_size(size_t lev) const
+{
+	UG_COND_THROW(lev >= m_vLevel.size(), name() << ": level " << lev << " does not exist.");
+	return m_vLevel[lev].globalSize;
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+print_hierarchy() const
+{
+	size_t nnzFine = 0, nnzTotal = 0;
+	UG_LOG(name() << " hierarchy:\n");
+	for(size_t l = 0; l < m_vLevel.size(); ++l)
+	{
+		size_t nnz = m_vLevel[l].spA->total_num_connections();
+#ifdef UG_PARALLEL
+		if(!m_vLevel[l].spA->layouts()->proc_comm().empty())
+			nnz = m_vLevel[l].spA->layouts()->proc_comm().allreduce(nnz, PCL_RO_SUM);
+#endif
+		if(l == 0) nnzFine = nnz;
+		nnzTotal += nnz;
+		UG_LOG("  level " << l << ": " << m_vLevel[l].globalSize << " DoFs, "
+		       << nnz << " nonzeros\n");
+	}
+	if(nnzFine > 0)
+		UG_LOG("  operator complexity: " << (double)nnzTotal / (double)nnzFine << "\n");
+}
+
+template <typename TAlgebra>
+std::string AggregationAMG<TAlgebra>::
+config_string() const
+{
+	std::stringstream ss;
+	ss << name() << " (smoothed aggregation, eps = " << m_strengthThreshold
+	   << ", omega = " << m_prolongationDamping << ", nu1 = " << m_numPreSmooth
+	   << ", nu2 = " << m_numPostSmooth << ", gamma = " << m_gamma
+	   << ", max levels = " << m_maxLevels << ", min base size = " << m_minBaseSize
+	   << ", reuse setup = " << (m_bReuseSetup ? "true" : "false") << ")\n";
+	ss << " Smoother: " << ConfigShift(m_spSmoother->config_string()) << "\n";
+	ss << " Base solver: " << ConfigShift(m_spBaseSolver->config_string()) << "\n";
+	return ss.str();
+}
+
+template <typename TAlgebra>
+size_t AggregationAMG<TAlgebra>::
+pattern_fingerprint(const matrix_type& A) const
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_fingerprint, "algebra AMG");
+//	FNV-1a hash over the sizes and column indices
+	size_t h = 14695981039346656037ULL;
+	const size_t prime = 1099511628211ULL;
+	h = (h ^ A.num_rows()) * prime;
+	h = (h ^ A.num_cols()) * prime;
+	for(size_t i = 0; i < A.num_rows(); ++i)
+	{
+		h = (h ^ A.num_connections(i)) * prime;
+		for(typename matrix_type::const_row_iterator it = A.begin_row(i);
+				it != A.end_row(i); ++it)
+			h = (h ^ it.index()) * prime;
+	}
+	return h;
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+mark_owned_and_inner(const matrix_type& A, std::vector<bool>& vOwned,
+                     std::vector<bool>& vInner) const
+{
+	vOwned.assign(A.num_rows(), true);
+	vInner.assign(A.num_rows(), true);
+#ifdef UG_PARALLEL
+	const IndexLayout& slave = A.layouts()->slave();
+	for(IndexLayout::const_iterator iter = slave.begin(); iter != slave.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = slave.interface(iter);
+		for(IndexLayout::Interface::const_iterator it = interface.begin();
+				it != interface.end(); ++it)
+		{
+			const size_t index = interface.get_element(it);
+			vOwned[index] = false;
+			vInner[index] = false;
+		}
+	}
+
+	const IndexLayout& master = A.layouts()->master();
+	for(IndexLayout::const_iterator iter = master.begin(); iter != master.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = master.interface(iter);
+		for(IndexLayout::Interface::const_iterator it = interface.begin();
+				it != interface.end(); ++it)
+			vInner[interface.get_element(it)] = false;
+	}
+#endif
+}
+
+template <typename TAlgebra>
+size_t AggregationAMG<TAlgebra>::
+global_size(const matrix_type& A) const
+{
+#ifdef UG_PARALLEL
+	std::vector<bool> vOwned, vInner;
+	mark_owned_and_inner(A, vOwned, vInner);
+	size_t numOwned = (size_t)std::count(vOwned.begin(), vOwned.end(), true);
+	if(A.layouts()->proc_comm().empty()) return numOwned;
+	return A.layouts()->proc_comm().allreduce(numOwned, PCL_RO_SUM);
+#else
+	return A.num_rows();
+#endif
+}
+
+template <typename TAlgebra>
+size_t AggregationAMG<TAlgebra>::
+aggregate(Level& lev, const std::vector<bool>& vOwned)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_aggregate, "algebra AMG");
+	const matrix_type& A = *lev.spA;
+	const size_t n = A.num_rows();
+	typedef typename matrix_type::const_row_iterator row_iterator;
+
+//	norms of the diagonal
+	std::vector<number> vDiag(n, 0.0);
+	for(size_t i = 0; i < n; ++i)
+		for(row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			if(it.index() == i) vDiag[i] = BlockNorm(it.value());
+
+//	strong connections (CSR), strength is stored for phase 2
+	std::vector<size_t> vStrongStart(n+1, 0), vStrongCol;
+	std::vector<number> vStrength;
+	std::vector<bool> vIsolated(n, true);
+	for(size_t i = 0; i < n; ++i)
+	{
+		vStrongStart[i] = vStrongCol.size();
+		for(row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			const size_t j = it.index();
+			if(j == i) continue;
+			const number aij = BlockNorm(it.value());
+			if(aij == 0.0 || aij < m_strengthThreshold * std::sqrt(vDiag[i] * vDiag[j]))
+				continue;
+			vIsolated[i] = false;
+			if(!vOwned[j]) continue;
+			vStrongCol.push_back(j);
+			vStrength.push_back(aij / std::sqrt(vDiag[i] * vDiag[j]));
+		}
+	}
+	vStrongStart[n] = vStrongCol.size();
+
+	std::vector<int>& vAgg = lev.vAggregate;
+	vAgg.assign(n, -1);
+	int numAgg = 0;
+
+//	phase 1: aggregates of complete strong neighborhoods
+	for(size_t i = 0; i < n; ++i)
+	{
+		if(!vOwned[i] || vIsolated[i] || vAgg[i] >= 0) continue;
+		bool bFree = true;
+		for(size_t k = vStrongStart[i]; k < vStrongStart[i+1]; ++k)
+			if(vAgg[vStrongCol[k]] >= 0) {bFree = false; break;}
+		if(!bFree) continue;
+
+		vAgg[i] = numAgg;
+		for(size_t k = vStrongStart[i]; k < vStrongStart[i+1]; ++k)
+			vAgg[vStrongCol[k]] = numAgg;
+		++numAgg;
+	}
+
+//	phase 2: attach remaining DoFs to the strongest neighboring aggregate
+	std::vector<int> vAggPhase1(vAgg);
+	for(size_t i = 0; i < n; ++i)
+	{
+		if(!vOwned[i] || vIsolated[i] || vAgg[i] >= 0) continue;
+		number maxStrength = 0.0;
+		for(size_t k = vStrongStart[i]; k < vStrongStart[i+1]; ++k)
+		{
+			const int a = vAggPhase1[vStrongCol[k]];
+			if(a >= 0 && vStrength[k] > maxStrength)
+			{
+				maxStrength = vStrength[k];
+				vAgg[i] = a;
+			}
+		}
+	}
+
+//	phase 3: aggregate the rest with their free strong neighbors
+	for(size_t i = 0; i < n; ++i)
+	{
+		if(!vOwned[i] || vIsolated[i] || vAgg[i] >= 0) continue;
+		vAgg[i] = numAgg;
+		for(size_t k = vStrongStart[i]; k < vStrongStart[i+1]; ++k)
+			if(vAgg[vStrongCol[k]] < 0) vAgg[vStrongCol[k]] = numAgg;
+		++numAgg;
+	}
+
+	lev.numCoarse = numAgg;
+
+#ifdef UG_PARALLEL
+//	slave DoFs are prolongated from the aggregate of their master copy: send
+//	the aggregate index of the masters and create a coarse slave DoF for every
+//	received aggregate. The coarse interfaces are ordered by first appearance
+//	in the fine interfaces, such that both sides match.
+	ParallelVector<Vector<double> > vAggComm(n);
+	vAggComm.set_layouts(A.layouts());
+	for(size_t i = 0; i < n; ++i)
+		vAggComm[i] = vOwned[i] ? (double)vAgg[i] : 0.0;
+	vAggComm.set_storage_type(PST_UNIQUE);
+	vAggComm.change_storage_type(PST_CONSISTENT);
+
+	SmartPtr<AlgebraLayouts> spCoarseLayouts = make_sp(new AlgebraLayouts);
+	spCoarseLayouts->proc_comm() = A.layouts()->proc_comm();
+
+	const IndexLayout& master = A.layouts()->master();
+	std::vector<bool> vInInterface(numAgg, false);
+	for(IndexLayout::const_iterator iter = master.begin(); iter != master.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = master.interface(iter);
+		const int pid = master.proc_id(iter);
+		std::vector<size_t> vCoarse;
+		for(IndexLayout::Interface::const_iterator it = interface.begin();
+				it != interface.end(); ++it)
+		{
+			const int a = vAgg[interface.get_element(it)];
+			if(a < 0 || vInInterface[a]) continue;
+			vInInterface[a] = true;
+			vCoarse.push_back(a);
+		}
+		IndexLayout::Interface& coarseInterface = spCoarseLayouts->master().interface(pid);
+		for(size_t k = 0; k < vCoarse.size(); ++k)
+		{
+			coarseInterface.push_back(vCoarse[k]);
+			vInInterface[vCoarse[k]] = false;
+		}
+	}
+
+	const IndexLayout& slave = A.layouts()->slave();
+	for(IndexLayout::const_iterator iter = slave.begin(); iter != slave.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = slave.interface(iter);
+		const int pid = slave.proc_id(iter);
+		std::map<int, size_t> mCoarseSlave;
+		for(IndexLayout::Interface::const_iterator it = interface.begin();
+				it != interface.end(); ++it)
+		{
+			const size_t index = interface.get_element(it);
+			const int a = (int)vAggComm[index];
+			if(a < 0) {vAgg[index] = -1; continue;}
+
+			std::map<int, size_t>::iterator itMap = mCoarseSlave.find(a);
+			if(itMap == mCoarseSlave.end())
+			{
+				itMap = mCoarseSlave.insert(std::make_pair(a, lev.numCoarse++)).first;
+				spCoarseLayouts->slave().interface(pid).push_back(itMap->second);
+			}
+			vAgg[index] = (int)itMap->second;
+		}
+	}
+
+	lev.spCoarseLayouts = spCoarseLayouts;
+#endif
+
+	return numAgg;
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+create_transfer(Level& lev, const std::vector<bool>& vInner)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_create_transfer, "algebra AMG");
+	const matrix_type& A = *lev.spA;
+	const std::vector<int>& vAgg = lev.vAggregate;
+	const size_t n = A.num_rows();
+	typedef typename matrix_type::value_type value_type;
+	typedef typename matrix_type::const_row_iterator row_iterator;
+
+	lev.spP = make_sp(new matrix_type);
+	lev.spR = make_sp(new matrix_type);
+	matrix_type& P = *lev.spP;
+	P.resize_and_clear(n, lev.numCoarse);
+
+	value_type one; one = 1.0;
+
+//	smoothing is only supported for scalar entries
+	value_type test; test = 0.0;
+	const bool bSmooth = m_prolongationDamping != 0.0
+					&& AMGSmoothProlongationEntry(test, 0.0, one, one);
+
+	for(size_t i = 0; i < n; ++i)
+	{
+	//	rows of inner DoFs are smoothed by a damped Jacobi step, the others
+	//	keep the tentative prolongation (their matrix rows are incomplete)
+		value_type aii; aii = 0.0;
+		if(bSmooth && vInner[i])
+			for(row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				if(it.index() == i) aii = it.value();
+
+		if(BlockNorm(aii) == 0.0)
+		{
+			if(vAgg[i] >= 0) P(i, vAgg[i]) = one;
+			continue;
+		}
+
+		if(vAgg[i] >= 0) P(i, vAgg[i]) += one;
+		for(row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			const int a = vAgg[it.index()];
+			if(a >= 0)
+				AMGSmoothProlongationEntry(P(i, a), m_prolongationDamping, aii, it.value());
+		}
+	}
+	P.defragment();
+
+	lev.spR->set_as_transpose_of(P);
+
+#ifdef UG_PARALLEL
+	P.set_storage_type(PST_CONSISTENT);
+	lev.spR->set_storage_type(PST_CONSISTENT);
+#endif
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+create_coarse_matrix(Level& lev, matrix_type& Ac)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_galerkin, "algebra AMG");
+	CreateAsMultiplyOf(Ac, *lev.spR, *lev.spA, *lev.spP);
+
+#ifdef UG_PARALLEL
+	Ac.set_storage_type(PST_ADDITIVE);
+	Ac.set_layouts(lev.spCoarseLayouts);
+#endif
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+setup_hierarchy(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_setup, "algebra AMG");
+
+	m_vLevel.clear();
+	m_vLevel.resize(1);
+	m_vLevel[0].spA = pOp;
+	m_vLevel[0].globalSize = global_size(*pOp);
+
+	while(m_vLevel.size() < m_maxLevels && m_vLevel.back().globalSize > m_minBaseSize)
+	{
+		Level& fine = m_vLevel.back();
+
+		std::vector<bool> vOwned, vInner;
+		mark_owned_and_inner(*fine.spA, vOwned, vInner);
+		aggregate(fine, vOwned);
+		create_transfer(fine, vInner);
+
+		SmartPtr<MatrixOperator<matrix_type, vector_type> > spAc
+			= make_sp(new MatrixOperator<matrix_type, vector_type>);
+		create_coarse_matrix(fine, spAc->get_matrix());
+		const size_t coarseSize = global_size(*spAc);
+
+	//	stop if the coarsening stagnates (same decision on all procs)
+		if(coarseSize == 0 || coarseSize > 0.9 * fine.globalSize)
+		{
+			fine.spP = SPNULL; fine.spR = SPNULL;
+			fine.vAggregate.clear();
+			break;
+		}
+
+		Level coarse;
+		coarse.spA = spAc;
+		coarse.globalSize = coarseSize;
+		m_vLevel.push_back(coarse);
+	}
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+update_hierarchy()
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_update, "algebra AMG");
+
+	for(size_t l = 0; l + 1 < m_vLevel.size(); ++l)
+	{
+		std::vector<bool> vOwned, vInner;
+		mark_owned_and_inner(*m_vLevel[l].spA, vOwned, vInner);
+		create_transfer(m_vLevel[l], vInner);
+		create_coarse_matrix(m_vLevel[l], m_vLevel[l+1].spA->get_matrix());
+	}
+}
+
+template <typename TAlgebra>
+SmartPtr<typename TAlgebra::vector_type> AggregationAMG<TAlgebra>::
+create_level_vector(const Level& lev) const
+{
+	SmartPtr<vector_type> spVec = make_sp(new vector_type(lev.spA->num_rows()));
+#ifdef UG_PARALLEL
+	spVec->set_layouts(lev.spA->layouts());
+#endif
+	return spVec;
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+init_smoothers_and_base()
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_init_smoothers, "algebra AMG");
+
+	for(size_t l = 0; l < m_vLevel.size(); ++l)
+	{
+		Level& lev = m_vLevel[l];
+		lev.spC = create_level_vector(lev);
+		lev.spD = create_level_vector(lev);
+		lev.spT = create_level_vector(lev);
+
+		if(l + 1 < m_vLevel.size())
+		{
+			lev.spSmoother = m_spSmoother->clone();
+			if(!lev.spSmoother->init(lev.spA))
+				UG_THROW(name() << ": cannot init smoother on level " << l << ".");
+		}
+		else
+			lev.spSmoother = SPNULL;
+	}
+
+	if(!m_spBaseSolver->init(m_vLevel.back().spA))
+		UG_THROW(name() << ": cannot init base solver on level " << m_vLevel.size()-1 << ".");
+}
+
+template <typename TAlgebra>
+bool AggregationAMG<TAlgebra>::
+preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_preprocess, "algebra AMG");
+
+	try{
+		const size_t fingerprint = pattern_fingerprint(*pOp);
+		bool bReuse = m_bReuseSetup && !m_vLevel.empty()
+						&& fingerprint == m_patternFingerprint;
+#ifdef UG_PARALLEL
+		bReuse = pcl::AllProcsTrue(bReuse, pOp->layouts()->proc_comm());
+#endif
+
+		if(bReuse)
+		{
+			m_vLevel[0].spA = pOp;
+			update_hierarchy();
+		}
+		else
+			setup_hierarchy(pOp);
+
+		m_patternFingerprint = fingerprint;
+		init_smoothers_and_base();
+	}UG_CATCH_THROW(name() << "::preprocess failed.");
+
+	return true;
+}
+
+template <typename TAlgebra>
+void AggregationAMG<TAlgebra>::
+lmgc(size_t l, vector_type& c, vector_type& d)
+{
+	Level& lev = m_vLevel[l];
+
+//	coarsest level
+	if(l + 1 == m_vLevel.size())
+	{
+		if(!m_spBaseSolver->apply_update_defect(c, d))
+			UG_THROW(name() << ": base solver failed on level " << l << ".");
+		return;
+	}
+
+	vector_type& t = *lev.spT;
+	const matrix_type& A = *lev.spA;
+
+	c.set(0.0);
+
+//	presmoothing
+	for(size_t nu = 0; nu < m_numPreSmooth; ++nu)
+	{
+		if(!lev.spSmoother->apply_update_defect(t, d))
+			UG_THROW(name() << ": presmoother failed on level " << l << ".");
+		c += t;
+	}
+
+//	coarse grid correction
+	Level& coarse = m_vLevel[l+1];
+	vector_type& dc = *coarse.spD;
+	vector_type& cc = *coarse.spC;
+	lev.spR->apply(dc, d);
+	for(size_t g = 0; g < m_gamma; ++g)
+	{
+		lmgc(l+1, cc, dc);
+		lev.spP->apply(t, cc);
+		c += t;
+		A.matmul_minus(d, t);
+	}
+
+//	postsmoothing
+	for(size_t nu = 0; nu < m_numPostSmooth; ++nu)
+	{
+		if(!lev.spSmoother->apply_update_defect(t, d))
+			UG_THROW(name() << ": postsmoother failed on level " << l << ".");
+		c += t;
+	}
+}
+
+template <typename TAlgebra>
+bool AggregationAMG<TAlgebra>::
+step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+{
+	PROFILE_BEGIN_GROUP(AggregationAMG_step, "algebra AMG");
+	UG_COND_THROW(m_vLevel.empty(), name() << ": not initialized.");
+
+	vector_type& d0 = *m_vLevel[0].spD;
+	d0 = d;
+
+	try{
+		lmgc(0, c, d0);
+	}UG_CATCH_THROW(name() << "::step failed.");
+
+	return true;
+}
+
+} // end namespace ug
+
+#endif
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/small_algebra/additional_math.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+///		Chebyshev-Iteration
+/**
+ * Polynomial smoother for the Jacobi-preconditioned system
+ *
+ * 		\f$ D^{-1} A x = D^{-1} b \f$.
+ *
+ * 	The correction \f$ c = p(D^{-1}A) D^{-1} d \f$ is computed by the three-term
+ * 	recurrence of the Chebyshev polynomial of the given degree that is
+ * 	minimal on the interval \f$ [\lambda_{min}, \lambda_{max}] \f$. Damping all
+ * 	eigenmodes in the upper part of the spectrum, this makes a smoother for
+ * 	multigrid methods.
+ *
+ * 	In contrast to Gauss-Seidel type smoothers only matrix-vector products and
+ * 	diagonal scalings are needed, i.e. one interface exchange per degree and no
+ * 	global reductions. Therefore the smoothing property does not degrade with
+ * 	the number of processes.
+ *
+ * 	If no bounds are set explicitly, \f$ \lambda_{max} \f$ is estimated by some
+ * 	Lanczos iterations on \f$ D^{-1}A \f$ in preprocess and enlarged by a safety
+ * 	factor; the lower bound is then chosen as \f$ \lambda_{max} / ratio \f$.
+ *
+ *	References:
+ * <ul>
+ * <li> Y. Saad. Iterative Methods for Sparse Linear Systems, 2nd ed., Alg. 12.1
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ * 		polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ */
+template <typename TAlgebra>
+class Chebyshev : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix Operator type
+		typedef typename IPreconditioner<TAlgebra>::matrix_operator_type matrix_operator_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	protected:
+		using base_type::set_debug;
+		using base_type::debug_writer;
+		using base_type::write_debug;
+
+	public:
+	///	default constructor
+		Chebyshev()
+			: m_degree(3), m_eigRatio(30.0), m_safety(1.1), m_numLanczosIt(10),
+			  m_lambdaMinUser(0.0), m_lambdaMaxUser(0.0),
+			  m_lambdaMin(0.0), m_lambdaMax(0.0)
+		{}
+
+	///	constructor setting the polynomial degree
+		Chebyshev(size_t degree)
+			: m_degree(degree), m_eigRatio(30.0), m_safety(1.1), m_numLanczosIt(10),
+			  m_lambdaMinUser(0.0), m_lambdaMaxUser(0.0),
+			  m_lambdaMin(0.0), m_lambdaMax(0.0)
+		{}
+
+	/// clone constructor
+		Chebyshev(const Chebyshev<TAlgebra> &parent)
+			: base_type(parent),
+			  m_degree(parent.m_degree), m_eigRatio(parent.m_eigRatio),
+			  m_safety(parent.m_safety), m_numLanczosIt(parent.m_numLanczosIt),
+			  m_lambdaMinUser(parent.m_lambdaMinUser),
+			  m_lambdaMaxUser(parent.m_lambdaMaxUser),
+			  m_lambdaMin(0.0), m_lambdaMax(0.0)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new Chebyshev<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Destructor
+		virtual ~Chebyshev()
+		{};
+
+	///	sets the degree of the polynomial (i.e. number of matrix-vector products per step)
+		void set_degree(size_t degree)
+		{
+			UG_COND_THROW(degree == 0, "Chebyshev: degree must be at least 1.");
+			m_degree = degree;
+		}
+
+	///	sets the ratio lambda_max / lambda_min of the smoothed interval
+		void set_eigenvalue_ratio(number ratio)
+		{
+			UG_COND_THROW(ratio <= 1.0, "Chebyshev: eigenvalue ratio must be > 1.");
+			m_eigRatio = ratio;
+		}
+
+	///	sets the factor the estimated maximal eigenvalue is enlarged by
+		void set_safety_factor(number safety) {m_safety = safety;}
+
+	///	sets the number of Lanczos iterations used to estimate lambda_max
+		void set_num_lanczos_iterations(size_t n) {m_numLanczosIt = n;}
+
+	///	sets the spectral bounds of D^{-1}A explicitly (disables the estimation)
+		void set_spectral_bounds(number lambdaMin, number lambdaMax)
+		{
+			UG_COND_THROW(lambdaMin <= 0.0 || lambdaMax <= lambdaMin,
+			              "Chebyshev: need 0 < lambdaMin < lambdaMax.");
+			m_lambdaMinUser = lambdaMin;
+			m_lambdaMaxUser = lambdaMax;
+		}
+
+	///	returns the lower bound of the interval used in the last preprocess
+		number lambda_min() const {return m_lambdaMin;}
+
+	///	returns the upper bound of the interval used in the last preprocess
+		number lambda_max() const {return m_lambdaMax;}
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "Chebyshev";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_preprocess, "algebra Chebyshev");
+
+			matrix_type &mat = *pOp;
+			const size_t size = mat.num_rows();
+			if(size != mat.num_cols())
+			{
+				UG_LOG("Square Matrix needed for Chebyshev Iteration.\n");
+				return false;
+			}
+
+			m_diagInv.resize(size);
+#ifdef UG_PARALLEL
+		//	temporary vector for the diagonal
+			ParallelVector<Vector< typename matrix_type::value_type > > diag;
+			diag.resize(size);
+			diag.set_layouts(mat.layouts());
+
+			for(size_t i = 0; i < diag.size(); ++i)
+				diag[i] = mat(i, i);
+
+		//	make diagonal consistent
+			diag.set_storage_type(PST_ADDITIVE);
+			diag.change_storage_type(PST_CONSISTENT);
+
+			if(diag.size() > 0)
+				if(CheckVectorInvertible(diag) == false)
+					return false;
+#endif
+
+		// 	invert diagonal
+			for(size_t i = 0; i < size; ++i)
+			{
+#ifdef UG_PARALLEL
+				GetInverse(m_diagInv[i], diag[i]);
+#else
+				GetInverse(m_diagInv[i], mat(i,i));
+#endif
+			}
+
+		//	get the interval to be smoothed
+			if(m_lambdaMaxUser > 0.0)
+			{
+				m_lambdaMin = m_lambdaMinUser;
+				m_lambdaMax = m_lambdaMaxUser;
+			}
+			else
+			{
+				m_lambdaMax = m_safety * estimate_lambda_max(mat);
+				m_lambdaMin = m_lambdaMax / m_eigRatio;
+			}
+
+			UG_COND_THROW(!(m_lambdaMax > 0.0),
+			              name() << ": invalid spectral bound lambda_max = " << m_lambdaMax);
+
+			return true;
+		}
+
+	///	computes c = p(D^{-1}A) D^{-1} d
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_step, "algebra Chebyshev");
+
+			matrix_type &mat = *pOp;
+
+			const number theta = 0.5 * (m_lambdaMax + m_lambdaMin);
+			const number delta = 0.5 * (m_lambdaMax - m_lambdaMin);
+			const number sigma = theta / delta;
+			number rho = 1.0 / sigma;
+
+		//	help vectors
+			if(m_spR.invalid() || m_spR->size() != c.size())
+			{
+				m_spR = c.clone_without_values();
+				m_spZ = c.clone_without_values();
+				m_spP = c.clone_without_values();
+			}
+			vector_type& r = *m_spR;
+			vector_type& z = *m_spZ;
+			vector_type& p = *m_spP;
+
+		//	p = 1/theta * D^{-1} d,  c = p
+			scale_by_inverse_diagonal(z, d);
+			VecScaleAssign(p, 1.0 / theta, z);
+			VecScaleAssign(c, 1.0, p);
+#ifdef UG_PARALLEL
+			p.set_storage_type(PST_CONSISTENT);
+			c.set_storage_type(PST_CONSISTENT);
+#endif
+
+			for(size_t k = 1; k < m_degree; ++k)
+			{
+			//	r = d - A*c
+				VecScaleAssign(r, 1.0, d);
+#ifdef UG_PARALLEL
+				r.set_storage_type(PST_ADDITIVE);
+#endif
+				mat.matmul_minus(r, c);
+
+			//	z = D^{-1} r
+				scale_by_inverse_diagonal(z, r);
+
+			//	p = rho_new*rho * p + 2*rho_new/delta * z,  c += p
+				const number rhoNew = 1.0 / (2.0 * sigma - rho);
+				VecScaleAdd(p, rhoNew * rho, p, 2.0 * rhoNew / delta, z);
+				VecScaleAdd(c, 1.0, c, 1.0, p);
+				rho = rhoNew;
+			}
+
+			return true;
+		}
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	computes dest = D^{-1} src, dest is consistent on exit
+		void scale_by_inverse_diagonal(vector_type& dest, const vector_type& src)
+		{
+			for(size_t i = 0; i < m_diagInv.size(); ++i)
+				MatMult(dest[i], 1.0, m_diagInv[i], src[i]);
+
+#ifdef UG_PARALLEL
+			dest.set_storage_type(PST_ADDITIVE);
+			if(!dest.change_storage_type(PST_CONSISTENT))
+				UG_THROW(name() << ": Cannot change parallel storage type to consistent.");
+#endif
+		}
+
+	///	estimates the largest eigenvalue of D^{-1}A by Lanczos iterations
+	/**
+	 * Some steps of a Jacobi-preconditioned cg method are performed. The cg
+	 * coefficients define the Lanczos tridiagonal matrix of D^{-1}A, whose
+	 * largest eigenvalue converges much faster to lambda_max than the plain
+	 * power iteration does.
+	 */
+		number estimate_lambda_max(const matrix_type& mat)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_estimate, "algebra Chebyshev");
+
+			const size_t size = mat.num_rows();
+
+			vector_type r(size), z(size), p(size), q(size);
+#ifdef UG_PARALLEL
+			r.set_layouts(mat.layouts());
+			z.set_layouts(mat.layouts());
+			p.set_layouts(mat.layouts());
+			q.set_layouts(mat.layouts());
+#endif
+
+		//	deterministic, non-smooth start vector, such that high frequencies
+		//	(which determine lambda_max) are present from the beginning
+			for(size_t i = 0; i < size; ++i)
+				r[i] = 1.0 + 0.5 * std::sin(1.0 + (number)i);
+#ifdef UG_PARALLEL
+			r.set_storage_type(PST_ADDITIVE);
+#endif
+
+		//	diagonal and off-diagonal of the Lanczos matrix
+			std::vector<number> vDiag, vOffDiag;
+
+			number rz = 0.0, alphaOld = 0.0;
+			for(size_t it = 0; it < m_numLanczosIt; ++it)
+			{
+				scale_by_inverse_diagonal(z, r);
+				const number rzNew = r.dotprod(z);
+				if(!(rzNew > 0.0)) break;
+
+				const number beta = (it == 0) ? 0.0 : rzNew / rz;
+				if(it == 0) VecScaleAssign(p, 1.0, z);
+				else VecScaleAdd(p, 1.0, z, beta, p);
+#ifdef UG_PARALLEL
+				p.set_storage_type(PST_CONSISTENT);
+#endif
+				rz = rzNew;
+
+				mat.apply(q, p);
+				const number pq = p.dotprod(q);
+				if(!(pq > 0.0)) break;
+				const number alpha = rz / pq;
+
+				if(it == 0) vDiag.push_back(1.0 / alpha);
+				else
+				{
+					vDiag.push_back(1.0 / alpha + beta / alphaOld);
+					vOffDiag.push_back(std::sqrt(beta) / alphaOld);
+				}
+				alphaOld = alpha;
+
+			//	r -= alpha * q
+				VecScaleAdd(r, 1.0, r, -alpha, q);
+#ifdef UG_PARALLEL
+				r.set_storage_type(PST_ADDITIVE);
+#endif
+			}
+
+			return max_eigenvalue_tridiagonal(vDiag, vOffDiag);
+		}
+
+	///	largest eigenvalue of a symmetric tridiagonal matrix (sturm bisection)
+		static number max_eigenvalue_tridiagonal(const std::vector<number>& a,
+		                                       const std::vector<number>& b)
+		{
+			const size_t n = a.size();
+			if(n == 0) return 0.0;
+
+		//	gershgorin bounds
+			number lo = a[0], hi = a[0];
+			for(size_t i = 0; i < n; ++i)
+			{
+				number r = 0.0;
+				if(i > 0) r += std::fabs(b[i-1]);
+				if(i+1 < n) r += std::fabs(b[i]);
+				lo = std::min(lo, a[i] - r);
+				hi = std::max(hi, a[i] + r);
+			}
+
+		//	bisection on the number of eigenvalues smaller than x
+			for(int k = 0; k < 100 && hi - lo > 1e-10 * std::fabs(hi); ++k)
+			{
+				const number x = 0.5 * (lo + hi);
+				size_t cnt = 0;
+				number d = a[0] - x;
+				if(d < 0.0) ++cnt;
+				for(size_t i = 1; i < n; ++i)
+				{
+					if(d == 0.0) d = 1e-300;
+					d = a[i] - x - b[i-1]*b[i-1] / d;
+					if(d < 0.0) ++cnt;
+				}
+				if(cnt == n) hi = x; else lo = x;
+			}
+			return hi;
+		}
+
+	protected:
+	///	type of block-inverse
+		typedef typename block_traits<typename matrix_type::value_type>::inverse_type inverse_type;
+
+	///	storage of the inverse (consistent) diagonal
+		std::vector<inverse_type> m_diagInv;
+
+	///	degree of the polynomial
+		size_t m_degree;
+
+	///	ratio lambda_max / lambda_min, safety factor for estimated lambda_max
+		number m_eigRatio, m_safety;
+
+	///	number of Lanczos iterations
+		size_t m_numLanczosIt;
+
+	///	user supplied bounds (if lambda_max > 0)
+		number m_lambdaMinUser, m_lambdaMaxUser;
+
+	///	bounds used for smoothing
+		number m_lambdaMin, m_lambdaMax;
+
+	///	help vectors
+		SmartPtr<vector_type> m_spR, m_spZ, m_spP;
+};
+
+} // end namespace ug
+
+#endif
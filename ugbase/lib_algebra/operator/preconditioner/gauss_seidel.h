@@ -36,6 +36,7 @@
 #include "lib_algebra/operator/interface/preconditioner.h"
 #include "lib_algebra/algebra_common/core_smoothers.h"
 #include "lib_algebra/algebra_common/sparsematrix_util.h"
+#include "lib_algebra/algebra_common/single_precision_util.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 	#include "lib_algebra/parallelization/parallel_matrix_overlap_impl.h"
@@ -62,6 +63,10 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 	///	Base type
 		typedef IPreconditioner<TAlgebra> base_type;
 
+	///	Matrix type for single precision storage
+		typedef typename single_precision_traits<typename matrix_type::value_type>::matrix_type
+			single_matrix_type;
+
 	protected:
 		using base_type::set_debug;
 		using base_type::debug_writer;
@@ -69,11 +74,11 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 	public:
 	//	Constructor
-		GaussSeidelBase() { m_relax = 1.0; };
+		GaussSeidelBase() : m_bSinglePrecision(false) { m_relax = 1.0; };
 
 	/// clone constructor
 		GaussSeidelBase( const GaussSeidelBase<TAlgebra> &parent )
-			: base_type(parent)
+			: base_type(parent), m_bSinglePrecision(parent.m_bSinglePrecision)
 		{
 			set_sor_relax(parent.m_relax);
 		}
@@ -81,6 +86,20 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 	//	set relaxation parameter to define a SOR-method
 		void set_sor_relax(number relaxFactor){ m_relax = relaxFactor;}
 
+	///	sweeps with a single precision copy of the matrix
+	/**
+	 * The matrix is copied in single precision during preprocess, the
+	 * vectors stay in double precision. This halves the memory traffic of
+	 * the sweeps, e.g. when used as a multigrid smoother. Only available
+	 * for scalar algebras.
+	 */
+		void set_single_precision(bool bSingle)
+		{
+			if(bSingle && !single_precision_traits<typename matrix_type::value_type>::available)
+				UG_THROW(name() << ": Single precision storage only available for scalar algebra.");
+			m_bSinglePrecision = bSingle;
+		}
+
 		virtual const char* name() const = 0;
 	protected:
 
@@ -110,6 +129,12 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 			THROW_IF_NOT_EQUAL(pA->num_rows(), pA->num_cols());
 //			UG_ASSERT(CheckDiagonalInvertible(A), "GS: A has noninvertible diagonal");
 			UG_COND_THROW(CheckDiagonalInvertible(*pA) == false, name() << ": A has noninvertible diagonal");
+
+		//	copy matrix in single precision
+			if(m_bSinglePrecision)
+				CopySparseMatrixValues(m_ASingle, *pA);
+			else
+				m_ASingle.resize_and_clear(0, 0);
 			return true;
 		}
 
@@ -118,6 +143,13 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax) = 0;
 
+	///	step using the single precision matrix
+		virtual void step_single_precision(const single_matrix_type &A, vector_type &c,
+		                                   const vector_type &d, const number relax)
+		{
+			UG_THROW(name() << ": Single precision storage not supported.");
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -132,7 +164,10 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 				spDtmp->change_storage_type(PST_UNIQUE);
 
 				THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), m_A.num_rows());
-				step(m_A, c, *spDtmp, m_relax);
+				if(m_bSinglePrecision)
+					step_single_precision(m_ASingle, c, *spDtmp, m_relax);
+				else
+					step(m_A, c, *spDtmp, m_relax);
 				c.set_storage_type(PST_UNIQUE);
 				return true;
 			}
@@ -141,7 +176,10 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 			{
 				matrix_type &A = *pOp;
 				THROW_IF_NOT_EQUAL_4(c.size(), d.size(), A.num_rows(), A.num_cols());
-				step(A, c, d, m_relax);
+				if(m_bSinglePrecision)
+					step_single_precision(m_ASingle, c, d, m_relax);
+				else
+					step(A, c, d, m_relax);
 #ifdef UG_PARALLEL
 				c.set_storage_type(PST_UNIQUE);
 #endif
@@ -154,6 +192,12 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		matrix_type m_A;
 #endif
 
+	///	flag if sweeps use single precision matrix
+		bool m_bSinglePrecision;
+
+	///	single precision copy of the matrix
+		single_matrix_type m_ASingle;
+
 	private:
 		//	relaxation parameter
 		number m_relax;
@@ -178,6 +222,7 @@ class GaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -202,6 +247,12 @@ public:
 		{
 			gs_step_LL(A, c, d, relax);
 		}
+
+	//	Stepping routine for single precision matrix
+		virtual void step_single_precision(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			gs_step_LL(A, c, d, relax);
+		}
 };
 
 /// Gauss-Seidel preconditioner for the 'backward' ordering of the dofs
@@ -223,6 +274,7 @@ class BackwardGaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -247,6 +299,12 @@ public:
 		{
 			gs_step_UR(A, c, d, relax);
 		}
+
+	//	Stepping routine for single precision matrix
+		virtual void step_single_precision(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			gs_step_UR(A, c, d, relax);
+		}
 };
 
 
@@ -257,6 +315,7 @@ class SymmetricGaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -281,6 +340,12 @@ public:
 		{
 			sgs_step(A, c, d, relax);
 		}
+
+	//	Stepping routine for single precision matrix
+		virtual void step_single_precision(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			sgs_step(A, c, d, relax);
+		}
 };
 
 } // end namespace ug
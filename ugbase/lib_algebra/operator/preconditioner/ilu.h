@@ -43,6 +43,8 @@
 	#include "lib_algebra/parallelization/parallel_matrix_overlap_impl.h"
 #endif
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/single_precision_util.h"
+#include "lib_algebra/cpu_algebra/multi_vector.h"
 
 namespace ug{
 
@@ -85,7 +87,7 @@ bool FactorizeILU(Matrix_type &A)
 				if(bFound)
 				{
 					const block_type a_kj = p.value();
-					a_ij -= a_ik *a_kj;
+					SubMult(a_ij, a_ik, a_kj);
 				}
 			}
 		}
@@ -143,13 +145,13 @@ bool FactorizeILUBeta(Matrix_type &A, number beta)
 					// entry belongs to pattern
 					// -> proceed with standard elimination
 					block_type a_ij = pij.value();
-					a_ij -= a_ik *a_kj ;
+					SubMult(a_ij, a_ik, a_kj);
 
 				} else {
 					// entry DOES NOT belong to pattern
 					// -> we lump it onto the diagonal
 					// TODO : non square matrices!!!
-					Nii -=  a_ik * a_kj;
+					SubMult(Nii, a_ik, a_kj);
 				}
 
 			}
@@ -206,7 +208,7 @@ bool FactorizeILUSorted(Matrix_type &A, const number eps = 1e-50)
 				{
 					block_type &a_ij = it_ij.value();
 					const block_type &a_kj = it_kj.value();
-					a_ij -= a_ik * a_kj;
+					SubMult(a_ij, a_ik, a_kj);
 					++it_kj; ++it_ij;
 				}
 			}
@@ -308,6 +310,71 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 	return true;
 }
 
+// solve x = L^-1 b for all vectors of a MultiVector
+template<typename Matrix_type, typename TValue>
+bool invert_L(const Matrix_type &A, MultiVector<TValue> &x, const MultiVector<TValue> &b)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	typedef typename Matrix_type::const_row_iterator const_row_iterator;
+
+	const size_t k = x.num_cols();
+	for(size_t i=0; i < x.size(); i++)
+	{
+		TValue* xi = x.row(i);
+		const TValue* bi = b.row(i);
+		for(size_t j=0; j<k; j++) xi[j] = bi[j];
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			if(it.index() >= i) continue;
+			const TValue* xc = x.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(xi[j], 1.0, xi[j], -1.0, it.value(), xc[j]);
+		}
+	}
+
+	return true;
+}
+
+// solve x = U^-1 * b for all vectors of a MultiVector
+template<typename Matrix_type, typename TValue>
+bool invert_U(const Matrix_type &A, MultiVector<TValue> &x, const MultiVector<TValue> &b,
+			  const number eps = 1e-8)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	typedef typename Matrix_type::const_row_iterator const_row_iterator;
+
+	const size_t k = x.num_cols();
+	std::vector<TValue> s(k);
+
+	if(x.size() == 0) return true;
+	for(size_t i = x.size()-1; ; --i)
+	{
+		const TValue* bi = b.row(i);
+		for(size_t j=0; j<k; j++) s[j] = bi[j];
+		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+		{
+			if(it.index() <= i) continue;
+			const TValue* xc = x.row(it.index());
+			for(size_t j=0; j<k; j++)
+				MatMultAdd(s[j], 1.0, s[j], -1.0, it.value(), xc[j]);
+		}
+
+		TValue* xi = x.row(i);
+		const typename Matrix_type::value_type &uii = A(i,i);
+		for(size_t j=0; j<k; j++)
+		{
+		//	near-zero last diagonal entry, see invert_U above
+			if(i == x.size()-1 && BlockNorm(uii) <= eps * BlockNorm(s[j]))
+				xi[j] = 0;
+			else
+				InverseMatMult(xi[j], 1.0, uii, s[j]);
+		}
+		if(i == 0) break;
+	}
+
+	return true;
+}
+
 ///	ILU / ILU(beta) preconditioner
 template <typename TAlgebra>
 class ILU : public IPreconditioner<TAlgebra>
@@ -328,6 +395,13 @@ class ILU : public IPreconditioner<TAlgebra>
 	///	Base type
 		typedef IPreconditioner<TAlgebra> base_type;
 
+	///	Matrix type for single precision storage of the factorization
+		typedef typename single_precision_traits<typename matrix_type::value_type>::matrix_type
+			single_matrix_type;
+
+	///	MultiVector type
+		typedef MultiVector<typename vector_type::value_type> multi_vector_type;
+
 	protected:
 		using base_type::set_debug;
 		using base_type::debug_writer;
@@ -340,7 +414,8 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_sortEps(1.e-50),
 			m_invEps(1.e-8),
 			m_bSort(false),
-			m_bDisablePreprocessing(false) {};
+			m_bDisablePreprocessing(false),
+			m_bSinglePrecision(false) {};
 
 	/// clone constructor
 		ILU( const ILU<TAlgebra> &parent )
@@ -349,7 +424,8 @@ class ILU : public IPreconditioner<TAlgebra>
 			  m_sortEps(parent.m_sortEps),
 			  m_invEps(parent.m_invEps),
 			  m_bSort(parent.m_bSort),
-			  m_bDisablePreprocessing(parent.m_bDisablePreprocessing)
+			  m_bDisablePreprocessing(parent.m_bDisablePreprocessing),
+			  m_bSinglePrecision(parent.m_bSinglePrecision)
 		{	}
 
 	///	Clone
@@ -382,6 +458,20 @@ class ILU : public IPreconditioner<TAlgebra>
 	///	sets the smallest allowed value for the Aii/Bi quotient
 		void set_inversion_eps(number eps)				{m_invEps = eps;}
 
+	///	stores the factorization in single precision
+	/**
+	 * The factorization is computed in double precision and converted
+	 * afterwards. The forward and backward solves use the single precision
+	 * factors, while the vectors stay in double precision. Only available
+	 * for scalar algebras.
+	 */
+		void set_single_precision(bool bSingle)
+		{
+			if(bSingle && !single_precision_traits<typename matrix_type::value_type>::available)
+				UG_THROW("ILU: Single precision storage only available for scalar algebra.");
+			m_bSinglePrecision = bSingle;
+		}
+
 	protected:
 	//	Name of preconditioner
 		virtual const char* name() const {return "ILU";}
@@ -445,29 +535,88 @@ class ILU : public IPreconditioner<TAlgebra>
 		//	Debug output of matrices
 			write_debug(m_ILU, "ILU_prep_04_AfterFactorize");
 
+		//	convert factorization to single precision
+			if(m_bSinglePrecision)
+			{
+				CopySparseMatrixValues(m_ILUSingle, m_ILU);
+				m_ILU.resize_and_clear(0, 0);
+			}
+			else
+				m_ILUSingle.resize_and_clear(0, 0);
+
 		//	we're done
 			return true;
 		}
 
 
-		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
+		template <typename TLUMatrix>
+		void applyLU(const TLUMatrix &LU, vector_type &c, const vector_type &d, vector_type &tmp)
 		{
 			if(!m_bSort || m_bSortIsIdentity)
 			{
 				// 	apply iterator: c = LU^{-1}*d
-				invert_L(m_ILU, tmp, d); // h := L^-1 d
-				invert_U(m_ILU, c, tmp, m_invEps); // c := U^-1 h = (LU)^-1 d
+				invert_L(LU, tmp, d); // h := L^-1 d
+				invert_U(LU, c, tmp, m_invEps); // c := U^-1 h = (LU)^-1 d
 			}
 			else
 			{
 				// we save one vector here by renaming
 				SetVectorAsPermutation(tmp, d, m_newIndex);
-				invert_L(m_ILU, c, tmp); // c = L^{-1} d
-				invert_U(m_ILU, tmp, c, m_invEps); // tmp = (LU)^{-1} d
+				invert_L(LU, c, tmp); // c = L^{-1} d
+				invert_U(LU, tmp, c, m_invEps); // tmp = (LU)^{-1} d
 				SetVectorAsPermutation(c, tmp, m_oldIndex);
 			}
 		}
 
+		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
+		{
+			if(m_bSinglePrecision) applyLU(m_ILUSingle, c, d, tmp);
+			else applyLU(m_ILU, c, d, tmp);
+		}
+
+		template <typename TLUMatrix>
+		void applyLU(const TLUMatrix &LU, multi_vector_type &c, const multi_vector_type &d)
+		{
+			m_hMulti.resize(d.size(), d.num_cols());
+			if(!m_bSort || m_bSortIsIdentity)
+			{
+				invert_L(LU, m_hMulti, d);
+				invert_U(LU, c, m_hMulti, m_invEps);
+			}
+			else
+			{
+				const size_t k = d.num_cols();
+				for(size_t i=0; i<d.size(); i++)
+					for(size_t j=0; j<k; j++)
+						c(m_newIndex[i], j) = d(i, j);
+				invert_L(LU, m_hMulti, c);
+				invert_U(LU, c, m_hMulti, m_invEps);
+				m_hMulti = c;
+				for(size_t i=0; i<d.size(); i++)
+					for(size_t j=0; j<k; j++)
+						c(m_oldIndex[i], j) = m_hMulti(i, j);
+			}
+		}
+
+	public:
+	/**
+	 * applies the factorization to all vectors of d at once, c = (LU)^{-1} d.
+	 * Every entry of the factorization is read once for all vectors. This is
+	 * a local operation: in parallel, the process-wise factorization is
+	 * applied without communication, i.e. d has to be unique.
+	 */
+		void apply_multi(multi_vector_type &c, const multi_vector_type &d)
+		{
+			PROFILE_BEGIN_GROUP(ILU_apply_multi, "algebra ILU");
+			UG_COND_THROW(!base_type::m_bInit, "ILU::apply_multi: not initialized.");
+			UG_COND_THROW(d.size() != m_h.size(), "ILU::apply_multi: size mismatch.");
+			c.resize(d.size(), d.num_cols());
+			if(m_bSinglePrecision) applyLU(m_ILUSingle, c, d);
+			else applyLU(m_ILU, c, d);
+		}
+
+	protected:
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -509,8 +658,14 @@ class ILU : public IPreconditioner<TAlgebra>
 	///	storage for factorization
 		matrix_type m_ILU;
 
+	///	storage for factorization in single precision
+		single_matrix_type m_ILUSingle;
+
 	///	help vector
 		vector_type m_h;
+
+	///	help multi vector
+		multi_vector_type m_hMulti;
 		
 	/// Factor for ILU-beta
 		number m_beta;
@@ -528,6 +683,9 @@ class ILU : public IPreconditioner<TAlgebra>
 
 	/// whether or not to disable preprocessing
 		bool m_bDisablePreprocessing;
+
+	///	whether the factorization is stored in single precision
+		bool m_bSinglePrecision;
 };
 
 } // end namespace ug
@@ -13,6 +13,7 @@
 
 #include "lib_algebra/algebra_common/vector_util.h"
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/single_precision_util.h"
 
 namespace ug{
 
@@ -41,6 +42,9 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	protected:
 		typedef typename matrix_type::value_type block_type;
 
+	///	Matrix type for single precision storage of the factors
+		typedef typename single_precision_traits<block_type>::matrix_type single_matrix_type;
+
 		using IPreconditioner<TAlgebra>::debug_writer;
 		using IPreconditioner<TAlgebra>::write_debug;
 
@@ -50,7 +54,8 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 	///	Constructor
 		ILUTPreconditioner(double eps=1e-6)
-			: m_eps(eps), m_info(false), m_bSort(true), m_bSortIsIdentity(false)
+			: m_eps(eps), m_info(false), m_bSort(true), m_bSortIsIdentity(false),
+			  m_bSinglePrecision(false)
 		{};
 
 	/// clone constructor
@@ -61,6 +66,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			set_info(parent.m_info);
 			set_sort(parent.m_bSort);
 			m_bSortIsIdentity = parent.m_bSortIsIdentity;
+			m_bSinglePrecision = parent.m_bSinglePrecision;
 		}
 
 	///	Clone
@@ -102,6 +108,20 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			m_bSort = b;
 		}
 
+	///	stores the factors L and U in single precision
+	/**
+	 * The factorization is computed in double precision and converted
+	 * afterwards. The forward and backward solves use the single precision
+	 * factors, while the vectors stay in double precision. Only available
+	 * for scalar algebras.
+	 */
+		void set_single_precision(bool bSingle)
+		{
+			if(bSingle && !single_precision_traits<block_type>::available)
+				UG_THROW("ILUT: Single precision storage only available for scalar algebra.");
+			m_bSinglePrecision = bSingle;
+		}
+
 
 	protected:
 	//	Name of preconditioner
@@ -336,6 +356,20 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 				}
 			}
 
+		//	convert factors to single precision
+			if(m_bSinglePrecision)
+			{
+				CopySparseMatrixValues(m_LSingle, m_L);
+				CopySparseMatrixValues(m_USingle, m_U);
+				m_L.resize_and_clear(0, 0);
+				m_U.resize_and_clear(0, 0);
+			}
+			else
+			{
+				m_LSingle.resize_and_clear(0, 0);
+				m_USingle.resize_and_clear(0, 0);
+			}
+
 			return true;
 		}
 
@@ -376,15 +410,25 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 
 
 		virtual bool applyLU(vector_type& c, const vector_type& d)
+		{
+			if(m_bSinglePrecision) return applyLU(m_LSingle, m_USingle, c, d);
+			else return applyLU(m_L, m_U, c, d);
+		}
+
+		template <typename TLUMatrix>
+		bool applyLU(const TLUMatrix& L, const TLUMatrix& U, vector_type& c, const vector_type& d)
 		{
 			PROFILE_BEGIN_GROUP(ILUT_step, "ilut algebra");
+			typedef typename TLUMatrix::const_row_iterator lu_row_iterator;
+			typedef typename TLUMatrix::value_type lu_block_type;
+
 			// apply iterator: c = LU^{-1}*d (damp is not used)
 			// L
-			for(size_t i=0; i < m_L.num_rows(); i++)
+			for(size_t i=0; i < L.num_rows(); i++)
 			{
 				// c[i] = d[i] - m_L[i]*c;
 				c[i] = d[i];
-				for(matrix_row_iterator it = m_L.begin_row(i); it != m_L.end_row(i); ++it)
+				for(lu_row_iterator it = L.begin_row(i); it != L.end_row(i); ++it)
 					MatMultAdd(c[i], 1.0, c[i], -1.0, it.value(), c[it.index()] );
 				// lii = 1.0.
 			}
@@ -393,13 +437,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			//
 			// last row diagonal U entry might be close to zero with corresponding zero rhs 
 			// when solving Navier Stokes system, therefore handle separately
-			if(m_U.num_rows() > 0)
+			if(U.num_rows() > 0)
 			{
-				size_t i=m_U.num_rows()-1;
-				matrix_row_iterator it = m_U.begin_row(i);
-				UG_ASSERT(it != m_U.end_row(i), i);
+				size_t i=U.num_rows()-1;
+				lu_row_iterator it = U.begin_row(i);
+				UG_ASSERT(it != U.end_row(i), i);
 				UG_ASSERT(it.index() == i, i);
-				block_type &uii = it.value();
+				const lu_block_type &uii = it.value();
 				vector_value s = c[i];
 				// check if diag part is significantly smaller than rhs
 				// This may happen when matrix is indefinite with one eigenvalue
@@ -421,17 +465,17 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			}
 
 			// handle all other rows
-			if(m_U.num_rows() > 1){
-				for(size_t i=m_U.num_rows()-2; ; i--)
+			if(U.num_rows() > 1){
+				for(size_t i=U.num_rows()-2; ; i--)
 				{
-					matrix_row_iterator it = m_U.begin_row(i);
-					UG_ASSERT(it != m_U.end_row(i), i);
+					lu_row_iterator it = U.begin_row(i);
+					UG_ASSERT(it != U.end_row(i), i);
 					UG_ASSERT(it.index() == i, i);
-					block_type &uii = it.value();
+					const lu_block_type &uii = it.value();
 
 					vector_value s = c[i];
 					++it; // skip diag
-					for(; it != m_U.end_row(i); ++it)
+					for(; it != U.end_row(i); ++it)
 						// s -= it.value() * c[it.index()];
 						MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()] );
 
@@ -446,6 +490,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 
 		virtual bool multi_apply(std::vector<vector_type> &vc, const std::vector<vector_type> &vd)
 		{
+			if(m_bSinglePrecision)
+			{
+				for(size_t e=0; e<vc.size(); e++)
+					if(applyLU(vc[e], vd[e]) == false) return false;
+				return true;
+			}
+
 			PROFILE_BEGIN_GROUP(ILUT_step, "ilut algebra");
 			// apply iterator: c = LU^{-1}*d (damp is not used)
 			// L
@@ -534,6 +585,8 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		vector_type c2;
 		matrix_type m_L;
 		matrix_type m_U;
+		single_matrix_type m_LSingle;
+		single_matrix_type m_USingle;
 		double m_eps;
 		bool m_info;
 		static const number m_small;
@@ -541,6 +594,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 		bool m_bSort;
 
 		bool m_bSortIsIdentity;
+		bool m_bSinglePrecision;
 };
 
 // define constant
@@ -34,6 +34,8 @@
 #define __UG__PRECONDITIONERS_H__
 
 #include "lib_algebra/operator/preconditioner/jacobi.h"
+#include "lib_algebra/operator/preconditioner/chebyshev.h"
+#include "lib_algebra/operator/preconditioner/aggregation_amg.h"
 #include "lib_algebra/operator/preconditioner/gauss_seidel.h"
 #include "lib_algebra/operator/preconditioner/ilu.h"
 #include "lib_algebra/operator/preconditioner/ilut.h"
@@ -99,10 +99,17 @@ public:
 	typedef typename TAlgebra::matrix_type matrix_type;
 
 	SchurInverseWithFullMatrix(SmartPtr<ILinearOperatorInverse<vector_type> > linOpInv )
+	: m_probingDistance(0), m_threshold(0.0)
 	{
 		m_linOpInv = linOpInv;
 	}
 
+	///	computes the Schur complement by probing (see SchurComplementOperator::set_probing_distance)
+	void set_probing_distance(size_t distance) { m_probingDistance = distance; }
+
+	///	drops entries smaller than threshold times the diagonal entry of their column
+	void set_threshold(double threshold) { m_threshold = threshold; }
+
 	virtual bool init(SmartPtr<SchurComplementOperator<TAlgebra> > op)
 	{
 		PROFILE_BEGIN(SchurInverseWithFullMatrix_init)
@@ -110,7 +117,8 @@ public:
 		m_exactSchurOp = make_sp(new MatrixOperator<matrix_type, vector_type>);
 
 		PROFILE_BEGIN(SchurInverseWithFullMatrix_compute_matrix)
-			op->compute_matrix(m_exactSchurOp->get_matrix());
+			op->set_probing_distance(m_probingDistance);
+			op->compute_matrix(m_exactSchurOp->get_matrix(), m_threshold);
 		PROFILE_END();
 
 		op->set_skeleton_debug(m_linOpInv);
@@ -134,6 +142,10 @@ public:
 	virtual std::string config_string() const
 	{
 		std::stringstream ss; ss << "SchurInverseWithFullMatrix\n";
+		if(m_probingDistance > 0)
+			ss << " Probing distance: " << m_probingDistance << "\n";
+		if(m_threshold > 0.0)
+			ss << " Threshold: " << m_threshold << "\n";
 		ss << " Solver: " << ConfigShift(m_linOpInv->config_string()) << "\n";
 		return ss.str();
 	}
@@ -145,6 +157,8 @@ public:
 protected:
 	SmartPtr<MatrixOperator<matrix_type, vector_type> > m_exactSchurOp;
 	SmartPtr<ILinearOperatorInverse<vector_type> > m_linOpInv;
+	size_t m_probingDistance;
+	double m_threshold;
 
 };
 
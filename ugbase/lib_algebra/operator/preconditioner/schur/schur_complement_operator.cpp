@@ -43,6 +43,8 @@
 // extern headers
 #include <cmath>
 #include <sstream>  // added for 'stringstream'
+#include <vector>
+#include <algorithm>
 
 // algebra types
 #include "lib_algebra/cpu_algebra_types.h"
@@ -332,6 +334,12 @@ compute_matrix(matrix_type &schur_matrix, double threshold)
 	try{
 	SCHUR_PROFILE_BEGIN(SCHUR_Op_compute_matrix);
 
+	if(m_probingDistance > 0)
+	{
+		compute_matrix_probing(schur_matrix, threshold);
+		return;
+	}
+
 	const int n_skeleton = sub_size(SD_SKELETON);
 
 	if (n_skeleton == 0) return;
@@ -395,6 +403,141 @@ compute_matrix(matrix_type &schur_matrix, double threshold)
 	}UG_CATCH_THROW("SchurComplementOperator::" << __FUNCTION__ << " failed")
 }
 
+/// collects all nodes with graph distance <= distance from node i (including i)
+static void CollectGraphNeighborhood(std::vector<size_t> &neighbors,
+		const std::vector<std::vector<size_t> > &graph, size_t i, size_t distance,
+		std::vector<size_t> &mark, size_t markValue)
+{
+	neighbors.clear();
+	neighbors.push_back(i);
+	mark[i] = markValue;
+	size_t levelBegin = 0;
+	for(size_t level=0; level<distance; level++)
+	{
+		const size_t levelEnd = neighbors.size();
+		for(size_t k=levelBegin; k<levelEnd; k++)
+		{
+			const std::vector<size_t> &adj = graph[neighbors[k]];
+			for(size_t l=0; l<adj.size(); l++)
+				if(mark[adj[l]] != markValue)
+				{
+					mark[adj[l]] = markValue;
+					neighbors.push_back(adj[l]);
+				}
+		}
+		levelBegin = levelEnd;
+	}
+}
+
+template <typename TAlgebra>
+void SchurComplementOperator<TAlgebra>::
+compute_matrix_probing(matrix_type &schur_matrix, double threshold)
+{
+	SCHUR_PROFILE_BEGIN(SCHUR_Op_compute_matrix_probing);
+
+	const size_t n_skeleton = sub_size(SD_SKELETON);
+	if (n_skeleton == 0) return;
+	schur_matrix.resize_and_clear(n_skeleton, n_skeleton);
+
+	matrix_type &mat = m_spOperator->get_matrix();
+	schur_matrix.set_layouts(m_slicing.get_slice_layouts(mat.layouts(), SD_SKELETON));
+	schur_matrix.set_storage_type(PST_ADDITIVE);
+
+//	skeleton graph: couplings in A_{Gamma,Gamma} and over one inner unknown
+	const matrix_type &Agg = sub_matrix(SD_SKELETON, SD_SKELETON);
+	const matrix_type &Agi = sub_matrix(SD_SKELETON, SD_INNER);
+	const matrix_type &Aig = sub_matrix(SD_INNER, SD_SKELETON);
+	std::vector<std::vector<size_t> > graph(n_skeleton);
+	for(size_t j=0; j<n_skeleton; j++)
+	{
+		std::vector<size_t> &adj = graph[j];
+		for(typename matrix_type::const_row_iterator it = Agg.begin_row(j); it != Agg.end_row(j); ++it)
+			adj.push_back(it.index());
+		for(typename matrix_type::const_row_iterator it = Agi.begin_row(j); it != Agi.end_row(j); ++it)
+			for(typename matrix_type::const_row_iterator it2 = Aig.begin_row(it.index());
+				it2 != Aig.end_row(it.index()); ++it2)
+				adj.push_back(it2.index());
+		std::sort(adj.begin(), adj.end());
+		adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+	}
+
+//	greedy coloring: columns i, k may share a color if no row is within the
+//	probing distance of both, i.e. if their distance is > 2*m_probingDistance
+	const size_t notColored = (size_t) -1;
+	std::vector<size_t> color(n_skeleton, notColored);
+	std::vector<size_t> mark(n_skeleton, notColored), neighbors, usedColors;
+	std::vector<bool> bUsed;
+	size_t numColors = 0;
+	for(size_t i=0; i<n_skeleton; i++)
+	{
+		CollectGraphNeighborhood(neighbors, graph, i, 2*m_probingDistance, mark, i);
+		bUsed.assign(numColors+1, false);
+		for(size_t k=0; k<neighbors.size(); k++)
+			if(color[neighbors[k]] != notColored)
+				bUsed[color[neighbors[k]]] = true;
+		size_t c=0;
+		while(bUsed[c]) c++;
+		color[i] = c;
+		if(c == numColors) numColors++;
+	}
+
+	std::vector<std::vector<size_t> > colorClass(numColors);
+	for(size_t i=0; i<n_skeleton; i++)
+		colorClass[color[i]].push_back(i);
+
+	UG_DLOG(SchurDebug, 1, "SchurComplementOperator: probing with " << numColors
+			<< " colors for " << n_skeleton << " skeleton unknowns (distance "
+			<< m_probingDistance << ").\n");
+
+	vector_type sol; sol.create(n_skeleton);
+	vector_type rhs; rhs.create(n_skeleton);
+	const size_t blockSize = GetSize(rhs[0]);
+
+	PARALLEL_PROGRESS_START(prog, numColors, "computing Schur Matrix by probing ( " << n_skeleton
+			<< " unknowns, " << numColors << " colors )", mat.layouts()->proc_comm().size());
+
+	for(size_t c=0; c<numColors; c++)
+	{
+		PROGRESS_UPDATE(prog, c);
+		const std::vector<size_t> &cls = colorClass[c];
+		for(size_t bi=0; bi<blockSize; bi++)
+		{
+			sol.set(0.0);
+			for(size_t k=0; k<cls.size(); k++)
+				BlockRef(sol[cls[k]], bi) = 1.0;
+			apply(rhs, sol);
+
+		//	the rows near column i only see the probe of column i
+			for(size_t k=0; k<cls.size(); k++)
+			{
+				const size_t i = cls[k];
+				double minNorm = threshold>0.0 ? threshold*BlockNorm(rhs[i]) : 0.0;
+				CollectGraphNeighborhood(neighbors, graph, i, m_probingDistance, mark, n_skeleton+i);
+				for(size_t l=0; l<neighbors.size(); l++)
+				{
+					const size_t j = neighbors[l];
+					if(rhs[j] != 0.0 && (minNorm == 0.0 || BlockNorm(rhs[j]) > minNorm))
+					{
+						typename matrix_type::value_type &m = schur_matrix(j, i);
+						for(size_t bj=0; bj<blockSize; bj++)
+							BlockRef(m, bj, bi) = BlockRef(rhs[j], bj);
+					}
+				}
+			}
+		}
+	}
+
+	PROGRESS_UPDATE(prog, numColors);
+	{
+		SCHUR_PROFILE_BEGIN(SCHUR_Op_compute_matrix_wait);
+		mat.layouts()->proc_comm().barrier();
+	}
+	PARALLEL_PROGRESS_FINISH(prog);
+
+	if(m_spDebugWriterSkeleton.valid())
+		m_spDebugWriterSkeleton->write_matrix(schur_matrix, "SchurComplement.mat");
+}
+
 template <typename TAlgebra>
 template<int dim>
 void SchurComplementOperator<TAlgebra>::
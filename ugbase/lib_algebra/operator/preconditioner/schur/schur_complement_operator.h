@@ -85,7 +85,8 @@ class SchurComplementOperator
 	SchurComplementOperator(SmartPtr<MatrixOperator<matrix_type, vector_type> > Alocal,
 							SlicingData::slice_desc_type_vector &sdv)
 	: m_spOperator(Alocal),
-	  m_slicing(sdv)
+	  m_slicing(sdv),
+	  m_probingDistance(0)
 	{
 		m_op[0][0] = make_sp(new MatrixOperator<matrix_type, vector_type>());
 		m_op[0][1] = make_sp(new MatrixOperator<matrix_type, vector_type>());
@@ -140,6 +141,17 @@ class SchurComplementOperator
 	void debug_compute_matrix();
 
 	void compute_matrix(matrix_type &schur_matrix, double threshold=0.0);
+
+	/**
+	 * sets the probing distance used by compute_matrix. If distance > 0, the
+	 * Schur complement is assumed to couple only skeleton unknowns within
+	 * this distance in the skeleton graph (couplings in A_{Gamma,Gamma} and
+	 * over one inner unknown). Columns which do not share a row in this
+	 * pattern are colored alike and computed with one application of the
+	 * operator. 0 (default) applies the operator to every unit vector.
+	 */
+	void set_probing_distance(size_t distance)
+	{ m_probingDistance = distance; }
 	virtual void set_debug(SmartPtr<IDebugWriter<algebra_type> > spDebugWriter);
 
 	template<typename T>
@@ -180,6 +192,12 @@ protected:
 
 	template<int dim> void set_debug_dim();
 
+	// computes the Schur complement by probing with colored unit vectors
+	void compute_matrix_probing(matrix_type &schur_matrix, double threshold);
+
+	// skeleton graph distance for probing (0 = no probing)
+	size_t m_probingDistance;
+
 	SmartPtr<AlgebraDebugWriter<algebra_type> > m_spDebugWriterInner;
 	SmartPtr<AlgebraDebugWriter<algebra_type> > m_spDebugWriterSkeleton;
 	SmartPtr<IDebugWriter<algebra_type> > m_spDebugWriter;
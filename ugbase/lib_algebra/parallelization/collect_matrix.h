@@ -36,6 +36,7 @@
 #include "parallel_nodes.h"
 #include "serialize_interfaces.h"
 #include "common/debug_print.h"
+#include "lib_algebra/common/stl_debug.h"
 
 namespace ug{
 
@@ -226,6 +227,114 @@ void ReceiveMatrix(const matrix_type &A, matrix_type &M, IndexLayout &verticalMa
 	//PrintLayout(processCommunicator, communicator, masterLayout, slaveLayout);
 }
 
+/// writes the entries of v into stream as one block of raw bytes
+template<typename T>
+inline void SerializeRawArray(BinaryBuffer &stream, const std::vector<T> &v)
+{
+	if(!v.empty())
+		stream.write((const char*)&v[0], sizeof(T)*v.size());
+}
+
+/// reads n entries written by SerializeRawArray into v
+template<typename T>
+inline void DeserializeRawArray(BinaryBuffer &stream, std::vector<T> &v, size_t n)
+{
+	v.resize(n);
+	if(n > 0)
+		stream.read((char*)&v[0], sizeof(T)*n);
+}
+
+/**
+ * serializes the matrix A in CSR format.
+ * In contrast to SerializeRow, the global algebra ids are written only once per
+ * local index, and the column indices refer to this table. The ids, row
+ * pointers and column indices are written as raw arrays.
+ * Layout of the stream: numRows, id procs[numRows], id indices[numRows],
+ * rowStart[numRows+1], cols[nnz], values[nnz].
+ * \sa DeserializeMatrixCSRIDs, DeserializeMatrixCSRRows
+ */
+template<typename matrix_type>
+void SerializeMatrixCSR(BinaryBuffer &stream, const matrix_type &A, const std::vector<AlgebraID> &globalIDs)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	const size_t numRows = A.num_rows();
+	UG_COND_THROW(globalIDs.size() != numRows, "size of global ids (" << globalIDs.size()
+	              << ") does not match number of rows (" << numRows << ")");
+
+	std::vector<int> idProcs(numRows);
+	std::vector<size_t> idIndices(numRows);
+	std::vector<size_t> rowStart(numRows+1);
+	rowStart[0] = 0;
+	for(size_t i=0; i<numRows; i++)
+	{
+		idProcs[i] = globalIDs[i].master_proc();
+		idIndices[i] = globalIDs[i].index_on_master();
+		rowStart[i+1] = rowStart[i] + A.num_connections(i);
+	}
+
+	std::vector<size_t> cols;
+	cols.reserve(rowStart[numRows]);
+	for(size_t i=0; i<numRows; i++)
+		for(typename matrix_type::const_row_iterator conn = A.begin_row(i);
+				conn != A.end_row(i); ++conn)
+			cols.push_back(conn.index());
+
+	Serialize(stream, numRows);
+	SerializeRawArray(stream, idProcs);
+	SerializeRawArray(stream, idIndices);
+	SerializeRawArray(stream, rowStart);
+	SerializeRawArray(stream, cols);
+	for(size_t i=0; i<numRows; i++)
+		for(typename matrix_type::const_row_iterator conn = A.begin_row(i);
+				conn != A.end_row(i); ++conn)
+			Serialize(stream, conn.value());
+}
+
+/// reads the global algebra ids of a matrix written by SerializeMatrixCSR
+inline void DeserializeMatrixCSRIDs(BinaryBuffer &stream, std::vector<AlgebraID> &globalIDs)
+{
+	size_t numRows;
+	Deserialize(stream, numRows);
+
+	std::vector<int> idProcs;
+	std::vector<size_t> idIndices;
+	DeserializeRawArray(stream, idProcs, numRows);
+	DeserializeRawArray(stream, idIndices, numRows);
+
+	globalIDs.resize(numRows);
+	for(size_t i=0; i<numRows; i++)
+		globalIDs[i] = AlgebraID(idProcs[i], idIndices[i]);
+}
+
+/**
+ * reads the rows of a matrix written by SerializeMatrixCSR and adds them to M.
+ * Has to be called after DeserializeMatrixCSRIDs on the same stream.
+ * \param localIndex	local index in M for every index of the sent matrix
+ */
+template<typename matrix_type>
+void DeserializeMatrixCSRRows(BinaryBuffer &stream, matrix_type &M, const std::vector<size_t> &localIndex)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	const size_t numRows = localIndex.size();
+
+	std::vector<size_t> rowStart, cols;
+	DeserializeRawArray(stream, rowStart, numRows+1);
+	DeserializeRawArray(stream, cols, rowStart[numRows]);
+
+	stdvector<typename matrix_type::connection> cons;
+	for(size_t i=0; i<numRows; i++)
+	{
+		cons.resize(rowStart[i+1] - rowStart[i]);
+		for(size_t k=0; k<cons.size(); k++)
+		{
+			cons[k].iIndex = localIndex[cols[rowStart[i]+k]];
+			Deserialize(stream, cons[k].dValue);
+		}
+		if(cons.size())
+			M.add_matrix_row(localIndex[i], &cons[0], cons.size());
+	}
+}
+
 /**
  * 1. constructs global indices
  * 2. for pid != proc_id(0) :
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_ALGEBRA__HIERARCHICAL_AGGLOMERATION_H_
+#define __H__LIB_ALGEBRA__HIERARCHICAL_AGGLOMERATION_H_
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "pcl/pcl.h"
+#include "pcl/pcl_util.h"
+#include "collect_matrix.h"
+#include "parallelization_util.h"
+#include "communication_policies.h"
+
+namespace ug{
+
+/**
+ * Agglomerates a distributed matrix in several stages onto a subset of the
+ * processes.
+ *
+ * In every stage, the participating processes are split into groups of
+ * consecutive processes (with respect to the process communicator of the
+ * matrix). The members of a group send their part of the matrix in CSR format
+ * (SerializeMatrixCSR) to the first process of the group, the group leader,
+ * which merges the parts using the global algebra ids. Only the leaders take
+ * part in the next stage. This is repeated until at most numTargetProcs
+ * processes are left. With group size 0 all processes send directly to the
+ * first process, which is the same as CollectMatrixOnOneProc.
+ *
+ * If more than one process is left, the collected matrices are connected by
+ * horizontal master/slave layouts and a process communicator containing only
+ * the remaining processes, so that a parallel solver can be applied to them.
+ * An index is master on the remaining process that holds the original master.
+ *
+ * Vectors are gathered (additive) and broadcasted (consistent) along the same
+ * tree.
+ */
+template<typename TAlgebra>
+class HierarchicalAgglomeration
+{
+	public:
+	// 	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	// 	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	public:
+		HierarchicalAgglomeration()
+			: m_groupSize(0), m_numTargetProcs(1), m_numInitialRows(0), m_bParticipate(false)
+		{}
+
+	///	number of processes that are agglomerated onto one in each stage (0 = all in one stage)
+		void set_group_size(size_t groupSize) {m_groupSize = groupSize;}
+
+	///	number of processes which keep the agglomerated matrix
+		void set_num_target_procs(size_t numProcs)
+		{
+			UG_COND_THROW(numProcs == 0, "number of target processes must be > 0.");
+			m_numTargetProcs = numProcs;
+		}
+
+	/**
+	 * collects the distributed matrix A. Has to be called on all processes of
+	 * the process communicator of A.
+	 * \param A				(in) distributed matrix
+	 * \param collectedA	(out) agglomerated matrix, empty if this process does not participate
+	 */
+		void collect_matrix(const matrix_type &A, matrix_type &collectedA);
+
+	///	returns if this process keeps a part of the agglomerated matrix
+		bool participates() const {return m_bParticipate;}
+
+	///	returns the number of processes keeping the agglomerated matrix
+		size_t num_target_procs() const {return m_vFinalProcs.size();}
+
+	///	layouts of the agglomerated matrix
+		SmartPtr<AlgebraLayouts> layouts() const {return m_spLayouts;}
+
+	///	resizes collectedVec and sets the layouts of the agglomerated matrix
+		void init_collected_vector(vector_type &collectedVec) const;
+
+	///	sums the additive vector vec into collectedVec on the participating processes
+		void gather_vector(vector_type &collectedVec, const vector_type &vec);
+
+	///	copies the consistent vector collectedVec back to the distributed vector vec
+		void broadcast_vector(vector_type &vec, const vector_type &collectedVec);
+
+	protected:
+	///	merges the matrices of the group members into collectedA
+		void receive_group(matrix_type &collectedA, const std::vector<int> &members);
+
+	///	sends collectedA to the group leader
+		void send_to_leader(const matrix_type &collectedA, int leader);
+
+	///	creates the horizontal layouts between the remaining processes
+		void create_target_layouts(const pcl::ProcessCommunicator &pc,
+		                           const pcl::ProcessCommunicator &targetComm);
+
+	protected:
+	///	one agglomeration stage of this process
+		struct Stage
+		{
+			bool bLeader;			///< true if this process received in this stage
+			IndexLayout layout;		///< master layout to members or slave layout to leader
+			size_t size;			///< number of indices after this stage
+		};
+
+	///	the stages this process took part in
+		std::vector<Stage> m_vStage;
+
+	///	group sizes used in the stages (same on all processes)
+		std::vector<size_t> m_vGroupSize;
+
+	///	processes keeping the agglomerated matrix
+		std::vector<int> m_vFinalProcs;
+
+	///	global algebra ids of the current local indices and the inverse mapping
+		std::vector<AlgebraID> m_vGlobalID;
+		std::map<AlgebraID, size_t> m_mapGlobalToLocal;
+
+		size_t m_groupSize;
+		size_t m_numTargetProcs;
+		size_t m_numInitialRows;
+		bool m_bParticipate;
+
+		SmartPtr<AlgebraLayouts> m_spLayouts;
+		pcl::InterfaceCommunicator<IndexLayout> m_com;
+
+	///	work vector passed along the tree
+		vector_type m_work;
+};
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+collect_matrix(const matrix_type &A, matrix_type &collectedA)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	try{
+	m_vStage.clear();
+	m_vGroupSize.clear();
+	m_mapGlobalToLocal.clear();
+	m_numInitialRows = A.num_rows();
+
+	const pcl::ProcessCommunicator &pc = A.layouts()->proc_comm();
+
+//	global ids of the local indices
+	GenerateGlobalAlgebraIDs(m_com, m_vGlobalID, A.num_rows(),
+	                         A.layouts()->master(), A.layouts()->slave());
+	for(size_t i=0; i<m_vGlobalID.size(); i++)
+		m_mapGlobalToLocal[m_vGlobalID[i]] = i;
+
+	collectedA = A;
+
+	std::vector<int> procs(pc.size());
+	for(size_t i=0; i<pc.size(); i++)
+		procs[i] = pc.get_proc_id(i);
+	size_t pos = pc.get_local_proc_id();
+	bool bActive = true;
+
+	while(procs.size() > m_numTargetProcs)
+	{
+	//	groups must not be so large that less than m_numTargetProcs remain
+		const size_t maxGroupSize = (procs.size() + m_numTargetProcs - 1) / m_numTargetProcs;
+		size_t groupSize = (m_groupSize < 2) ? procs.size() : m_groupSize;
+		groupSize = std::min(groupSize, maxGroupSize);
+		m_vGroupSize.push_back(groupSize);
+
+		std::vector<int> leaders;
+		for(size_t i=0; i<procs.size(); i+=groupSize)
+			leaders.push_back(procs[i]);
+
+		if(bActive)
+		{
+			const size_t groupBegin = (pos / groupSize) * groupSize;
+			const size_t groupEnd = std::min(groupBegin + groupSize, procs.size());
+			if(pos == groupBegin)
+			{
+				std::vector<int> members(procs.begin() + groupBegin + 1, procs.begin() + groupEnd);
+				receive_group(collectedA, members);
+			}
+			else
+			{
+				send_to_leader(collectedA, procs[groupBegin]);
+				bActive = false;
+			}
+			pos = pos / groupSize;
+		}
+		procs.swap(leaders);
+	}
+
+	m_vFinalProcs = procs;
+	m_bParticipate = bActive;
+
+//	the remaining processes get an own communicator (collective on pc)
+	pcl::ProcessCommunicator targetComm = pc.create_sub_communicator(m_bParticipate);
+
+	if(!m_bParticipate)
+	{
+		collectedA.resize_and_clear(0, 0);
+		m_mapGlobalToLocal.clear();
+		m_spLayouts = CreateLocalAlgebraLayouts();
+	}
+	else if(m_vFinalProcs.size() == 1)
+		m_spLayouts = CreateLocalAlgebraLayouts();
+	else
+		create_target_layouts(pc, targetComm);
+
+	collectedA.set_layouts(m_spLayouts);
+	}UG_CATCH_THROW("HierarchicalAgglomeration::" << __FUNCTION__ << " failed");
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+send_to_leader(const matrix_type &collectedA, int leader)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	BinaryBuffer stream;
+	SerializeMatrixCSR(stream, collectedA, m_vGlobalID);
+
+	Stage stage;
+	stage.bLeader = false;
+	stage.size = collectedA.num_rows();
+	m_vStage.push_back(stage);
+	IndexLayout::Interface &interface = m_vStage.back().layout.interface(leader);
+	for(size_t i=0; i<collectedA.num_rows(); i++)
+		interface.push_back(i);
+
+	UG_DLOG(LIB_ALG_AMG, 3, "HierarchicalAgglomeration: sending " << stream.write_pos()
+			<< " bytes to " << leader << "\n");
+	m_com.send_raw(leader, stream.buffer(), stream.write_pos(), false);
+	m_com.communicate();
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+receive_group(matrix_type &collectedA, const std::vector<int> &members)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	std::vector<BinaryBuffer> streams(members.size());
+	for(size_t m=0; m<members.size(); m++)
+		m_com.receive_raw(members[m], streams[m]);
+	m_com.communicate();
+
+	Stage stage;
+	stage.bLeader = true;
+	m_vStage.push_back(stage);
+	IndexLayout &masterLayout = m_vStage.back().layout;
+
+//	map the global ids of all members to local indices, new ids are appended
+	std::vector<std::vector<size_t> > vLocalIndex(members.size());
+	std::vector<AlgebraID> ids;
+	for(size_t m=0; m<members.size(); m++)
+	{
+		DeserializeMatrixCSRIDs(streams[m], ids);
+		std::vector<size_t> &localIndex = vLocalIndex[m];
+		localIndex.resize(ids.size());
+		IndexLayout::Interface &interface = masterLayout.interface(members[m]);
+		for(size_t i=0; i<ids.size(); i++)
+		{
+			std::pair<std::map<AlgebraID, size_t>::iterator, bool> res =
+				m_mapGlobalToLocal.insert(std::make_pair(ids[i], m_vGlobalID.size()));
+			if(res.second)
+				m_vGlobalID.push_back(ids[i]);
+			localIndex[i] = res.first->second;
+			interface.push_back(localIndex[i]);
+		}
+	}
+
+//	add the rows
+	collectedA.resize_and_keep_values(m_vGlobalID.size(), m_vGlobalID.size());
+	for(size_t m=0; m<members.size(); m++)
+		DeserializeMatrixCSRRows(streams[m], collectedA, vLocalIndex[m]);
+
+	m_vStage.back().size = m_vGlobalID.size();
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+create_target_layouts(const pcl::ProcessCommunicator &pc,
+                      const pcl::ProcessCommunicator &targetComm)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	m_spLayouts = SmartPtr<AlgebraLayouts>(new AlgebraLayouts);
+	m_spLayouts->clear();
+	m_spLayouts->proc_comm() = targetComm;
+
+//	an index is owned by the remaining process which agglomerated its original master
+	typedef std::vector<std::pair<AlgebraID, size_t> > IDList;
+	std::map<int, IDList> slaveIDs;
+	for(size_t i=0; i<m_vGlobalID.size(); i++)
+	{
+		size_t pos = pc.get_local_proc_id(m_vGlobalID[i].master_proc());
+		for(size_t s=0; s<m_vGroupSize.size(); s++)
+			pos /= m_vGroupSize[s];
+		const int owner = m_vFinalProcs[pos];
+		if(owner != pcl::ProcRank())
+			slaveIDs[owner].push_back(std::make_pair(m_vGlobalID[i], i));
+	}
+
+//	slave interfaces are sorted by global id, the owner gets the ids in that order
+	std::vector<int> sendTo;
+	std::vector<BinaryBuffer> sendStreams(slaveIDs.size());
+	size_t k=0;
+	for(typename std::map<int, IDList>::iterator it = slaveIDs.begin(); it != slaveIDs.end(); ++it, ++k)
+	{
+		IDList &list = it->second;
+		std::sort(list.begin(), list.end());
+		IndexLayout::Interface &interface = m_spLayouts->slave().interface(it->first);
+		std::vector<AlgebraID> ids(list.size());
+		for(size_t i=0; i<list.size(); i++)
+		{
+			interface.push_back(list[i].second);
+			ids[i] = list[i].first;
+		}
+		Serialize(sendStreams[k], ids);
+		m_com.send_raw(it->first, sendStreams[k].buffer(), sendStreams[k].write_pos(), false);
+		sendTo.push_back(it->first);
+	}
+
+	std::vector<int> recvFrom;
+	pcl::CommunicateInvolvedProcesses(recvFrom, sendTo, targetComm);
+	std::vector<BinaryBuffer> recvStreams(recvFrom.size());
+	for(size_t i=0; i<recvFrom.size(); i++)
+		m_com.receive_raw(recvFrom[i], recvStreams[i]);
+	m_com.communicate();
+
+	for(size_t i=0; i<recvFrom.size(); i++)
+	{
+		std::vector<AlgebraID> ids;
+		Deserialize(recvStreams[i], ids);
+		IndexLayout::Interface &interface = m_spLayouts->master().interface(recvFrom[i]);
+		for(size_t j=0; j<ids.size(); j++)
+		{
+			std::map<AlgebraID, size_t>::iterator it = m_mapGlobalToLocal.find(ids[j]);
+			UG_COND_THROW(it == m_mapGlobalToLocal.end(), "Process " << recvFrom[i]
+			              << " has a slave of " << ids[j] << ", which is not present here.");
+			interface.push_back(it->second);
+		}
+	}
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+init_collected_vector(vector_type &collectedVec) const
+{
+	collectedVec.resize(m_bParticipate ? m_vGlobalID.size() : 0);
+	collectedVec.set_layouts(m_spLayouts);
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+gather_vector(vector_type &collectedVec, const vector_type &vec)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	try{
+	UG_COND_THROW(vec.size() != m_numInitialRows, "vector size " << vec.size()
+	              << " does not match agglomerated matrix (" << m_numInitialRows << ")");
+
+//	the summation along the tree needs additive values
+	m_work.resize(vec.size());
+	for(size_t i=0; i<vec.size(); i++)
+		m_work[i] = vec[i];
+	m_work.set_layouts(vec.layouts());
+	m_work.set_storage_type(vec.get_storage_type());
+	m_work.change_storage_type(PST_ADDITIVE);
+
+	for(size_t s=0; s<m_vStage.size(); s++)
+	{
+		Stage &stage = m_vStage[s];
+		if(stage.bLeader)
+		{
+			const size_t oldSize = m_work.size();
+			m_work.resize(stage.size);
+			for(size_t i=oldSize; i<stage.size; i++)
+				m_work[i] = 0.0;
+			ComPol_VecAdd<vector_type> compolAdd(&m_work);
+			m_com.receive_data(stage.layout, compolAdd);
+			m_com.communicate();
+		}
+		else
+		{
+			ComPol_VecAdd<vector_type> compolAdd(&m_work);
+			m_com.send_data(stage.layout, compolAdd);
+			m_com.communicate();
+		}
+	}
+
+	if(m_bParticipate)
+	{
+		init_collected_vector(collectedVec);
+		for(size_t i=0; i<collectedVec.size(); i++)
+			collectedVec[i] = m_work[i];
+		collectedVec.set_storage_type(PST_ADDITIVE);
+	}
+	}UG_CATCH_THROW("HierarchicalAgglomeration::" << __FUNCTION__ << " failed");
+}
+
+
+template<typename TAlgebra>
+void HierarchicalAgglomeration<TAlgebra>::
+broadcast_vector(vector_type &vec, const vector_type &collectedVec)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	try{
+	if(m_bParticipate)
+	{
+		m_work.resize(collectedVec.size());
+		for(size_t i=0; i<collectedVec.size(); i++)
+			m_work[i] = collectedVec[i];
+		m_work.set_layouts(m_spLayouts);
+		m_work.set_storage_type(collectedVec.get_storage_type());
+		m_work.change_storage_type(PST_CONSISTENT);
+	}
+	else
+		m_work.resize(m_vStage.empty() ? m_numInitialRows : m_vStage.back().size);
+
+	for(size_t s=m_vStage.size(); s-- > 0; )
+	{
+		Stage &stage = m_vStage[s];
+		ComPol_VecCopy<vector_type> compolCopy(&m_work);
+		if(stage.bLeader)
+			m_com.send_data(stage.layout, compolCopy);
+		else
+			m_com.receive_data(stage.layout, compolCopy);
+		m_com.communicate();
+	}
+
+	UG_COND_THROW(vec.size() != m_numInitialRows, "vector size " << vec.size()
+	              << " does not match agglomerated matrix (" << m_numInitialRows << ")");
+	for(size_t i=0; i<vec.size(); i++)
+		vec[i] = m_work[i];
+	vec.set_storage_type(PST_CONSISTENT);
+	}UG_CATCH_THROW("HierarchicalAgglomeration::" << __FUNCTION__ << " failed");
+}
+
+} // namespace ug
+
+#endif /* __H__LIB_ALGEBRA__HIERARCHICAL_AGGLOMERATION_H_ */
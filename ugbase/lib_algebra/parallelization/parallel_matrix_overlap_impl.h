@@ -46,6 +46,7 @@
 
 #include "row_sending_scheme.h"
 #include "new_layout_creator.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
 
 namespace ug
 {
@@ -456,6 +457,26 @@ bool MakeConsistent(const ParallelMatrix<matrix_type> &_mat, ParallelMatrix<matr
 	return b;
 }
 
+///	MakeConsistent for operators, that may already provide the complete interface rows
+/**
+ * If the operator has been assembled with complete interface rows (see
+ * MatrixOperator::consistent_rows_matrix), these are copied without any
+ * communication. Otherwise the rows are exchanged as in MakeConsistent.
+ */
+template<typename matrix_type, typename X, typename Y>
+bool MakeConsistent(const MatrixOperator<ParallelMatrix<matrix_type>, X, Y> &op,
+                    ParallelMatrix<matrix_type> &newMat)
+{
+	ConstSmartPtr<ParallelMatrix<matrix_type> > spRows = op.consistent_rows_matrix();
+	if(spRows.valid())
+	{
+		PROFILE_BEGIN_GROUP(MakeConsistent_CopyAssembledRows, "algebra");
+		newMat = *spRows;
+		return true;
+	}
+	return MakeConsistent(static_cast<const ParallelMatrix<matrix_type>&>(op), newMat);
+}
+
 /*
 template<typename matrix_type>
 bool MakeFullRowsMatrix(const ParallelMatrix<matrix_type> &mat, ParallelMatrix<matrix_type> &newMat)
@@ -38,6 +38,7 @@
 #include "common/common.h" // for UGError
 // additions for profiling (14042011ih)
 #include "common/profiler/profiler.h"
+#include "common/profiler/solver_telemetry.h"
 #define PROFILE_PARALLEL_VECTOR
 #ifdef PROFILE_PARALLEL_VECTOR
 #define PARVEC_PROFILE_FUNC()		PROFILE_FUNC()
@@ -132,6 +133,8 @@ change_storage_type(ParallelStorageType type)
 		UG_THROW("ParallelVector::change_storage_type: No "
 					"layouts given but trying to change type.")
 
+	SOLVER_TELEMETRY_BEGIN(tsHalo, "halo_exchange");
+
 	// else switch to that type
 	switch(type)
 	{
@@ -246,6 +249,7 @@ inline
 number ParallelVector<TVector>::norm() const
 {
 	PROFILE_FUNC_GROUP("algebra parallelization");
+	SOLVER_TELEMETRY_BEGIN(tsDot, "dot");
 	// 	step 1: make vector d additive unique
 	if(!const_cast<ParallelVector<TVector>*>(this)->change_storage_type(PST_UNIQUE))
 		UG_THROW("ParallelVector::norm(): Cannot change"
@@ -257,11 +261,13 @@ number ParallelVector<TVector>::norm() const
 
 	// 	step 3: sum squared local norms
 	PARVEC_PROFILE_BEGIN(ParVec_norm_allreduce);
+	SOLVER_TELEMETRY_BEGIN(tsAllreduce, "allreduce");
 	double tNormGlobal;
 	if(layouts()->proc_comm().empty())
 		tNormGlobal = tNormLocal;
 	else
 		tNormGlobal = layouts()->proc_comm().allreduce(tNormLocal, PCL_RO_SUM);
+	SOLVER_TELEMETRY_END(tsAllreduce);
 	PARVEC_PROFILE_END();
 
 	// 	step 4: return global norm ( = square root of summed squared local norms)
@@ -273,6 +279,7 @@ inline
 number ParallelVector<TVector>::dotprod(const this_type& v)
 {
 	PROFILE_FUNC_GROUP("algebra parallelization");
+	SOLVER_TELEMETRY_BEGIN(tsDot, "dot");
 	// 	step 0: check that storage type is given
 	if(this->has_storage_type(PST_UNDEFINED) || v.has_storage_type(PST_UNDEFINED))
 	{
@@ -316,11 +323,13 @@ number ParallelVector<TVector>::dotprod(const this_type& v)
 	double tSumGlobal;
 
 	// 	step 4: sum global contributions
+	SOLVER_TELEMETRY_BEGIN(tsAllreduce, "allreduce");
 	if(layouts()->proc_comm().empty())
 		tSumGlobal = tSumLocal;
 	else
 		layouts()->proc_comm().allreduce(&tSumLocal, &tSumGlobal, 1,
 		                                PCL_DT_DOUBLE, PCL_RO_SUM);
+	SOLVER_TELEMETRY_END(tsAllreduce);
 
 	// 	step 5: return result
 	return tSumGlobal;
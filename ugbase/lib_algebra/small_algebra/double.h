@@ -66,6 +66,19 @@ inline number BlockNorm2(const number &a)
 	return a*a;
 }
 
+//	single precision values are used for preconditioner matrices
+template <>
+inline number BlockNorm(const float &a)
+{
+	return a>0 ? a : -a;
+}
+
+template <>
+inline number BlockNorm2(const float &a)
+{
+	return (number)a*a;
+}
+
 //////////////////////////////////////////////////////
 // get/set specialization for numbers
 
@@ -120,6 +120,15 @@ public:
 		UG_COND_THROW(info != 0, "DenseMatrixInverse::mat_mult: getrs failed.");
 	}
 
+	//! solves for numRHS right hand sides stored column by column in pRHS
+	void apply_multi(double *pRHS, size_t numRHS) const
+	{
+		if(num_rows() == 0 || numRHS == 0) return;
+		int info = getrs(ModeNoTrans, num_rows(), numRHS, &densemat(0,0), num_rows(), &interchange[0], pRHS, num_rows());
+		(void) info;
+		UG_COND_THROW(info != 0, "DenseMatrixInverse::apply_multi: getrs failed.");
+	}
+
 	// todo: implement operator *=
 
 	template<typename T> friend std::ostream &operator << (std::ostream &out, const DenseMatrixInverse<T> &mat);
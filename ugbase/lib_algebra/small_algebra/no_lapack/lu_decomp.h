@@ -278,6 +278,21 @@ public:
 			SolveLU(densemat, vec, &interchange[0]);
 	}
 
+	//! solves for numRHS right hand sides stored column by column in pRHS
+	void apply_multi(double *pRHS, size_t numRHS) const
+	{
+		const size_t n = num_rows();
+		if(interchange.empty()) return;
+		DenseVector<VariableArray1<double> > vec;
+		vec.resize(n);
+		for(size_t k=0; k<numRHS; k++)
+		{
+			for(size_t i=0; i<n; i++) vec[i] = pRHS[k*n+i];
+			SolveLU(densemat, vec, &interchange[0]);
+			for(size_t i=0; i<n; i++) pRHS[k*n+i] = vec[i];
+		}
+	}
+
 	// todo: implem
 
 	// todo: implement operator *=
@@ -124,6 +124,20 @@ inline void AddMult(DenseMatrix<A> &dest, const DenseMatrix<B> &mA, const DenseM
 		}
 }
 
+// dest -= mA*mB
+template<typename A, typename B, typename C>
+inline void SubMult(DenseMatrix<A> &dest, const DenseMatrix<B> &mA, const DenseMatrix<C> &mB)
+{
+	UG_ASSERT(mA.num_cols() == mB.num_rows(), "");
+	UG_ASSERT(dest.num_rows()==mA.num_rows() && dest.num_cols()==mB.num_cols(), "");
+	for(size_t r=0; r < mA.num_rows(); r++)
+		for(size_t c=0; c < mB.num_cols(); c++)
+		{
+			for(size_t k=0; k < mB.num_rows(); k++)
+				SubMult(dest(r, c), mA(r, k), mB(k, c));
+		}
+}
+
 
 
 // dest -= b*vec
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
+#define __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
+
+#include "densematrix.h"
+#include "densevector.h"
+#include "densematrix_inverse.h"
+#include "../storage/fixed_array.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Kernels for the fixed size blocks of CPUBlockAlgebra<N>, i.e.
+ * DenseMatrix<FixedArray2<double, N, N> > and DenseVector<FixedArray1<double, N> >.
+ *
+ * The generic DenseMatrix operations work entry-wise through the
+ * (number, number) overloads of MatMultAdd, AddMult etc. and create
+ * temporaries for every block product. Here, the block size is a compile time
+ * constant and the entries are accessed on the contiguous storage, so that
+ * the loops can be unrolled and vectorized by the compiler. The overloads
+ * are more specialized than the generic templates and are therefore picked
+ * up by SparseMatrix::axpy, the Gauss-Seidel steps and ILU without changes
+ * at the call sites.
+ *
+ * Inversion of blocks with N > 3 is done by a LU decomposition with partial
+ * pivoting on the stack instead of calling LAPACK for every block.
+ */
+
+namespace ug{
+
+/// \addtogroup small_algebra
+/// \{
+
+///	index of entry (r,c) in the storage of a fixed NxN block
+template<size_t N, eMatrixOrdering TOrdering>
+inline size_t FixedBlockIndex(size_t r, size_t c)
+{
+	return (TOrdering == RowMajor) ? r*N + c : r + c*N;
+}
+
+///	computes s += beta * A * w for a NxN block A stored in a
+template<size_t N, eMatrixOrdering TOrdering>
+inline void FixedBlockMatMultAdd(double *s, const double beta, const double *a, const double *w)
+{
+	if(TOrdering == ColMajor)
+	{
+		for(size_t c = 0; c < N; ++c)
+		{
+			const double wc = beta * w[c];
+			const double *col = a + c*N;
+			for(size_t r = 0; r < N; ++r)
+				s[r] += col[r] * wc;
+		}
+	}
+	else
+	{
+		for(size_t r = 0; r < N; ++r)
+		{
+			const double *row = a + r*N;
+			double t = 0.0;
+			for(size_t c = 0; c < N; ++c)
+				t += row[c] * w[c];
+			s[r] += beta * t;
+		}
+	}
+}
+
+///	computes s = A * B for NxN blocks A, B (same ordering as s)
+template<size_t N, eMatrixOrdering TOrdering>
+inline void FixedBlockMatMat(double *s, const double *a, const double *b)
+{
+	for(size_t i = 0; i < N*N; ++i) s[i] = 0.0;
+	for(size_t r = 0; r < N; ++r)
+		for(size_t k = 0; k < N; ++k)
+		{
+			const double ark = a[FixedBlockIndex<N, TOrdering>(r, k)];
+			for(size_t c = 0; c < N; ++c)
+				s[FixedBlockIndex<N, TOrdering>(r, c)] += ark * b[FixedBlockIndex<N, TOrdering>(k, c)];
+		}
+}
+
+/**
+ * solves A x = b in place by Gaussian elimination with partial pivoting.
+ * \param a		the matrix in row major ordering (overwritten)
+ * \param b		right hand side on entry, solution on exit
+ * \return false if A is singular
+ */
+template<size_t N>
+inline bool FixedBlockSolve(double (&a)[N][N], double (&b)[N])
+{
+	for(size_t k = 0; k < N; ++k)
+	{
+	//	pivot search
+		size_t p = k;
+		double maxVal = fabs(a[k][k]);
+		for(size_t i = k+1; i < N; ++i)
+			if(fabs(a[i][k]) > maxVal) { maxVal = fabs(a[i][k]); p = i; }
+		if(maxVal == 0.0) return false;
+		if(p != k)
+		{
+			for(size_t j = 0; j < N; ++j) std::swap(a[k][j], a[p][j]);
+			std::swap(b[k], b[p]);
+		}
+
+	//	elimination
+		const double invPivot = 1.0 / a[k][k];
+		for(size_t i = k+1; i < N; ++i)
+		{
+			const double l = a[i][k] * invPivot;
+			for(size_t j = k+1; j < N; ++j)
+				a[i][j] -= l * a[k][j];
+			b[i] -= l * b[k];
+		}
+	}
+
+//	backward substitution
+	for(size_t k = N; k-- > 0; )
+	{
+		double s = b[k];
+		for(size_t j = k+1; j < N; ++j)
+			s -= a[k][j] * b[j];
+		b[k] = s / a[k][k];
+	}
+	return true;
+}
+
+/**
+ * inverts A in place by Gauss-Jordan elimination with partial pivoting.
+ * \param a		the matrix in row major ordering, the inverse on exit
+ * \return false if A is singular
+ */
+template<size_t N>
+inline bool FixedBlockInvert(double (&a)[N][N])
+{
+	size_t perm[N];
+	for(size_t k = 0; k < N; ++k)
+	{
+	//	pivot search
+		size_t p = k;
+		double maxVal = fabs(a[k][k]);
+		for(size_t i = k+1; i < N; ++i)
+			if(fabs(a[i][k]) > maxVal) { maxVal = fabs(a[i][k]); p = i; }
+		if(maxVal == 0.0) return false;
+		perm[k] = p;
+		if(p != k)
+			for(size_t j = 0; j < N; ++j) std::swap(a[k][j], a[p][j]);
+
+	//	eliminate column k in all other rows
+		const double invPivot = 1.0 / a[k][k];
+		a[k][k] = 1.0;
+		for(size_t j = 0; j < N; ++j) a[k][j] *= invPivot;
+		for(size_t i = 0; i < N; ++i)
+		{
+			if(i == k) continue;
+			const double l = a[i][k];
+			a[i][k] = 0.0;
+			for(size_t j = 0; j < N; ++j)
+				a[i][j] -= l * a[k][j];
+		}
+	}
+
+//	undo row interchanges by swapping the columns in reverse order
+	for(size_t k = N; k-- > 0; )
+		if(perm[k] != k)
+			for(size_t i = 0; i < N; ++i) std::swap(a[i][k], a[i][perm[k]]);
+	return true;
+}
+
+
+//////////////////////////////////////////////////////
+// matrix-vector
+
+//! calculates dest = beta1 * A1 * w1;
+template<size_t N, eMatrixOrdering TOrdering>
+inline void MatMult(DenseVector<FixedArray1<double, N> > &dest,
+		const number &beta1, const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &A1,
+		const DenseVector<FixedArray1<double, N> > &w1)
+{
+	double s[N];
+	for(size_t r = 0; r < N; ++r) s[r] = 0.0;
+	FixedBlockMatMultAdd<N, TOrdering>(s, beta1, &A1(0,0), &w1[0]);
+	for(size_t r = 0; r < N; ++r) dest[r] = s[r];
+}
+
+//! calculates dest = alpha1*v1 + beta1 * A1 *w1;
+template<size_t N, eMatrixOrdering TOrdering>
+inline void MatMultAdd(DenseVector<FixedArray1<double, N> > &dest,
+		const number &alpha1, const DenseVector<FixedArray1<double, N> > &v1,
+		const number &beta1, const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &A1,
+		const DenseVector<FixedArray1<double, N> > &w1)
+{
+	double s[N];
+	for(size_t r = 0; r < N; ++r) s[r] = alpha1 * v1[r];
+	FixedBlockMatMultAdd<N, TOrdering>(s, beta1, &A1(0,0), &w1[0]);
+	for(size_t r = 0; r < N; ++r) dest[r] = s[r];
+}
+
+//! calculates dest = beta * A^{-1} * vec;
+template<size_t N, eMatrixOrdering TOrdering>
+inline bool InverseMatMult(DenseVector<FixedArray1<double, N> > &dest, double beta,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mat,
+		const DenseVector<FixedArray1<double, N> > &vec)
+{
+	switch(N)
+	{
+		case 1: return InverseMatMult1(dest, beta, mat, vec);
+		case 2: return InverseMatMult2(dest, beta, mat, vec);
+		case 3: return InverseMatMult3(dest, beta, mat, vec);
+		default: break;
+	}
+
+	double a[N][N], b[N];
+	for(size_t r = 0; r < N; ++r)
+	{
+		for(size_t c = 0; c < N; ++c)
+			a[r][c] = mat(r, c);
+		b[r] = beta * vec[r];
+	}
+	if(!FixedBlockSolve<N>(a, b)) return false;
+	for(size_t r = 0; r < N; ++r) dest[r] = b[r];
+	return true;
+}
+
+//////////////////////////////////////////////////////
+// matrix-matrix
+
+// dest = mA*mB
+template<size_t N, eMatrixOrdering TOrdering>
+inline void AssignMult(DenseMatrix<FixedArray2<double, N, N, TOrdering> > &dest,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mA,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mB)
+{
+	double s[N*N];
+	FixedBlockMatMat<N, TOrdering>(s, &mA(0,0), &mB(0,0));
+	double *d = &dest(0,0);
+	for(size_t i = 0; i < N*N; ++i) d[i] = s[i];
+}
+
+// dest += mA*mB
+template<size_t N, eMatrixOrdering TOrdering>
+inline void AddMult(DenseMatrix<FixedArray2<double, N, N, TOrdering> > &dest,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mA,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mB)
+{
+	double s[N*N];
+	FixedBlockMatMat<N, TOrdering>(s, &mA(0,0), &mB(0,0));
+	double *d = &dest(0,0);
+	for(size_t i = 0; i < N*N; ++i) d[i] += s[i];
+}
+
+// dest -= mA*mB
+template<size_t N, eMatrixOrdering TOrdering>
+inline void SubMult(DenseMatrix<FixedArray2<double, N, N, TOrdering> > &dest,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mA,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mB)
+{
+	double s[N*N];
+	FixedBlockMatMat<N, TOrdering>(s, &mA(0,0), &mB(0,0));
+	double *d = &dest(0,0);
+	for(size_t i = 0; i < N*N; ++i) d[i] -= s[i];
+}
+
+//////////////////////////////////////////////////////
+// inversion
+
+template<size_t N>
+inline bool Invert(DenseMatrix<FixedArray2<double, N, N> > &mat)
+{
+	switch(N)
+	{
+		case 1: return Invert1(mat);
+		case 2: return Invert2(mat);
+		default: break;
+	}
+
+	double a[N][N];
+	for(size_t r = 0; r < N; ++r)
+		for(size_t c = 0; c < N; ++c)
+			a[r][c] = mat(r, c);
+	if(!FixedBlockInvert<N>(a)) return false;
+	for(size_t r = 0; r < N; ++r)
+		for(size_t c = 0; c < N; ++c)
+			mat(r, c) = a[r][c];
+	return true;
+}
+
+// end group small_algebra
+/// \}
+
+} // namespace ug
+
+#endif // __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
@@ -51,7 +51,10 @@ namespace ug{
  * VariableArray1::capacity == VariableArray1::size, that means there is no capacity buffering.
  * This might be helpful if you have millions of instances of VariableArray1, since you will have
  * a) exactly as many memory allocated as you need
- * b) sizeof(VariableArray1) < sizeof(std::vector) ( 8 vs. 12 on 32-bit systems).
+ * b) no capacity overhead of std::vector.
+ * Arrays with at most inlineCapacity entries are stored inside the object, so
+ * that small vectors need no heap allocation and e.g. the entries of a
+ * Vector< DenseVector<VariableArray1<double> > > lie in one contiguous buffer.
  * \param T type of object in Array (i.e. double)
  */
 template<typename T>
@@ -62,12 +65,17 @@ public:
 	typedef size_t size_type;
 	typedef variable_type storage_type;
 
+	///	number of entries stored without heap allocation
+	static const size_type inlineCapacity = 4;
+
 public:
 	// 'tors
 	VariableArray1();
 	VariableArray1(size_type n_);
 	VariableArray1(const VariableArray1<T> &other);
 
+	VariableArray1<T> &operator = (const VariableArray1<T> &other);
+
 //protected:
 	// see Alexandrescu: non-virtual destructors should be protected
 	~VariableArray1();
@@ -113,9 +121,13 @@ public:
 	template<typename _T>
 	friend std::ostream &operator << (std::ostream &out, const VariableArray1<_T> &arr);
 
+protected:
+	inline void free_values();
+
 protected:
 	T *values;
 	size_type n;
+	T m_inline[inlineCapacity];
 };
 
 template<typename T>
@@ -131,6 +143,9 @@ struct storage_traits1<VariableArray1<T> >
  * VariableArray2 is a two-dimensional array which supports a similar interface like stl::vector.
  * You can use FixedArray2 in GeMatrix to get a variable size Matrix.
  * Use is_static to distinguish between fixed and variable arrays.
+ * Arrays with at most inlineCapacity entries (i.e. blocks up to 3x3) are stored
+ * inside the object. Then the blocks of a SparseMatrix< DenseMatrix<VariableArray2<double> > >
+ * need no heap allocation and lie contiguously in the value array of the matrix.
  * \param T type of object in Array (i.e. double)
  * \param T_ordering Ordering of columns/rows. Default is ColMajor. \sa eMatrixOrdering
  */
@@ -146,11 +161,16 @@ public:
 	enum { static_num_cols=0};
 	typedef variable_type storage_type;
 
+	///	number of entries stored without heap allocation
+	static const size_type inlineCapacity = 9;
+
 public:
 	VariableArray2();
 	VariableArray2(size_type rows_, size_type cols_);
 	VariableArray2(const VariableArray2<T, T_ordering> &other);
 
+	VariableArray2<T, T_ordering> &operator = (const VariableArray2<T, T_ordering> &other);
+
 //protected:
 	// see Alexandrescu: non-virtual destructors should be protected
 	~VariableArray2();
@@ -202,10 +222,14 @@ public:
 	template<typename _T, eMatrixOrdering _T_Ordering>
 	friend std::ostream &operator << (std::ostream &out, const VariableArray2<_T, _T_Ordering> &arr);
 
+protected:
+	inline void free_values();
+
 protected:
 	T *values;
 	size_type rows;
 	size_type cols;
+	T m_inline[inlineCapacity];
 };
 
 }
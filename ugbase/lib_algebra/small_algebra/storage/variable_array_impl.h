@@ -70,10 +70,29 @@ VariableArray1<T>::VariableArray1(const VariableArray1<T> &other)
 		values[i] = other[i];
 }
 
+template<typename T>
+VariableArray1<T> &
+VariableArray1<T>::operator = (const VariableArray1<T> &other)
+{
+	if(this == &other) return *this;
+	resize(other.size(), false);
+	for(size_type i=0; i<n; i++)
+		values[i] = other[i];
+	return *this;
+}
+
 template<typename T>
 VariableArray1<T>::~VariableArray1()
 {
-	if(values) { delete[] values; values = NULL; }
+	free_values();
+}
+
+template<typename T>
+inline void
+VariableArray1<T>::free_values()
+{
+	if(values && values != m_inline) delete[] values;
+	values = NULL;
 	n = 0;
 }
 
@@ -95,12 +114,14 @@ VariableArray1<T>::resize(size_t newN, bool bCopyValues)
 
 	if(newN <= 0)
 	{
-		if(values) delete[] values;
-		values = NULL;
-		n = 0;
+		free_values();
 		return true;
 	}
-	value_type *new_values = new T[newN];
+
+	// small arrays are assembled in tmp and then moved to m_inline
+	T tmp[inlineCapacity];
+	const bool bInline = (newN <= inlineCapacity);
+	value_type *new_values = bInline ? tmp : new T[newN];
 	UG_ASSERT(new_values != NULL, "out of memory");
 	if(new_values == NULL) return false;
 	memset(new_values, 0, sizeof(T)*newN); // todo: think about that
@@ -121,7 +142,13 @@ VariableArray1<T>::resize(size_t newN, bool bCopyValues)
 			std::swap(new_values[i], values[i]);
 	}
 
-	if(values) delete[] values;
+	if(values && values != m_inline) delete[] values;
+	if(bInline)
+	{
+		for(size_t i=0; i<newN; i++)
+			std::swap(m_inline[i], tmp[i]);
+		new_values = m_inline;
+	}
 	values = new_values;
 	n = newN;
 	return true;
@@ -208,10 +235,29 @@ VariableArray2<T, T_ordering>::VariableArray2(const VariableArray2<T, T_ordering
 		values[i] = other.values[i];
 }
 
+template<typename T, eMatrixOrdering T_ordering>
+VariableArray2<T, T_ordering> &
+VariableArray2<T, T_ordering>::operator = (const VariableArray2<T, T_ordering> &other)
+{
+	if(this == &other) return *this;
+	resize(other.num_rows(), other.num_cols(), false);
+	for(size_type i=0; i<rows*cols; i++)
+		values[i] = other.values[i];
+	return *this;
+}
+
 template<typename T, eMatrixOrdering T_ordering>
 VariableArray2<T, T_ordering>::~VariableArray2()
 {
-	if(values) { delete[] values; values = NULL; }
+	free_values();
+}
+
+template<typename T, eMatrixOrdering T_ordering>
+inline void
+VariableArray2<T, T_ordering>::free_values()
+{
+	if(values && values != m_inline) delete[] values;
+	values = NULL;
 	rows = cols = 0;
 }
 
@@ -240,13 +286,15 @@ VariableArray2<T, T_ordering>::resize(size_t newRows, size_t newCols, bool bCopy
 
 	if(newRows == 0 && newCols == 0)
 	{
-		rows = cols = 0;
-		if(values) delete[] values;
-		values = NULL;
+		free_values();
 		return true;
 	}
 
-	value_type *new_values = new T[newRows*newCols];
+	// small arrays are assembled in tmp and then moved to m_inline
+	T tmp[inlineCapacity];
+	const size_t newSize = newRows*newCols;
+	const bool bInline = (newSize <= inlineCapacity);
+	value_type *new_values = bInline ? tmp : new T[newSize];
 	memset(new_values, 0, sizeof(T)*newRows*newCols); // todo: think about that
 	UG_ASSERT(new_values != NULL, "out of memory");
 	if(new_values==NULL) return false;
@@ -274,7 +322,13 @@ VariableArray2<T, T_ordering>::resize(size_t newRows, size_t newCols, bool bCopy
 					std::swap(new_values[r+c*newRows], values[r+c*rows]);
 	}
 
-	if(values) delete[] values;
+	if(values && values != m_inline) delete[] values;
+	if(bInline)
+	{
+		for(size_t i=0; i<newSize; i++)
+			std::swap(m_inline[i], tmp[i]);
+		new_values = m_inline;
+	}
 	rows = newRows;
 	cols = newCols;
 	values = new_values;
@@ -305,6 +305,13 @@ void SetDirichletRow(TMatrix& mat, const DoFIndex& ind)
 	SetDirichletRow(mat, ind[0], ind[1]);
 }
 
+template <typename TMatrix>
+void SetDirichletRow(TMatrix& mat, const std::vector<DoFIndex>& vInd)
+{
+	for(size_t i = 0; i < vInd.size(); ++i)
+		SetDirichletRow(mat, vInd[i][0], vInd[i][1]);
+}
+
 template <typename TMatrix>
 void SetRow(TMatrix& mat, const DoFIndex& ind, number val = 0.0)
 {
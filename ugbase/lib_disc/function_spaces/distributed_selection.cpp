@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "distributed_selection.h"
+
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+#include "common/profiler/profiler.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+namespace ug{
+
+namespace{
+
+///	number of bits classified per round of the radix select
+const int RADIX_BITS = 8;
+const size_t NUM_BUCKETS = (1 << RADIX_BITS);
+
+///	bit pattern of a non-negative double, ordered like the values
+inline uint64 ValueToKey(double val)
+{
+	uint64 key;
+	std::memcpy(&key, &val, sizeof(double));
+	return key;
+}
+
+inline double KeyToValue(uint64 key)
+{
+	double val;
+	std::memcpy(&val, &key, sizeof(double));
+	return val;
+}
+
+///	sums the histogram (counts followed by sums) over all processes
+void SumHistogram(std::vector<double>& vHist)
+{
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1)
+	{
+		pcl::ProcessCommunicator com;
+		std::vector<double> vLocal(vHist);
+		com.allreduce(vLocal, vHist, PCL_RO_SUM);
+	}
+#endif
+}
+
+/**
+ * Radix select over all processes. In every round the bucket containing the
+ * selected value is the first (from the largest) at which the accumulated
+ * count exceeds k (bCount) or the accumulated sum reaches the bulk (!bCount).
+ */
+number RadixSelect(const std::vector<number>& vVal, size_t k, number bulk, bool bCount)
+{
+	PROFILE_FUNC_GROUP("disc");
+	std::vector<double> vHist(2*NUM_BUCKETS);
+
+	uint64 prefix = 0;
+	double countAbove = 0.0, sumAbove = 0.0;
+
+	for(int shift = 64 - RADIX_BITS; shift >= 0; shift -= RADIX_BITS)
+	{
+	//	local histogram of the candidates (values matching the prefix)
+		std::fill(vHist.begin(), vHist.end(), 0.0);
+		const int prefixShift = shift + RADIX_BITS;
+		for(size_t i = 0; i < vVal.size(); ++i)
+		{
+			if(vVal[i] < 0) continue;
+			const uint64 key = ValueToKey(vVal[i]);
+			if(prefixShift < 64 && (key >> prefixShift) != prefix) continue;
+			const size_t b = (size_t)((key >> shift) & (NUM_BUCKETS - 1));
+			vHist[b] += 1.0;
+			vHist[NUM_BUCKETS + b] += vVal[i];
+		}
+
+		SumHistogram(vHist);
+
+	//	in the first round all values are candidates: if the criterion can
+	//	not be reached, the smallest value is selected
+		if(prefixShift >= 64)
+		{
+			double totalCount = 0.0, totalSum = 0.0;
+			for(size_t b = 0; b < NUM_BUCKETS; ++b)
+			{
+				totalCount += vHist[b];
+				totalSum += vHist[NUM_BUCKETS + b];
+			}
+			if(totalCount == 0.0) return 0.0;
+			if((bCount && (double)k >= totalCount) || (!bCount && bulk > totalSum))
+			{
+				bCount = true;
+				k = (size_t)totalCount - 1;
+			}
+		}
+
+	//	find bucket containing the selected value, if the bulk is missed due
+	//	to rounding, the smallest candidate bucket is taken
+		int bucket = -1;
+		bool bFound = false;
+		for(int b = NUM_BUCKETS - 1; b >= 0; --b)
+		{
+			const double cnt = vHist[b], sum = vHist[NUM_BUCKETS + b];
+			if(cnt == 0.0) continue;
+			bucket = b;
+			if((bCount && countAbove + cnt > (double)k)
+				|| (!bCount && sumAbove + sum >= bulk))
+				{bFound = true; break;}
+			countAbove += cnt;
+			sumAbove += sum;
+		}
+		UG_ASSERT(bucket >= 0, "no candidates left in distributed selection");
+		if(!bFound)
+		{
+			countAbove -= vHist[bucket];
+			sumAbove -= vHist[NUM_BUCKETS + bucket];
+		}
+
+		prefix = (prefix << RADIX_BITS) | (uint64)bucket;
+	}
+
+	return KeyToValue(prefix);
+}
+
+} // end anonymous namespace
+
+number DistributedKthLargest(const std::vector<number>& vVal, size_t k)
+{
+	return RadixSelect(vVal, k, 0.0, true);
+}
+
+number DistributedBulkThreshold(const std::vector<number>& vVal, number bulk)
+{
+	if(bulk <= 0.0) return std::numeric_limits<number>::max();
+	return RadixSelect(vVal, 0, bulk, false);
+}
+
+} // end namespace ug
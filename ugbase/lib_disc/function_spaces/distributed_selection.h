@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__FUNCTION_SPACE__DISTRIBUTED_SELECTION__
+#define __H__UG__LIB_DISC__FUNCTION_SPACE__DISTRIBUTED_SELECTION__
+
+#include <vector>
+#include "common/common.h"
+
+namespace ug{
+
+/**
+ * Distributed selection on non-negative values (e.g. element error indicators)
+ * that are spread over all processes.
+ *
+ * The values are selected by a radix select on their IEEE bit pattern, which
+ * is ordered like the values for non-negative numbers. Each of the 8 rounds
+ * classifies the remaining candidates by the next 8 bits and performs one
+ * allreduce of a histogram (counts and sums) with 256 buckets. Hence the
+ * local work is O(N), the communication is independent of N, no values are
+ * gathered, and the result is the same as that of the sequential criterion
+ * on the union of all values for any number of processes (up to rounding in
+ * the summation of the histograms).
+ *
+ * Negative values are ignored.
+ */
+/// \{
+
+///	returns the k-th largest value of all processes (k = 0: maximum)
+/**
+ * If there are at most k values in total, the smallest value is returned
+ * (or 0, if there are no values at all).
+ */
+number DistributedKthLargest(const std::vector<number>& vVal, size_t k);
+
+///	returns the threshold of the bulk (Doerfler) criterion
+/**
+ * Let \f$ \eta_1 \ge \eta_2 \ge ... \f$ be all values of all processes sorted
+ * descending. Returns \f$ \eta_m \f$ with the smallest m, such that
+ * \f$ \sum_{i \le m} \eta_i \ge bulk \f$. Marking all values \f$ \ge \eta_m \f$
+ * reaches the bulk. If bulk exceeds the sum of all values, the smallest value
+ * is returned. If bulk <= 0, the maximal number is returned (nothing to mark).
+ */
+number DistributedBulkThreshold(const std::vector<number>& vVal, number bulk);
+
+/// \}
+
+} // end namespace ug
+
+#endif
@@ -38,6 +38,7 @@
 #include "lib_grid/refinement/refiner_interface.h"
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "error_indicator_util.h"
+#include "distributed_selection.h"
 
 namespace ug{
 
@@ -199,7 +200,8 @@ number CreateListOfElemWeights(
 		MultiGrid::AttachmentAccessor<TElem, ug::Attachment<number> > &aaError,
 		typename DoFDistribution::traits<TElem>::const_iterator iterBegin,
 		const typename DoFDistribution::traits<TElem>::const_iterator iterEnd,
-		std::vector<double> &eta)
+		std::vector<double> &eta,
+		bool bSort = true)
 {
 	number localErr=0;
 	typename DoFDistribution::traits<TElem>::const_iterator iter; // = iterBegin;
@@ -217,7 +219,7 @@ number CreateListOfElemWeights(
 	}
 
 	// sort descending using default comparison
-	std::sort (eta.begin(), eta.end(), std::greater<double>());
+	if(bSort) std::sort (eta.begin(), eta.end(), std::greater<double>());
 	return localErr;
 };
 
@@ -264,8 +266,8 @@ void MaximumMarking<TDomain>::mark(typename base_type::elem_accessor_type& aaErr
 	const_iterator iter;
 	const const_iterator iterEnd = dd->template end<TElem>();
 
-	// determine (local) number of excess elements
-	const size_t ndiscard = (size_t) (numElemLocal*m_eps); // TODO: on every process?
+	// determine (global) number of excess elements
+	const size_t ndiscard = (size_t) (numElem*m_eps);
 	UG_LOG("  +++ Found max "<<  maxElemErr << " ndiscard="<<ndiscard<<".\n");
 
 	// Verfuerths strategy for skipping excess
@@ -288,34 +290,15 @@ void MaximumMarking<TDomain>::mark(typename base_type::elem_accessor_type& aaErr
 
 	}*/
 
-	if (numElemLocal > 0)
-	{
-		// create sorted array of elem weights
-		std::vector<double> eta;
-		eta.resize(numElemLocal);
-		CreateListOfElemWeights<TElem>(aaError,dd->template begin<TElem>(), iterEnd, eta);
-		UG_ASSERT(numElemLocal==eta.size(), "Huhh: number of elements does not match!");
-		UG_ASSERT(numElemLocal > ndiscard, "Huhh: number of elements does not match!");
-		maxElemErr = eta[ndiscard];
-
-	}
-
-	UG_LOG("  +++ MaximumMarking: Maximum for refinement: " << maxElemErr << " elements.\n");
+	// (ndiscard+1)-largest element weight of all processes: selected in
+	// parallel without sorting or gathering, identical on all processes
+	std::vector<double> eta;
+	eta.resize(numElemLocal);
+	CreateListOfElemWeights<TElem>(aaError,dd->template begin<TElem>(), iterEnd, eta, false);
+	UG_ASSERT(numElemLocal==eta.size(), "Huhh: number of elements does not match!");
+	maxElemErr = DistributedKthLargest(eta, ndiscard);
 
-	// compute parallel threshold
-#ifdef UG_PARALLEL
-	if (pcl::NumProcs() > 1)
-	{
-		pcl::ProcessCommunicator com;
-		number maxElemErrLocal = maxElemErr;
-		maxElemErr = com.allreduce(maxElemErrLocal, PCL_RO_SUM);
-		UG_LOG("  +++ MaximumMarking: Maximum for refinement: " << maxElemErr << ".\n");
-		maxElemErr = maxElemErr / pcl::NumProcs();
-		UG_LOG("  +++ MaximumMarking: Average for refinement: " << maxElemErr << ".\n");
-	}
-#else
 	UG_LOG("  +++ Skipping " << ndiscard << " elements; new max." << maxElemErr << ".\n");
-#endif
 
 	// refine all element above threshold
 	const number minErrToRefine = maxElemErr*m_theta;
@@ -757,9 +740,6 @@ void EquilibrationMarkingStrategy<TDomain>::mark(typename base_type::elem_access
 	ComputeMinMax(aaError, dd, minElemErr, maxElemErr, errTotal, numElem,
 					minElemErrLocal, maxElemErrLocal, errLocal, numElemLocal);
 
-	number localErr = 0.0;   // local error
-	number subsetErr = 0.0;  // local contribution of marked (largest) elements
-
 	// init iterators
 	const const_iterator iterEnd = dd->template end<TElem>();
 	const_iterator iter;
@@ -767,46 +747,22 @@ void EquilibrationMarkingStrategy<TDomain>::mark(typename base_type::elem_access
 	// create and fill array of $\eta^2_i$ for all (local) elements
 	std::vector<double> eta;
 	eta.resize(numElemLocal);
-
-	CreateListOfElemWeights<TElem>(aaError,dd->template begin<TElem>(), iterEnd, eta);
-/*	size_t i=0;
-	for (iter = dd->template begin<TElem>(); iter != iterEnd; ++iter)
-	{
-		const double elemErr = aaError[*iter];
-
-		//	if no error value exists: ignore (might be newly added by refinement);
-		//	newly added elements are supposed to have a negative error estimator
-		if (elemErr < 0) continue;
-
-		eta[i++]  = elemErr;
-		localErr += elemErr;
-	}*/
-
-	// sort descending using default comparison
-	//std::sort (eta.begin(), eta.end(), std::greater<double>());
+	CreateListOfElemWeights<TElem>(aaError,dd->template begin<TElem>(), iterEnd, eta, false);
 	UG_ASSERT(numElemLocal==eta.size(), "Huhh: number of elements does not match!");
 
+	// threshold of the bulk criterion: the largest elements contributing
+	// theta*errTotal are marked. The threshold is selected in parallel without
+	// sorting or gathering and is identical on all processes.
+	maxElemErr = DistributedBulkThreshold(eta, m_theta*errTotal);
 
-	// error for marked subset
-	subsetErr = 0.0;
-	int i=0;
-
-	// discard a fraction of elements
+	// refine at least a fraction of all elements
 	UG_ASSERT( ((m_eps>=0.0) && (m_eps<=1.0)), "Huhh: m_eps invalid!");
-	const int ndiscard = (m_eps!=0.0) ? (int) (numElemLocal*m_eps) : 0;
-	for (i=0; i<ndiscard; ++i)
-	{ subsetErr += eta[i]; }
-
-	// define cutoff threshold
-	const number theta = (m_theta*numElemLocal)/numElem;
-	while (subsetErr < theta*errTotal)
-	{ subsetErr += eta[i++]; }
-	maxElemErr = eta[i-1];
+	const size_t nmin = (size_t) (numElem*m_eps);
+	if (nmin > 0)
+		maxElemErr = std::min(maxElemErr, DistributedKthLargest(eta, nmin-1));
 
-	UG_LOG("  +++  localGoalErr^2= "<<   theta*errTotal << std::endl);
-	UG_LOG("  +++  localErr^2= "<<  localErr << std::endl);
-	UG_LOG("  +++  markedError^2= "<<  subsetErr << std::endl);
-	UG_LOG("  +++  threshold= "<< maxElemErr<<"; i="<< i<< std::endl);
+	UG_LOG("  +++  goalErr^2= "<<   m_theta*errTotal << std::endl);
+	UG_LOG("  +++  threshold= "<< maxElemErr << std::endl);
 
 
 	//	mark elements with maximal contribution
@@ -824,7 +780,7 @@ void EquilibrationMarkingStrategy<TDomain>::mark(typename base_type::elem_access
 
 		//maxElemErr = std::max(maxElemErr, elemErr);
 
-		if (elemErr > maxElemErr)
+		if (elemErr >= maxElemErr)
 		{
 			refiner.mark(*iter, RM_REFINE);
 			numMarkedRefine++;
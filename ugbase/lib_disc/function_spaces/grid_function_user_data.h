@@ -41,12 +41,94 @@
 #include "lib_disc/common/groups_util.h"
 #include "lib_disc/quadrature/quadrature.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/local_shape_table.h"
 #include "lib_disc/spatial_disc/user_data/std_user_data.h"
 #include "lib_disc/reference_element/reference_mapping_provider.h"
 
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
 
 namespace ug{
 
+/// gathers the values of a function on an element into a contiguous buffer
+/**
+ * The buffers are only resized, such that repeated calls do not allocate once
+ * the buffers have reached the size needed by the element types in use.
+ */
+template <typename TGridFunction>
+inline void GatherElemDoFValues(std::vector<number>& vValue,
+                                std::vector<DoFIndex>& vInd,
+                                const TGridFunction& u, GridObject* elem,
+                                size_t fct)
+{
+	u.dof_indices(elem, fct, vInd);
+	vValue.resize(vInd.size());
+	for(size_t sh = 0; sh < vInd.size(); ++sh)
+		vValue[sh] = DoFRef(u, vInd[sh]);
+}
+
+/// evaluation buffers of the grid function user data, one set per thread
+/**
+ * The grid function user data keep the shape tables and the values of the
+ * last element between evaluations. Since the data may be evaluated
+ * concurrently (e.g. by the threaded integration), each OpenMP thread uses
+ * its own buffers. The number of buffers is fixed at construction. If more
+ * threads are used later on, thread_safe() returns false, such that the
+ * data is evaluated serially.
+ */
+class GridFunctionEvalBuffers
+{
+	public:
+	///	buffers of one thread
+		struct Buffer
+		{
+			std::vector<LocalShapeTableSet> vShapeTables;
+			std::vector<DoFIndex> vInd;
+			std::vector<number> vElemVal;
+		};
+
+	public:
+	///	constructor, keeping numTables shape tables per thread
+		GridFunctionEvalBuffers(size_t numTables = 1)
+		{
+#ifdef UG_OPENMP
+			m_vBuffer.resize(omp_get_max_threads());
+#else
+			m_vBuffer.resize(1);
+#endif
+			for(size_t t = 0; t < m_vBuffer.size(); ++t)
+				m_vBuffer[t].vShapeTables.resize(numTables);
+		}
+
+	///	returns the buffers of the calling thread
+		Buffer& get() const
+		{
+#ifdef UG_OPENMP
+			const size_t tid = omp_get_thread_num();
+			UG_COND_THROW(tid >= m_vBuffer.size(),
+			              "GridFunctionEvalBuffers: No buffers for thread "<<tid);
+			return m_vBuffer[tid];
+#else
+			return m_vBuffer[0];
+#endif
+		}
+
+	///	returns if there are buffers for all threads
+		bool thread_safe() const
+		{
+#ifdef UG_OPENMP
+			return (size_t)omp_get_max_threads() <= m_vBuffer.size();
+#else
+			return true;
+#endif
+		}
+
+	protected:
+		mutable std::vector<Buffer> m_vBuffer;
+};
+
 template <typename TGridFunction>
 class GridFunctionNumberData
 : public StdDependentUserData<GridFunctionNumberData<TGridFunction>,
@@ -66,6 +148,9 @@ class GridFunctionNumberData
 		//	local finite element id
 		LFEID m_lfeID;
 
+		//	shapes at the last used ips and element values, per thread
+		GridFunctionEvalBuffers m_buffers;
+
 	public:
 		/// constructor
 		GridFunctionNumberData(SmartPtr<TGridFunction> spGridFct, const char* cmp)
@@ -90,6 +175,11 @@ class GridFunctionNumberData
 			return LocalFiniteElementProvider::continuous(m_lfeID);
 		}
 
+		virtual bool thread_safe() const
+		{
+			return m_buffers.thread_safe();
+		}
+
 		template <int refDim>
 		void eval_and_deriv(number vValue[],
 		                    const MathVector<dim> vGlobIP[],
@@ -109,38 +199,25 @@ class GridFunctionNumberData
 
 			//	get trial space
 			try{
-				const LocalShapeFunctionSet<refDim>& rTrialSpace =
-						LocalFiniteElementProvider::get<refDim>(roid, m_lfeID);
+				GridFunctionEvalBuffers::Buffer& buf = m_buffers.get();
 
-				//	memory for shapes
-				std::vector<number> vShape;
-				//	memory for indices
-				std::vector<DoFIndex> ind;
+				//	shapes at ips (only recomputed if element type or ips change)
+				LocalShapeTable<refDim>& rTable = buf.vShapeTables[0].template get<refDim>();
+				rTable.update(roid, m_lfeID, vLocIP, nip);
 
-				//	loop ips
-				for(size_t ip = 0; ip < nip; ++ip)
-				{
-					//	evaluate at shapes at ip
-					rTrialSpace.shapes(vShape, vLocIP[ip]);
-
-					//	get multiindices of element
-					m_spGridFct->dof_indices(elem, m_fct, ind);
-
-					// 	compute solution at integration point
-					vValue[ip] = 0.0;
-					for(size_t sh = 0; sh < vShape.size(); ++sh)
-					{
-						const number valSH = DoFRef(*m_spGridFct, ind[sh]);
-						vValue[ip] += valSH * vShape[sh];
-					}
-				}
+				//	get values of element
+				GatherElemDoFValues(buf.vElemVal, buf.vInd, *m_spGridFct, elem, m_fct);
+				UG_ASSERT(buf.vElemVal.size() == rTable.num_sh(),
+				          "GridFunctionNumberData: Number of dofs ("<<buf.vElemVal.size()
+				          <<") does not match number of shapes ("<<rTable.num_sh()<<").");
+
+				// 	compute solution at integration points
+				rTable.values(vValue, &buf.vElemVal[0]);
 
 				if(bDeriv){
 					for(size_t ip = 0; ip < nip; ++ip){
-						//	evaluate at shapes at ip
-						rTrialSpace.shapes(vShape, vLocIP[ip]);
-
-						for(size_t sh = 0; sh < vShape.size(); ++sh)
+						const number* vShape = rTable.shapes(ip);
+						for(size_t sh = 0; sh < rTable.num_sh(); ++sh)
 							vvvDeriv[ip][0][sh] = vShape[sh];
 					}
 				}
@@ -182,10 +259,13 @@ class GridFunctionVectorData
 	//	local finite element id
 	LFEID m_vlfeID[dim];
 
+	//	shapes at the last used ips (per component) and element values, per thread
+	GridFunctionEvalBuffers m_buffers;
+
 	public:
 	/// constructor
 	GridFunctionVectorData(SmartPtr<TGridFunction> spGridFct, const char* cmp)
-	: m_spGridFct(spGridFct)
+	: m_spGridFct(spGridFct), m_buffers(dim)
 	{
 		this->set_functions(cmp);
 
@@ -216,7 +296,7 @@ class GridFunctionVectorData
 	};
 
 	GridFunctionVectorData(SmartPtr<TGridFunction> spGridFct, std::vector<std::string> vCmp)
-	: m_spGridFct(spGridFct)
+	: m_spGridFct(spGridFct), m_buffers(dim)
 	{
 		this->set_functions(vCmp);
 
@@ -246,6 +326,11 @@ class GridFunctionVectorData
 		return true;
 	}
 
+	virtual bool thread_safe() const
+	{
+		return m_buffers.thread_safe();
+	}
+
 	template <int refDim>
 	void eval_and_deriv(MathVector<dim> vValue[],
 	                    const MathVector<dim> vGlobIP[],
@@ -263,33 +348,31 @@ class GridFunctionVectorData
 		//	reference object id
 		const ReferenceObjectID roid = elem->reference_object_id();
 
-		//	memory for shapes
-		std::vector<number> vShape;
-		//	memory for indices
-		std::vector<DoFIndex> ind;
-
-		//	loop ips
+		//	loop components
 		try{
-			for(size_t ip = 0; ip < nip; ++ip)
+			GridFunctionEvalBuffers::Buffer& buf = m_buffers.get();
+
+			for(int d = 0; d < dim; ++d)
 			{
-				for(int d = 0; d < dim; ++d)
+				//	shapes at ips (only recomputed if element type or ips change)
+				LocalShapeTable<refDim>& rTable = buf.vShapeTables[d].template get<refDim>();
+				rTable.update(roid, m_vlfeID[d], vLocIP, nip);
+
+				//	get values of element
+				GatherElemDoFValues(buf.vElemVal, buf.vInd, *m_spGridFct, elem, m_vfct[d]);
+				UG_ASSERT(buf.vElemVal.size() == rTable.num_sh(),
+				          "GridFunctionVectorData: Number of dofs ("<<buf.vElemVal.size()
+				          <<") does not match number of shapes ("<<rTable.num_sh()<<").");
+
+				// 	compute solution at integration points
+				const size_t nsh = rTable.num_sh();
+				for(size_t ip = 0; ip < nip; ++ip)
 				{
-					const LocalShapeFunctionSet<refDim>& rTrialSpace =
-							LocalFiniteElementProvider::get<refDim>(roid, m_vlfeID[d]);
-
-					//	evaluate at shapes at ip
-					rTrialSpace.shapes(vShape, vLocIP[ip]);
-
-					//	get multiindices of element
-					m_spGridFct->dof_indices(elem, m_vfct[d], ind);
-
-					// 	compute solution at integration point
-					vValue[ip][d] = 0.0;
-					for(size_t sh = 0; sh < vShape.size(); ++sh)
-					{
-						const number valSH = DoFRef( *m_spGridFct, ind[sh]);
-						vValue[ip][d] += valSH * vShape[sh];
-					}
+					const number* vShape = rTable.shapes(ip);
+					number val = 0.0;
+					for(size_t sh = 0; sh < nsh; ++sh)
+						val += buf.vElemVal[sh] * vShape[sh];
+					vValue[ip][d] = val;
 				}
 			}
 
@@ -335,6 +418,9 @@ class GridFunctionGradientData
 	//	local finite element id
 	LFEID m_lfeID;
 
+	//	shapes and local gradients at the last used ips and element values, per thread
+	GridFunctionEvalBuffers m_buffers;
+
 	public:
 	/// constructor
 	GridFunctionGradientData(SmartPtr<TGridFunction> spGridFct, const char* cmp)
@@ -359,6 +445,11 @@ class GridFunctionGradientData
 		return false;
 	}
 
+	virtual bool thread_safe() const
+	{
+		return m_buffers.thread_safe();
+	}
+
 	template <int refDim>
 	void eval_and_deriv(MathVector<dim> vValue[],
 	                    const MathVector<dim> vGlobIP[],
@@ -376,52 +467,46 @@ class GridFunctionGradientData
 		//	reference object id
 		const ReferenceObjectID roid = elem->reference_object_id();
 
-		//	get reference element mapping by reference object id
-		std::vector<MathMatrix<refDim, dim> > vJTTmp(nip);
+		//	get reference element mapping by reference object id, if the
+		//	transformation matrices are not passed
+		DimReferenceMapping<refDim, dim>* pMapping = NULL;
 		if(vJT == NULL){
 			try{
-				DimReferenceMapping<refDim, dim>& mapping
-				= ReferenceMappingProvider::get<refDim, dim>(roid, vCornerCoords);
-
-				//	compute transformation matrices
-				mapping.jacobian_transposed(&(vJTTmp[0]), vLocIP, nip);
-
-				//	store tmp Gradient
-				vJT = &(vJTTmp[0]);
+				pMapping = &ReferenceMappingProvider::get<refDim, dim>(roid, vCornerCoords);
 			}UG_CATCH_THROW("GridFunctionGradientData: failed.");
 		}
 
 		//	get trial space
 		try{
-			const LocalShapeFunctionSet<refDim>& rTrialSpace =
-					LocalFiniteElementProvider::get<refDim>(roid, m_lfeID);
+			GridFunctionEvalBuffers::Buffer& buf = m_buffers.get();
+
+			//	shapes at ips (only recomputed if element type or ips change)
+			LocalShapeTable<refDim>& rTable = buf.vShapeTables[0].template get<refDim>();
+			rTable.update(roid, m_lfeID, vLocIP, nip, true);
+
+			//	get values of element
+			GatherElemDoFValues(buf.vElemVal, buf.vInd, *m_spGridFct, elem, m_fct);
+			UG_ASSERT(buf.vElemVal.size() == rTable.num_sh(),
+			          "GridFunctionGradientData: Number of dofs ("<<buf.vElemVal.size()
+			          <<") does not match number of shapes ("<<rTable.num_sh()<<").");
 
-			//	storage for shape function at ip
-			std::vector<MathVector<refDim> > vLocGrad;
 			MathVector<refDim> locGrad;
 
 			//	Reference Mapping
+			MathMatrix<refDim, dim> JT;
 			MathMatrix<dim, refDim> JTInv;
 
 			//	loop ips
 			for(size_t ip = 0; ip < nip; ++ip)
 			{
-				//	evaluate at shapes at ip
-				rTrialSpace.grads(vLocGrad, vLocIP[ip]);
-
-				//	get multiindices of element
-				std::vector<DoFIndex > ind;
-				m_spGridFct->dof_indices(elem, m_fct, ind);
+				//	compute local grad at ip
+				rTable.local_grad(locGrad, ip, &buf.vElemVal[0]);
 
-				//	compute grad at ip
-				VecSet(locGrad, 0.0);
-				for(size_t sh = 0; sh < vLocGrad.size(); ++sh)
-				{
-					const number valSH = DoFRef( *m_spGridFct, ind[sh]);
-					VecScaleAppend(locGrad, valSH, vLocGrad[sh]);
+				if(vJT != NULL) RightInverse (JTInv, vJT[ip]);
+				else{
+					pMapping->jacobian_transposed(JT, vLocIP[ip]);
+					RightInverse (JTInv, JT);
 				}
-
-				RightInverse (JTInv, vJT[ip]);
 				MatVecMult(vValue[ip], JTInv, locGrad);
 			}
 		}
@@ -466,6 +551,9 @@ class GridFunctionGradientComponentData
 	///	Local Finite Element ID
 	LFEID m_lfeID;
 
+	///	Shapes and local gradients at the last used ips and element values, per thread
+	GridFunctionEvalBuffers m_buffers;
+
 	public:
 	/**
 	 * \brief Constructor
@@ -505,6 +593,11 @@ class GridFunctionGradientComponentData
 		return false;
 	}
 
+	virtual bool thread_safe() const
+	{
+		return m_buffers.thread_safe();
+	}
+
 	/**
 	 * \param[out] vValue Array of the <tt>nip</tt> gradient components
 	 */
@@ -525,67 +618,61 @@ class GridFunctionGradientComponentData
 		//	reference object id
 		const ReferenceObjectID roid = elem->reference_object_id();
 
-		//	get reference element mapping by reference object id
-		std::vector<MathMatrix<refDim, dim> > vJTTmp( nip );
+		//	get reference element mapping by reference object id, if the
+		//	transformation matrices are not passed
+		DimReferenceMapping<refDim, dim>* pMapping = NULL;
 		if( vJT == NULL ) {
 			try{
-				DimReferenceMapping<refDim, dim>& mapping
-				= ReferenceMappingProvider::get< refDim, dim >( roid, vCornerCoords );
-
-				//	compute transformation matrices
-				mapping.jacobian_transposed( &(vJTTmp[0]), vLocIP, nip );
-
-				//	store tmp Gradient
-				vJT = &(vJTTmp[0]);
+				pMapping = &ReferenceMappingProvider::get< refDim, dim >( roid, vCornerCoords );
 			} UG_CATCH_THROW( "GridFunctionGradientComponentData: failed.");
 		}
 
 		//	get trial space
 		try {
-			const LocalShapeFunctionSet<refDim>& rTrialSpace =
-					LocalFiniteElementProvider::get<refDim>( roid, m_lfeID );
+			GridFunctionEvalBuffers::Buffer& buf = m_buffers.get();
+
+			//	shapes at ips (only recomputed if element type or ips change)
+			LocalShapeTable<refDim>& rTable = buf.vShapeTables[0].template get<refDim>();
+			rTable.update( roid, m_lfeID, vLocIP, nip, true );
+			const size_t nsh = rTable.num_sh();
+
+			//	get values of element
+			GatherElemDoFValues( buf.vElemVal, buf.vInd, *m_spGridFct, elem, m_fct );
+			UG_ASSERT( buf.vElemVal.size() == nsh,
+			           "GridFunctionGradientComponentData: Number of dofs ("<<buf.vElemVal.size()
+			           <<") does not match number of shapes ("<<nsh<<")." );
 
-			//	storage for shape function at ip
-			std::vector<MathVector<refDim> > vLocGrad;
 			MathVector<refDim> locGrad;
-			std::vector<MathVector<dim> > vValueVec;
-			vValueVec.resize( nip );
+			MathVector<dim> globGrad;
 
 			//	Reference Mapping
+			MathMatrix<refDim, dim> JT;
 			MathMatrix<dim, refDim> JTInv;
 
 			//	loop ips
 			for( size_t ip = 0; ip < nip; ++ip ) {
-				//	evaluate at shapes at ip
-				rTrialSpace.grads( vLocGrad, vLocIP[ip] );
-
-				//	get multiindices of element
-				std::vector<DoFIndex> ind;
-				m_spGridFct->dof_indices( elem, m_fct, ind );
-
-				//	compute grad at ip
-				VecSet( locGrad, 0.0 );
-				for( size_t sh = 0; sh < vLocGrad.size(); ++sh ) {
-					const number valSH = DoFRef( *m_spGridFct, ind[sh] );
-					VecScaleAppend( locGrad, valSH, vLocGrad[sh] );
-				}
+				//	compute local grad at ip
+				rTable.local_grad( locGrad, ip, &buf.vElemVal[0] );
 
-				RightInverse( JTInv, vJT[ip] );
-				MatVecMult( vValueVec[ip], JTInv, locGrad );
+				if( vJT != NULL ) RightInverse( JTInv, vJT[ip] );
+				else {
+					pMapping->jacobian_transposed( JT, vLocIP[ip] );
+					RightInverse( JTInv, JT );
+				}
+				MatVecMult( globGrad, JTInv, locGrad );
 
-				vValue[ip] = vValueVec[ip][m_component];
+				vValue[ip] = globGrad[m_component];
 
 				if(bDeriv){
-					for( size_t ip = 0; ip < nip; ++ip ) {
-						UG_ASSERT(vvvDeriv[ip].size() == 1,
-						          "Single component expected, but "<<vvvDeriv[ip].size())
-						UG_ASSERT(vvvDeriv[ip][0].size() == vLocGrad.size(),
-						          "Wrong number sh: "<<vvvDeriv[ip][0].size()<<", but expected: "<<vLocGrad.size())
-
-						for( size_t sh = 0; sh < vLocGrad.size(); ++sh ) {
-							MatVecMult( vValueVec[ip], JTInv, vLocGrad[sh] );
-							vvvDeriv[ip][0][sh] = vValueVec[ip][m_component];
-						}
+					UG_ASSERT(vvvDeriv[ip].size() == 1,
+					          "Single component expected, but "<<vvvDeriv[ip].size())
+					UG_ASSERT(vvvDeriv[ip][0].size() == nsh,
+					          "Wrong number sh: "<<vvvDeriv[ip][0].size()<<", but expected: "<<nsh)
+
+					const MathVector<refDim>* vLocGrad = rTable.grads( ip );
+					for( size_t sh = 0; sh < nsh; ++sh ) {
+						MatVecMult( globGrad, JTInv, vLocGrad[sh] );
+						vvvDeriv[ip][0][sh] = globGrad[m_component];
 					}
 				}
 			}
@@ -45,6 +45,7 @@
 #include "lib_disc/common/groups_util.h"
 #include "lib_disc/quadrature/quadrature_provider.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_sum_factorization.h"
 #include "lib_disc/spatial_disc/disc_util/fv1_geom.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
 #include "lib_disc/spatial_disc/user_data/const_user_data.h"
@@ -54,6 +55,10 @@
 #include "bindings/lua/lua_user_data.h"
 #endif
 
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
 namespace ug{
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -115,6 +120,18 @@ class IIntegrand
 	///	returns the subset
 		inline int subset() const {return m_si;}
 
+	///	returns if values() may be called concurrently from several threads
+	/**
+	 * Integrands returning true here are evaluated in parallel by
+	 * IntegrateMulti if UG4 is compiled with OpenMP support. The default
+	 * is false, since e.g. lua-based data must not be called concurrently.
+	 * A thread-safe integrand may only request shape function sets of the
+	 * spaces of the integrated grid function or of one fixed space per
+	 * reference object type, since these are created before the threads
+	 * are started (see IntegrateMulti).
+	 */
+		virtual bool thread_safe() const {return false;}
+
 	protected:
 	///	subset
 		int m_si;
@@ -334,11 +351,328 @@ number IntegrateSubset(SmartPtr<IIntegrand<number, TGridFunction::dim> > spInteg
 }
 
 
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// Generic Volume Integration Routine for several Integrands
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+/// helper for IntegrateMulti: element geometry, buffers and partial sums
+/**
+ * An instance of this class integrates all integrands on single elements
+ * and accumulates the contributions. IntegrateMulti uses one instance per
+ * thread. If private mappings are requested, the reference mappings are
+ * cloned on first use, such that concurrent instances never update a
+ * shared mapping.
+ */
+template <int WorldDim, int dim>
+class MultiIntegrateWorker
+{
+	public:
+	///	position accessor type
+		typedef typename domain_traits<WorldDim>::position_accessor_type position_accessor_type;
+
+	///	base element type (e.g. Face)
+		typedef typename domain_traits<dim>::grid_base_object grid_base_object;
+
+	///	reference mapping type
+		typedef DimReferenceMapping<dim, WorldDim> mapping_type;
+
+	public:
+	///	constructor
+		MultiIntegrateWorker(const position_accessor_type& aaPos,
+		                     const std::vector<IIntegrand<number, WorldDim>*>& vIntegrand,
+		                     int quadOrder, QuadType quadType,
+		                     bool bPrivateMappings)
+		: m_aaPos(aaPos), m_vIntegrand(vIntegrand),
+		  m_quadOrder(quadOrder), m_quadType(quadType),
+		  m_bPrivateMappings(bPrivateMappings),
+		  m_vspMapping(NUM_REFERENCE_OBJECTS),
+		  m_vSum(vIntegrand.size(), 0.0)
+		{}
+
+	///	adds the contributions of an element to the sums of all integrands
+		void integrate(grid_base_object* pElem)
+		{
+		//	get reference object id (i.e. Triangle, Quadrilateral, Tetrahedron, ...)
+			const ReferenceObjectID roid = (ReferenceObjectID) pElem->reference_object_id();
+
+		//	get quadrature Rule for reference object id and order
+			const QuadratureRule<dim>& rQuadRule
+					= QuadratureRuleProvider<dim>::get(roid, m_quadOrder, m_quadType);
+			const size_t numIP = rQuadRule.size();
+
+		//	update the reference mapping for the corners
+			mapping_type& mapping = get_mapping(roid);
+			CollectCornerCoordinates(m_vCorner, *pElem, m_aaPos, true);
+			mapping.update(&m_vCorner[0]);
+
+		//	compute global integration points and transformation matrices
+			m_vGlobIP.resize(numIP);
+			mapping.local_to_global(&(m_vGlobIP[0]), rQuadRule.points(), numIP);
+			m_vJT.resize(numIP);
+			mapping.jacobian_transposed(&(m_vJT[0]), rQuadRule.points(), numIP);
+
+		//	determinants are shared by all integrands
+			m_vDet.resize(numIP);
+			for(size_t ip = 0; ip < numIP; ++ip)
+				m_vDet[ip] = SqrtGramDeterminant(m_vJT[ip]);
+
+		//	loop integrands
+			m_vValue.resize(numIP);
+			for(size_t i = 0; i < m_vIntegrand.size(); ++i)
+			{
+				try
+				{
+					m_vIntegrand[i]->values(&(m_vValue[0]), &(m_vGlobIP[0]),
+					                        pElem, &m_vCorner[0], rQuadRule.points(),
+					                        &(m_vJT[0]), numIP);
+				}
+				UG_CATCH_THROW("Unable to compute values of integrand "<<i<<
+				               " at integration point.");
+
+			//	same order of operations as in Integrate
+				number intValElem = 0;
+				for(size_t ip = 0; ip < numIP; ++ip)
+					intValElem += m_vValue[ip] * rQuadRule.weight(ip) * m_vDet[ip];
+
+				m_vSum[i] += intValElem;
+			}
+		}
+
+	///	returns the accumulated integrals
+		const std::vector<number>& sums() const {return m_vSum;}
+
+	protected:
+	///	returns the (shared or private) mapping for a reference object id
+		mapping_type& get_mapping(ReferenceObjectID roid)
+		{
+			if(!m_bPrivateMappings)
+				return ReferenceMappingProvider::get<dim, WorldDim>(roid);
+
+			if(m_vspMapping[roid].invalid())
+				m_vspMapping[roid] = ReferenceMappingProvider::get<dim, WorldDim>(roid).clone();
+			return *m_vspMapping[roid];
+		}
+
+	protected:
+		position_accessor_type m_aaPos;
+		const std::vector<IIntegrand<number, WorldDim>*>& m_vIntegrand;
+		int m_quadOrder;
+		QuadType m_quadType;
+
+		bool m_bPrivateMappings;
+		std::vector<SmartPtr<mapping_type> > m_vspMapping;
+
+	//	We'll reuse containers to avoid reallocations
+		std::vector<MathVector<WorldDim> > m_vCorner;
+		std::vector<MathVector<WorldDim> > m_vGlobIP;
+		std::vector<MathMatrix<dim, WorldDim> > m_vJT;
+		std::vector<number> m_vDet;
+		std::vector<number> m_vValue;
+
+		std::vector<number> m_vSum;
+};
+
+/// integrates several integrands in one pass over the elements
+/**
+ * This function integrates a list of integrands over the given elements.
+ * In contrast to calling Integrate for each integrand, the elements are
+ * traversed only once and the corner coordinates, the reference mapping,
+ * the global integration points and the jacobians are computed only once
+ * per element and shared by all integrands.
+ *
+ * If UG4 is compiled with OpenMP and all integrands are thread_safe(), the
+ * element loop is distributed among the threads. The providers for
+ * quadrature rules and shape function sets create their data lazily and
+ * must not do so while the threads are running. Therefore, the first
+ * element of each reference object type is integrated serially and, in
+ * addition, the shape function sets of all passed local finite element ids
+ * are requested for every reference object type found. A thread-safe
+ * integrand must not request shape function sets of other spaces (see
+ * IIntegrand::thread_safe). The partial sums of the threads are added up
+ * in the order of the thread ids, such that the result does not depend on
+ * the timing of the threads.
+ *
+ * \param[in]		iterBegin	iterator to first geometric object to integrate
+ * \param[in]		iterEnd		iterator to last geometric object to integrate
+ * \param[in]		aaPos		position accessor
+ * \param[in]		vIntegrand	integrands
+ * \param[in]		quadOrder	order of quadrature rule
+ * \param[in]		quadType	type of quadrature rule
+ * \param[out]		vIntegral	local value of the integrals, one per integrand
+ * \param[in]		vLFEID		spaces used by the integrands (only needed
+ * 								for the threaded element loop)
+ */
+template <int WorldDim, int dim, typename TConstIterator>
+void IntegrateMulti(TConstIterator iterBegin,
+                    TConstIterator iterEnd,
+                    typename domain_traits<WorldDim>::position_accessor_type& aaPos,
+                    const std::vector<IIntegrand<number, WorldDim>*>& vIntegrand,
+                    int quadOrder, std::string quadType,
+                    std::vector<number>& vIntegral,
+                    const std::vector<LFEID>& vLFEID = std::vector<LFEID>())
+{
+	PROFILE_FUNC();
+
+	typedef typename domain_traits<dim>::grid_base_object grid_base_object;
+	typedef MultiIntegrateWorker<WorldDim, dim> worker_type;
+
+	vIntegral.assign(vIntegrand.size(), 0.0);
+	if(vIntegrand.empty()) return;
+
+//	get quad type
+	if(quadType.empty()) quadType = "best";
+	const QuadType type = GetQuadratureType(quadType);
+
+//	check if all integrands may be evaluated concurrently
+	bool bThreaded = false;
+#ifdef UG_OPENMP
+	bThreaded = (omp_get_max_threads() > 1);
+	for(size_t i = 0; i < vIntegrand.size(); ++i)
+		if(!vIntegrand[i]->thread_safe()) bThreaded = false;
+#endif
+
+//	integrate the first element of each reference object type directly and
+//	collect the remaining elements
+	worker_type serialWorker(aaPos, vIntegrand, quadOrder, type, false);
+	std::vector<grid_base_object*> vElem;
+	std::vector<bool> vRoidDone(NUM_REFERENCE_OBJECTS, false);
+	for(TConstIterator iter = iterBegin; iter != iterEnd; ++iter)
+	{
+		grid_base_object* pElem = *iter;
+		const int roid = pElem->reference_object_id();
+
+		if(!bThreaded || !vRoidDone[roid]){
+			vRoidDone[roid] = true;
+			try{
+				serialWorker.integrate(pElem);
+			}
+			UG_CATCH_THROW("IntegrateMulti: Integration failed.");
+		}
+		else
+			vElem.push_back(pElem);
+	}
+
+	vIntegral = serialWorker.sums();
+
+	if(vElem.empty()) return;
+
+#ifdef UG_OPENMP
+//	create the shape function sets of all (roid, space) pairs, that may be
+//	requested inside the parallel region
+	for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid){
+		if(!vRoidDone[roid]) continue;
+		for(size_t i = 0; i < vLFEID.size(); ++i){
+			try{
+				LocalFiniteElementProvider::get<dim>((ReferenceObjectID)roid, vLFEID[i]);
+			}
+			UG_CATCH_THROW("IntegrateMulti: No shape functions for "<<vLFEID[i]
+			               <<" on "<<(ReferenceObjectID)roid);
+		}
+	}
+
+//	integrate remaining elements in parallel, each thread accumulating
+//	locally. Exceptions must not leave the parallel region.
+	const int numElem = (int)vElem.size();
+	const int numThreads = omp_get_max_threads();
+	std::vector<std::vector<number> > vvThreadSum(numThreads);
+	std::vector<std::string> vErrMsg(numThreads);
+	int failed = 0;
+
+	#pragma omp parallel num_threads(numThreads)
+	{
+		const int tid = omp_get_thread_num();
+		worker_type worker(aaPos, vIntegrand, quadOrder, type, true);
+
+		#pragma omp for schedule(static)
+		for(int e = 0; e < numElem; ++e)
+		{
+			int bStop;
+			#pragma omp atomic read
+			bStop = failed;
+			if(bStop) continue;
+
+			try{
+				worker.integrate(vElem[e]);
+			}
+			catch(UGError& err){vErrMsg[tid] = err.get_msg();}
+			catch(std::exception& ex){vErrMsg[tid] = ex.what();}
+			catch(...){vErrMsg[tid] = "unknown exception";}
+
+			if(!vErrMsg[tid].empty()){
+				#pragma omp atomic write
+				failed = 1;
+			}
+		}
+
+		vvThreadSum[tid] = worker.sums();
+	}
+
+	for(int t = 0; t < numThreads; ++t)
+		if(!vErrMsg[t].empty())
+			UG_THROW("IntegrateMulti: Integration failed: "<<vErrMsg[t]);
+
+//	sum up in a fixed order
+	for(int t = 0; t < numThreads; ++t)
+		for(size_t i = 0; i < vvThreadSum[t].size(); ++i)
+			vIntegral[i] += vvThreadSum[t][i];
+#endif
+}
+
+template <typename TGridFunction, int dim>
+void IntegrateSubsetMulti(const std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > >& vspIntegrand,
+                          SmartPtr<TGridFunction> spGridFct,
+                          int si, int quadOrder, std::string quadType,
+                          std::vector<number>& vIntegral)
+{
+//	integrate elements of subset
+	typedef typename TGridFunction::template dim_traits<dim>::grid_base_object grid_base_object;
+	typedef typename TGridFunction::template dim_traits<dim>::const_iterator const_iterator;
+
+	std::vector<IIntegrand<number, TGridFunction::dim>*> vIntegrand(vspIntegrand.size());
+	for(size_t i = 0; i < vspIntegrand.size(); ++i){
+		SmartPtr<IIntegrand<number, TGridFunction::dim> > spIntegrand = vspIntegrand[i];
+		spIntegrand->set_subset(si);
+		vIntegrand[i] = spIntegrand.get();
+	}
+
+//	spaces of the grid function on this subset
+	std::vector<LFEID> vLFEID;
+	for(size_t fct = 0; fct < spGridFct->num_fct(); ++fct)
+		if(spGridFct->is_def_in_subset(fct, si))
+			vLFEID.push_back(spGridFct->local_finite_element_id(fct));
+
+	IntegrateMulti<TGridFunction::dim,dim,const_iterator>
+					(spGridFct->template begin<grid_base_object>(si),
+	                 spGridFct->template end<grid_base_object>(si),
+	                 spGridFct->domain()->position_accessor(),
+	                 vIntegrand,
+	                 quadOrder, quadType, vIntegral, vLFEID);
+}
+
+/// integrates several integrands on subsets, using one global reduction
+/**
+ * All integrands are evaluated in one pass over the elements of each subset
+ * (see IntegrateMulti). In parallel, the local results of all integrands are
+ * summed up by one single allreduce.
+ *
+ * \param[in]		vspIntegrand	integrands
+ * \param[in]		spGridFct		grid function
+ * \param[in]		subsets			subsets, where to integrate
+ * 									(NULL indicates that all full-dimensional
+ * 									subsets shall be considered)
+ * \param[in]		quadOrder		order of quadrature rule
+ * \param[in]		quadType		type of quadrature rule
+ * \returns			values of the integrals, one per integrand
+ */
 template <typename TGridFunction>
-number IntegrateSubsets(SmartPtr<IIntegrand<number, TGridFunction::dim> > spIntegrand,
-                        SmartPtr<TGridFunction> spGridFct,
-                        const char* subsets, int quadOrder,
-                        std::string quadType = std::string())
+std::vector<number>
+IntegrateSubsetsMulti(const std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > >& vspIntegrand,
+                      SmartPtr<TGridFunction> spGridFct,
+                      const char* subsets, int quadOrder,
+                      std::string quadType = std::string())
 {
 //	world dimensions
 	static const int dim = TGridFunction::dim;
@@ -359,8 +693,9 @@ number IntegrateSubsets(SmartPtr<IIntegrand<number, TGridFunction::dim> > spInte
 		RemoveLowerDimSubsets(ssGrp);
 	}
 
-//	reset value
-	number value = 0;
+//	reset values
+	std::vector<number> vValue(vspIntegrand.size(), 0.0);
+	std::vector<number> vSubsetValue;
 
 //	loop subsets
 	for(size_t i = 0; i < ssGrp.size(); ++i)
@@ -374,32 +709,53 @@ number IntegrateSubsets(SmartPtr<IIntegrand<number, TGridFunction::dim> > spInte
 			         " World Dimension is "<<dim<<". Cannot integrate this.");
 
 	//	integrate elements of subset
+		vSubsetValue.clear();
 		try{
 		switch(ssGrp.dim(i))
 		{
 			case DIM_SUBSET_EMPTY_GRID: break;
-			case 1: value += IntegrateSubset<TGridFunction, 1>(spIntegrand, spGridFct, si, quadOrder, quadType); break;
-			case 2: value += IntegrateSubset<TGridFunction, 2>(spIntegrand, spGridFct, si, quadOrder, quadType); break;
-			case 3: value += IntegrateSubset<TGridFunction, 3>(spIntegrand, spGridFct, si, quadOrder, quadType); break;
+			case 1: IntegrateSubsetMulti<TGridFunction, 1>(vspIntegrand, spGridFct, si, quadOrder, quadType, vSubsetValue); break;
+			case 2: IntegrateSubsetMulti<TGridFunction, 2>(vspIntegrand, spGridFct, si, quadOrder, quadType, vSubsetValue); break;
+			case 3: IntegrateSubsetMulti<TGridFunction, 3>(vspIntegrand, spGridFct, si, quadOrder, quadType, vSubsetValue); break;
 			default: UG_THROW("IntegrateSubsets: Dimension "<<ssGrp.dim(i)<<" not supported. "
 			                  " World dimension is "<<dim<<".");
 		}
 		}
 		UG_CATCH_THROW("IntegrateSubsets: Integration failed on subset "<<si);
+
+		for(size_t k = 0; k < vSubsetValue.size(); ++k)
+			vValue[k] += vSubsetValue[k];
 	}
 
 #ifdef UG_PARALLEL
-	// sum over processes
-	if(pcl::NumProcs() > 1)
+	// sum over processes, all integrals at once
+	if(pcl::NumProcs() > 1 && !vValue.empty())
 	{
 		pcl::ProcessCommunicator com;
-		number local = value;
-		com.allreduce(&local, &value, 1, PCL_DT_DOUBLE, PCL_RO_SUM);
+		std::vector<number> vLocal(vValue);
+		com.allreduce(&vLocal[0], &vValue[0], (int)vValue.size(),
+		              PCL_DT_DOUBLE, PCL_RO_SUM);
 	}
 #endif
 
 //	return the result
-	return value;
+	return vValue;
+}
+
+/// integrates an integrand on subsets
+/**
+ * Single-integrand version of IntegrateSubsetsMulti.
+ *
+ * \returns			value of the integral
+ */
+template <typename TGridFunction>
+number IntegrateSubsets(SmartPtr<IIntegrand<number, TGridFunction::dim> > spIntegrand,
+                        SmartPtr<TGridFunction> spGridFct,
+                        const char* subsets, int quadOrder,
+                        std::string quadType = std::string())
+{
+	std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > > vspIntegrand(1, spIntegrand);
+	return IntegrateSubsetsMulti(vspIntegrand, spGridFct, subsets, quadOrder, quadType)[0];
 }
 
 
@@ -448,6 +804,9 @@ class UserDataIntegrand
 						" data requires grid function.")
 		};
 
+	///	forwards the capability of the data
+		virtual bool thread_safe() const {return m_spData->thread_safe();}
+
 	/// \copydoc IIntegrand::values
 		template <int elemDim>
 		void evaluate(TData vValue[],
@@ -536,6 +895,51 @@ template <typename TGridFunction>
 number Integral(SmartPtr<UserData<number, TGridFunction::dim> > spData, SmartPtr<TGridFunction> spGridFct)
 {return Integral(spData, spGridFct, NULL, 0.0, 1, "best");}
 
+/// integrates several user data in one pass, using one global reduction
+/**
+ * This function computes the integrals of all passed data over the given
+ * subsets. The elements are traversed only once and in parallel the
+ * results are summed up by one single allreduce.
+ *
+ * \param[in]		vspData		data to integrate
+ * \param[in]		spGridFct	grid function
+ * \param[in]		subsets		subsets, where to integrate
+ * 								(NULL indicates that all full-dimensional subsets
+ * 								shall be considered)
+ * \param[in]		time		point in time
+ * \param[in]		quadOrder	order of quadrature rule
+ * \param[in]		quadType	type of quadrature rule
+ * \returns			values of the integrals, one per data
+ */
+template <typename TGridFunction>
+std::vector<number> Integrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData,
+                              SmartPtr<TGridFunction> spGridFct,
+                              const char* subsets, number time,
+                              int quadOrder, std::string quadType)
+{
+	std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > > vspIntegrand;
+	for(size_t i = 0; i < vspData.size(); ++i)
+		vspIntegrand.push_back(make_sp(new UserDataIntegrand<number, TGridFunction>(vspData[i], spGridFct, time)));
+
+	return IntegrateSubsetsMulti(vspIntegrand, spGridFct, subsets, quadOrder, quadType);
+}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData, SmartPtr<TGridFunction> spGridFct,const char* subsets,number time, int order)
+{return Integrals(vspData, spGridFct, subsets, time, order, "best");}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData, SmartPtr<TGridFunction> spGridFct,const char* subsets,number time)
+{return Integrals(vspData, spGridFct, subsets, time, 1, "best");}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData, SmartPtr<TGridFunction> spGridFct,const char* subsets)
+{return Integrals(vspData, spGridFct, subsets, 0.0, 1, "best");}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData, SmartPtr<TGridFunction> spGridFct)
+{return Integrals(vspData, spGridFct, NULL, 0.0, 1, "best");}
+
 ///////////////
 // const data
 ///////////////
@@ -683,6 +1087,15 @@ class L2ErrorIntegrand
 				UG_THROW("L2ErrorIntegrand::evaluate: Wrong number of"
 						" multi indices.");
 
+		//	get values at shape points (e.g. corner for P1 fct)
+			std::vector<number> vCoeff(num_sh);
+			for(size_t sh = 0; sh < num_sh; ++sh)
+				vCoeff[sh] = DoFRef(*m_spGridFct, ind[sh]);
+
+		// 	compute approximated solution at integration points
+			EvaluateShapeExpansion<elemDim>(vValue, NULL, roid, m_id,
+			                                &vCoeff[0], vLocIP, numIP);
+
 		//	loop all integration points
 			for(size_t ip = 0; ip < numIP; ++ip)
 			{
@@ -690,19 +1103,8 @@ class L2ErrorIntegrand
 				number exactSolIP;
 				(*m_spExactSolution)(exactSolIP, vGlobIP[ip], m_time, this->subset());
 
-			// 	compute approximated solution at integration point
-				number approxSolIP = 0.0;
-				for(size_t sh = 0; sh < num_sh; ++sh)
-				{
-				//	get value at shape point (e.g. corner for P1 fct)
-					const number valSH = DoFRef(*m_spGridFct, ind[sh]);
-
-				//	add shape fct at ip * value at shape
-					approxSolIP += valSH * rTrialSpace.shape(sh, vLocIP[ip]);
-				}
-
 			//	get squared of difference
-				vValue[ip] = (exactSolIP - approxSolIP);
+				vValue[ip] = (exactSolIP - vValue[ip]);
 				vValue[ip] *= vValue[ip];
 			}
 
@@ -1050,8 +1452,18 @@ class H1ErrorIntegrand
 				UG_THROW("H1ErrorIntegrand::evaluate: Wrong number of"
 						" multi indices.");
 
+		//	get values at shape points (e.g. corner for P1 fct)
+			std::vector<number> vCoeff(num_sh);
+			for(size_t sh = 0; sh < num_sh; ++sh)
+				vCoeff[sh] = DoFRef(*m_spGridFct, ind[sh]);
+
+		// 	compute approximated solution and local gradient at integration points
+			std::vector<number> vApproxSolIP(numIP);
+			std::vector<MathVector<elemDim> > vLocGradIP(numIP);
+			EvaluateShapeExpansion<elemDim>(&vApproxSolIP[0], &vLocGradIP[0],
+			                                roid, m_id, &vCoeff[0], vLocIP, numIP);
+
 		//	loop all integration points
-			std::vector<MathVector<elemDim> > vLocGradient(num_sh);
 			for(size_t ip = 0; ip < numIP; ++ip)
 			{
 			//	compute exact solution at integration point
@@ -1062,29 +1474,14 @@ class H1ErrorIntegrand
 				MathVector<worldDim> exactGradIP;
 				(*m_spExactGrad)(exactGradIP, vGlobIP[ip], m_time, this->subset());
 
-			//	compute shape gradients at ip
-				rTrialSpace.grads(&vLocGradient[0], vLocIP[ip]);
-
-			// 	compute approximated solution at integration point
-				number approxSolIP = 0.0;
-				MathVector<elemDim> locTmp; VecSet(locTmp, 0.0);
-				for(size_t sh = 0; sh < num_sh; ++sh)
-				{
-				//	get value at shape point (e.g. corner for P1 fct)
-					const number valSH = DoFRef(*m_spGridFct, ind[sh]);
-
-				//	add shape fct at ip * value at shape
-					approxSolIP += valSH * rTrialSpace.shape(sh, vLocIP[ip]);
-
-				//	add gradient at ip
-					VecScaleAppend(locTmp, valSH, vLocGradient[sh]);
-				}
+			// 	approximated solution at integration point
+				const number approxSolIP = vApproxSolIP[ip];
 
 			//	compute global gradient
 				MathVector<worldDim> approxGradIP;
 				MathMatrix<worldDim, elemDim> JTInv;
 				Inverse(JTInv, vJT[ip]);
-				MatVecMult(approxGradIP, JTInv, locTmp);
+				MatVecMult(approxGradIP, JTInv, vLocGradIP[ip]);
 
 			//	get squared of difference
 				vValue[ip] = (exactSolIP - approxSolIP) * (exactSolIP - approxSolIP);
@@ -1407,6 +1804,9 @@ class L2FuncIntegrand
 			IIntegrand<number, worldDim>::set_subset(si);
 		}
 
+	///	only reads from the grid function
+		virtual bool thread_safe() const {return true;}
+
 	/// \copydoc IIntegrand::values
 		template <int elemDim>
 		void evaluate(number vValue[],
@@ -1440,24 +1840,18 @@ class L2FuncIntegrand
 				UG_THROW("L2FuncIntegrand::values: Wrong number of"
 						" multi indices.");
 
-		//	loop all integration points
-			for(size_t ip = 0; ip < numIP; ++ip)
-			{
-
-			// 	compute approximated solution at integration point
-				number approxSolIP = 0.0;
-				for(size_t sh = 0; sh < num_sh; ++sh)
-				{
-					//	get value at shape point (e.g. corner for P1 fct)
-					//	and add shape fct at ip * value at shape
-					const number valSH = DoFRef((*m_spGridFct), ind[sh]);
-					approxSolIP += valSH * rTrialSpace.shape(sh, vLocIP[ip]);
-				}
+		//	get values at shape points (e.g. corner for P1 fct)
+			std::vector<number> vCoeff(num_sh);
+			for(size_t sh = 0; sh < num_sh; ++sh)
+				vCoeff[sh] = DoFRef((*m_spGridFct), ind[sh]);
 
-				//	get square
-				vValue[ip] = approxSolIP*approxSolIP;
+		// 	compute approximated solution at integration points
+			EvaluateShapeExpansion<elemDim>(vValue, NULL, roid, m_id,
+			                                &vCoeff[0], vLocIP, numIP);
 
-			}
+		//	get square
+			for(size_t ip = 0; ip < numIP; ++ip)
+				vValue[ip] = vValue[ip]*vValue[ip];
 
 			}
 			UG_CATCH_THROW("L2FuncIntegrand::values: trial space missing.");
@@ -1507,6 +1901,40 @@ number L2Norm(SmartPtr<TGridFunction> spGridFct, const char* cmp, int quadOrder)
 	return L2Norm(spGridFct, cmp, quadOrder, NULL);
 }
 
+/**
+ * This function computes the L2-norms of several components of a grid
+ * function in one pass over the elements (see IntegrateSubsetsMulti).
+ *
+ * \param[in]		spGridFct	grid function
+ * \param[in]		cmps		symbolic names of functions, comma separated
+ * \param[in]		quadOrder	order of quadrature rule
+ * \param[in]		subsets		subsets, where to interpolate
+ * 								(NULL indicates that all full-dimensional subsets
+ * 								shall be considered)
+ * \returns			l2-norms, one per component
+ */
+template <typename TGridFunction>
+std::vector<number> L2Norms(SmartPtr<TGridFunction> spGridFct, const char* cmps,
+                            int quadOrder, const char* subsets)
+{
+	FunctionGroup fctGrp(spGridFct->function_pattern(), cmps);
+
+	std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > > vspIntegrand;
+	for(size_t i = 0; i < fctGrp.size(); ++i)
+		vspIntegrand.push_back(make_sp(new L2FuncIntegrand<TGridFunction>(spGridFct, fctGrp[i])));
+
+	std::vector<number> vNorm = IntegrateSubsetsMulti(vspIntegrand, spGridFct, subsets, quadOrder);
+	for(size_t i = 0; i < vNorm.size(); ++i)
+		vNorm[i] = sqrt(vNorm[i]);
+	return vNorm;
+}
+
+template <typename TGridFunction>
+std::vector<number> L2Norms(SmartPtr<TGridFunction> spGridFct, const char* cmps, int quadOrder)
+{
+	return L2Norms(spGridFct, cmps, quadOrder, NULL);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Integrand
 ////////////////////////////////////////////////////////////////////////////////
@@ -1541,6 +1969,9 @@ class StdFuncIntegrand
 			IIntegrand<number, worldDim>::set_subset(si);
 		}
 
+	///	only reads from the grid function
+		virtual bool thread_safe() const {return true;}
+
 	/// \copydoc IIntegrand::values
 		template <int elemDim>
 		void evaluate(number vValue[],
@@ -1574,24 +2005,14 @@ class StdFuncIntegrand
 				UG_THROW("StdFuncIntegrand::evaluate: Wrong number of"
 						" multi indices.");
 
-		//	loop all integration points
-			for(size_t ip = 0; ip < numIP; ++ip)
-			{
-
-			// 	compute approximated solution at integration point
-				number approxSolIP = 0.0;
-				for(size_t sh = 0; sh < num_sh; ++sh)
-				{
-					//	get value at shape point (e.g. corner for P1 fct)
-					//	and add shape fct at ip * value at shape
-					const number valSH = DoFRef((*m_spGridFct), ind[sh]);
-					approxSolIP += valSH * rTrialSpace.shape(sh, vLocIP[ip]);
-				}
-
-				//	get function value at ip
-				vValue[ip] = approxSolIP;
+		//	get values at shape points (e.g. corner for P1 fct)
+			std::vector<number> vCoeff(num_sh);
+			for(size_t sh = 0; sh < num_sh; ++sh)
+				vCoeff[sh] = DoFRef((*m_spGridFct), ind[sh]);
 
-			}
+		// 	compute function values at integration points
+			EvaluateShapeExpansion<elemDim>(vValue, NULL, roid, m_id,
+			                                &vCoeff[0], vLocIP, numIP);
 
 			}
 			UG_CATCH_THROW("StdFuncIntegrand::evaluate: trial space missing.");
@@ -1711,6 +2132,45 @@ number Integral(SmartPtr<TGridFunction> spGridFct, const char* cmp)
 	return Integral(spGridFct, cmp, NULL, 1);
 }
 
+/**
+ * This function integrates several components of a grid function in one
+ * pass over the elements (see IntegrateSubsetsMulti). In contrast to
+ * Integral, only subsets of dimension >= 1 are supported.
+ *
+ * \param[in]		spGridFct	grid function
+ * \param[in]		cmps		symbolic names of functions, comma separated
+ * \param[in]		subsets		subsets, where to integrate
+ * 								(NULL indicates that all full-dimensional subsets
+ * 								shall be considered)
+ * \param[in]		quadOrder	order of quadrature rule
+ * \returns			integrals, one per component
+ */
+template <typename TGridFunction>
+std::vector<number> Integrals(SmartPtr<TGridFunction> spGridFct, const char* cmps,
+                              const char* subsets, int quadOrder)
+{
+	FunctionGroup fctGrp(spGridFct->function_pattern(), cmps);
+
+	std::vector<SmartPtr<IIntegrand<number, TGridFunction::dim> > > vspIntegrand;
+	for(size_t i = 0; i < fctGrp.size(); ++i)
+		vspIntegrand.push_back(make_sp(new StdFuncIntegrand<TGridFunction>(spGridFct, fctGrp[i])));
+
+	return IntegrateSubsetsMulti(vspIntegrand, spGridFct, subsets, quadOrder);
+}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(SmartPtr<TGridFunction> spGridFct, const char* cmps,
+                              const char* subsets)
+{
+	return Integrals(spGridFct, cmps, subsets, 1);
+}
+
+template <typename TGridFunction>
+std::vector<number> Integrals(SmartPtr<TGridFunction> spGridFct, const char* cmps)
+{
+	return Integrals(spGridFct, cmps, NULL, 1);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__FUNCTION_SPACES__INTEGRATE_TEST__
+#define __H__UG__LIB_DISC__FUNCTION_SPACES__INTEGRATE_TEST__
+
+#include <vector>
+#include <cmath>
+
+#include "lib_disc/function_spaces/integrate.h"
+
+namespace ug{
+
+//
+//	Consistency checks for the multi-integrand integration routines
+//
+
+///	returns if two integrals agree up to summation order effects
+inline bool IntegralsAgree(number a, number b)
+{
+	return std::fabs(a - b) <= 1e-12 * std::max(1.0, std::max(std::fabs(a), std::fabs(b)));
+}
+
+/// checks that Integrals(data, u) equals {Integral(data[0], u), ...}
+/**
+ * The data are integrated once in one pass and once separately. Throws if
+ * the results do not agree.
+ */
+template <typename TGridFunction>
+void TestIntegrals(const std::vector<SmartPtr<UserData<number, TGridFunction::dim> > >& vspData,
+                   SmartPtr<TGridFunction> spGridFct,
+                   const char* subsets, number time, int quadOrder)
+{
+	UG_LOG(">> Starting TestIntegrals: " << std::endl);
+
+	const std::vector<number> vMulti
+		= Integrals(vspData, spGridFct, subsets, time, quadOrder, "best");
+
+	if(vMulti.size() != vspData.size())
+		UG_THROW("TestIntegrals: Expected "<<vspData.size()<<" integrals, "
+		         "but got "<<vMulti.size());
+
+	for(size_t i = 0; i < vspData.size(); ++i)
+	{
+		const number single
+			= Integral(vspData[i], spGridFct, subsets, time, quadOrder, "best");
+
+		UG_LOG("  Data "<<i<<": Integrals = "<<vMulti[i]<<", Integral = "<<single
+		       <<(vspData[i]->thread_safe() ? " (thread-safe)" : "")<<std::endl);
+
+		if(!IntegralsAgree(vMulti[i], single))
+			UG_THROW("TestIntegrals: Mismatch for data "<<i<<": "<<vMulti[i]
+			         <<" != "<<single);
+	}
+
+	UG_LOG(">> TestIntegrals passed." << std::endl);
+}
+
+/// checks that L2Norms(u, cmps) equals {L2Norm(u, cmp), ...}
+template <typename TGridFunction>
+void TestL2Norms(SmartPtr<TGridFunction> spGridFct, const char* cmps, int quadOrder)
+{
+	UG_LOG(">> Starting TestL2Norms: " << std::endl);
+
+	const std::vector<number> vMulti = L2Norms(spGridFct, cmps, quadOrder);
+	const std::vector<std::string> vCmp = TokenizeTrimString(cmps);
+
+	if(vMulti.size() != vCmp.size())
+		UG_THROW("TestL2Norms: Expected "<<vCmp.size()<<" norms, "
+		         "but got "<<vMulti.size());
+
+	for(size_t i = 0; i < vCmp.size(); ++i)
+	{
+		const number single = L2Norm(spGridFct, vCmp[i].c_str(), quadOrder);
+
+		UG_LOG("  Component "<<vCmp[i]<<": L2Norms = "<<vMulti[i]
+		       <<", L2Norm = "<<single<<std::endl);
+
+		if(!IntegralsAgree(vMulti[i], single))
+			UG_THROW("TestL2Norms: Mismatch for component "<<vCmp[i]<<": "
+			         <<vMulti[i]<<" != "<<single);
+	}
+
+	UG_LOG(">> TestL2Norms passed." << std::endl);
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__FUNCTION_SPACES__INTEGRATE_TEST__ */
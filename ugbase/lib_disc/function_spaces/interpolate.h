@@ -48,8 +48,175 @@
 #include "bindings/lua/lua_user_data.h"
 #endif
 
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
 namespace ug{
 
+////////////////////////////////////////////////////////////////////////////////
+// Blocked evaluation of interpolation values
+////////////////////////////////////////////////////////////////////////////////
+
+/// collects dof positions and evaluates the interpolation values blockwise
+/**
+ * The dofs to be interpolated are added together with their global position.
+ * Whenever enough dofs have been collected (and when flush() is called), the
+ * user data is evaluated for whole blocks of positions by a single call, e.g.
+ * a single lua call for a LuaUserData with batch callback, and the values are
+ * written to the grid function.
+ *
+ * If UG4 is compiled with OpenMP and the user data is thread_safe(), the
+ * blocks are distributed among the threads. Each dof is written by one
+ * thread only, since dofs added more than once are skipped if requested.
+ */
+template <typename TGridFunction>
+class InterpolationBuffer
+{
+	public:
+	///	world dimension
+		static const int dim = TGridFunction::dim;
+
+	///	number of positions evaluated by one call of the user data
+		static const size_t blockSize = 256;
+
+	///	number of positions collected before the evaluation
+		static const size_t chunkSize = 64 * blockSize;
+
+	public:
+	///	constructor
+	/**
+	 * \param[in] spInterpolFunction	data providing interpolation values
+	 * \param[in] spGridFct				interpolated grid function
+	 * \param[in] time					time point
+	 * \param[in] si					subset index passed to the data
+	 * \param[in] bSkipDuplicates		skip dofs that have been added before
+	 */
+		InterpolationBuffer(SmartPtr<UserData<number, dim> > spInterpolFunction,
+		                    SmartPtr<TGridFunction> spGridFct,
+		                    number time, int si, bool bSkipDuplicates)
+		: m_spInterpolFunction(spInterpolFunction), m_spGridFct(spGridFct),
+		  m_time(time), m_si(si), m_bSkipDuplicates(bSkipDuplicates)
+		{
+			m_vInd.reserve(chunkSize);
+			m_vPos.reserve(chunkSize);
+		}
+
+	///	adds a dof to be interpolated at a global position
+		void add(const DoFIndex& ind, const MathVector<dim>& pos)
+		{
+			if(m_bSkipDuplicates){
+				const size_t index = ind[0], comp = ind[1];
+				if(comp >= m_vvAdded.size()) m_vvAdded.resize(comp + 1);
+				std::vector<bool>& vAdded = m_vvAdded[comp];
+				if(vAdded.empty()) vAdded.resize(m_spGridFct->num_indices(), false);
+				if(vAdded[index]) return;
+				vAdded[index] = true;
+			}
+
+			m_vInd.push_back(ind);
+			m_vPos.push_back(pos);
+
+			if(m_vInd.size() >= chunkSize) flush();
+		}
+
+	///	evaluates the data at all collected positions
+		void flush();
+
+	protected:
+	///	evaluates a block of collected positions
+		void evaluate_block(size_t first, size_t num, std::vector<number>& vValue)
+		{
+			vValue.resize(num);
+			(*m_spInterpolFunction)(&vValue[0], &m_vPos[first], m_time, m_si, num);
+
+			for(size_t i = 0; i < num; ++i)
+				DoFRef(*m_spGridFct, m_vInd[first + i]) = vValue[i];
+		}
+
+	protected:
+		SmartPtr<UserData<number, dim> > m_spInterpolFunction;
+		SmartPtr<TGridFunction> m_spGridFct;
+		number m_time;
+		int m_si;
+
+	///	collected dofs and positions
+		std::vector<DoFIndex> m_vInd;
+		std::vector<MathVector<dim> > m_vPos;
+
+	///	flags for the dofs already added (per component)
+		bool m_bSkipDuplicates;
+		std::vector<std::vector<bool> > m_vvAdded;
+
+	///	buffer for values
+		std::vector<number> m_vValue;
+};
+
+template <typename TGridFunction>
+void InterpolationBuffer<TGridFunction>::flush()
+{
+	const size_t numPos = m_vInd.size();
+	if(numPos == 0) return;
+
+	const int numBlock = (int)((numPos + blockSize - 1) / blockSize);
+
+	bool bThreaded = false;
+#ifdef UG_OPENMP
+	bThreaded = (omp_get_max_threads() > 1) && (numBlock > 1)
+				&& m_spInterpolFunction->thread_safe();
+#endif
+
+	if(!bThreaded){
+		for(int b = 0; b < numBlock; ++b){
+			const size_t first = b * blockSize;
+			evaluate_block(first, std::min(blockSize, numPos - first), m_vValue);
+		}
+	}
+#ifdef UG_OPENMP
+	else{
+	//	exceptions must not leave the parallel region
+		const int numThreads = omp_get_max_threads();
+		std::vector<std::string> vErrMsg(numThreads);
+		int failed = 0;
+
+		#pragma omp parallel num_threads(numThreads)
+		{
+			const int tid = omp_get_thread_num();
+			std::vector<number> vValue;
+
+			#pragma omp for schedule(static)
+			for(int b = 0; b < numBlock; ++b)
+			{
+				int bStop;
+				#pragma omp atomic read
+				bStop = failed;
+				if(bStop) continue;
+
+				try{
+					const size_t first = b * blockSize;
+					evaluate_block(first, std::min(blockSize, numPos - first), vValue);
+				}
+				catch(UGError& err){vErrMsg[tid] = err.get_msg();}
+				catch(std::exception& ex){vErrMsg[tid] = ex.what();}
+				catch(...){vErrMsg[tid] = "unknown exception";}
+
+				if(!vErrMsg[tid].empty()){
+					#pragma omp atomic write
+					failed = 1;
+				}
+			}
+		}
+
+		for(int t = 0; t < numThreads; ++t)
+			if(!vErrMsg[t].empty())
+				UG_THROW("InterpolationBuffer: Evaluation failed: "<<vErrMsg[t]);
+	}
+#endif
+
+	m_vInd.clear();
+	m_vPos.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Interpolate on Vertices only
 ////////////////////////////////////////////////////////////////////////////////
@@ -92,6 +259,10 @@ void InterpolateOnVertices(SmartPtr<UserData<number, TGridFunction::dim> > spInt
 	//	skip if function is not defined in subset
 		if(!spGridFct->is_def_in_subset(fct, si)) continue;
 
+	//	every vertex is visited once, such that no duplicates occur
+		InterpolationBuffer<TGridFunction> buffer(spInterpolFunction, spGridFct,
+		                                          time, si, false);
+
 	// 	iterate over all elements
 		iterEnd = spGridFct->template end<Vertex>(si);
 		iter = spGridFct->template begin<Vertex>(si);
@@ -101,22 +272,18 @@ void InterpolateOnVertices(SmartPtr<UserData<number, TGridFunction::dim> > spInt
 			Vertex* vrt = *iter;
 
 		//	global position
-			position_type glob_pos = aaPos[vrt];
-
-		//	value at position
-			number val;
-			(*spInterpolFunction)(val, glob_pos, time, si);
+			const position_type& glob_pos = aaPos[vrt];
 
 		//	get multiindices of element
 			spGridFct->dof_indices(vrt, fct, ind);
 
 		// 	loop all dofs
 			for(size_t i = 0; i < ind.size(); ++i)
-			{
-			//	set value
-				DoFRef(*spGridFct, ind[i]) = val;
-			}
+				buffer.add(ind[i], glob_pos);
 		}
+
+	//	evaluate remaining positions
+		buffer.flush();
 	}
 }
 
@@ -180,6 +347,12 @@ void InterpolateOnElements(
 //	create a reference mapping
 	ReferenceMapping<ref_elem_type, domain_type::dim> mapping;
 
+//	dofs shared by several elements are evaluated only once
+	InterpolationBuffer<TGridFunction> buffer(spInterpolFunction, spGridFct,
+	                                          time, si, true);
+	std::vector<position_type> vCorner;
+	std::vector<DoFIndex> ind;
+
 // 	iterate over all elements
 	for( ; iter != iterEnd; ++iter)
 	{
@@ -187,14 +360,12 @@ void InterpolateOnElements(
 		TElem* elem = *iter;
 
 	//	get all corner coordinates
-		std::vector<position_type> vCorner;
 		CollectCornerCoordinates(vCorner, *elem, *spGridFct->domain());
 
 	//	update the reference mapping for the corners
 		mapping.update(&vCorner[0]);
 
 	//	get multiindices of element
-		std::vector<DoFIndex> ind;
 		spGridFct->dof_indices(elem, fct, ind);
 
 	//	check multi indices
@@ -212,13 +383,12 @@ void InterpolateOnElements(
 			mapping.local_to_global(glob_pos, loc_pos[i]);
 
 		//	value at position
-			number val;
-			(*spInterpolFunction)(val, glob_pos, time, si);
-
-		//	set value
-			DoFRef(*spGridFct, ind[i]) = val;
+			buffer.add(ind[i], glob_pos);
 		}
 	}
+
+//	evaluate remaining positions
+	buffer.flush();
 }
 
 /**
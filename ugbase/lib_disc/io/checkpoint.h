@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT__
+
+#include <vector>
+#include <string>
+
+#include "common/util/binary_buffer.h"
+#include "lib_grid/lib_grid.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/function_spaces/grid_function.h"
+
+namespace ug{
+
+/// Checkpoint of a distributed domain together with a set of grid functions
+/**
+ * This class writes and reads a coherent restart point of a (distributed)
+ * computation. A checkpoint contains
+ *
+ *  - the elements of the MultiGrid including the level hierarchy,
+ *  - the vertex positions and the subset handler of the domain,
+ *  - in parallel: the horizontal and vertical layouts of all element types,
+ *  - for each added grid function: the DoF numbering and the values.
+ *
+ * All processes write into one single file using WriteCombinedParallelFile,
+ * i.e. each process stores exactly its part of the distributed grid. A
+ * restart on the same number of processes therefore only reads the file.
+ * No partitioning, redistribution or refinement takes place and, since the
+ * elements are recreated in the same order, the DoF numbering usually
+ * coincides with the stored one. If not, the DoFs are permuted to the
+ * stored numbering.
+ *
+ * Usage:
+ * <pre>
+ *   -- writing
+ *   cp = Checkpoint()
+ *   cp:add(u); cp:add(uOld)
+ *   cp:write("run.ug4cp")
+ *
+ *   -- restart (instead of LoadDomain, distribution and refinement)
+ *   dom = Domain()
+ *   cp = Checkpoint()
+ *   cp:read_domain(dom, "run.ug4cp")
+ *   approxSpace = ApproximationSpace(dom) ...
+ *   u = GridFunction(approxSpace); uOld = GridFunction(approxSpace)
+ *   cp:add(u); cp:add(uOld)
+ *   cp:read_functions()
+ * </pre>
+ *
+ * The grid functions must be added in the same order as they have been
+ * written. Additional subset handlers, refinement projectors, periodic
+ * boundary identifications and other grid attachments are not part of
+ * the checkpoint and have to be set up again by the script.
+ *
+ * \tparam	TDomain		domain type
+ * \tparam	TAlgebra	algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class Checkpoint
+{
+	public:
+	///	grid function type
+		typedef GridFunction<TDomain, TAlgebra> function_type;
+
+	///	domain type
+		typedef TDomain domain_type;
+
+	///	world dimension
+		static const int dim = TDomain::dim;
+
+	public:
+	///	constructor
+		Checkpoint() : m_numFctInFile(0) {}
+
+	///	adds a grid function to the checkpoint
+		void add(SmartPtr<function_type> spGridFct);
+
+	///	removes all grid functions
+		void clear() {m_vspGridFct.clear();}
+
+	///	number of added grid functions
+		size_t num_functions() const {return m_vspGridFct.size();}
+
+	///	writes domain and all added grid functions to file
+	/**
+	 * All added grid functions must be defined on the same domain. This
+	 * method must be called on all processes.
+	 */
+		void write(const char* filename);
+
+	///	reads the domain stored in a checkpoint
+	/**
+	 * The passed domain must be empty. The file must have been written by
+	 * the same number of processes. After the call, approximation spaces
+	 * and grid functions can be created for the domain, whose values are
+	 * then restored by read_functions. This method must be called on all
+	 * processes.
+	 */
+		void read_domain(SmartPtr<TDomain> spDomain, const char* filename);
+
+	///	restores numbering and values of all added grid functions
+	/**
+	 * The added grid functions must be defined on the domain passed to
+	 * read_domain and the grid must not have been changed in between.
+	 */
+		void read_functions();
+
+	protected:
+	///	writes the layouts of an element type
+		template <class TElem>
+		void write_layouts(BinaryBuffer& out, MultiGrid& mg,
+		                   MultiElementAttachmentAccessor<AInt>& aaIndex);
+
+	///	reads the layouts of an element type
+		template <class TElem>
+		void read_layouts(BinaryBuffer& in, MultiGrid& mg);
+
+	///	writes the inner algebra indices of the elements of a type
+		template <class TBaseElem>
+		void write_indices(BinaryBuffer& out, DoFDistribution& dd,
+		                   MultiElementAttachmentAccessor<AInt>& aaIndex);
+
+	///	reads the inner algebra indices and computes the index mapping
+		template <class TBaseElem>
+		bool read_indices(BinaryBuffer& in, DoFDistribution& dd,
+		                  std::vector<size_t>& vNewInd);
+
+	///	writes the values of a grid function
+		void write_values(BinaryBuffer& out, const function_type& u);
+
+	///	reads the values of a grid function
+		void read_values(BinaryBuffer& in, function_type& u);
+
+	///	elements in the order of the checkpoint
+	///	\{
+		std::vector<Vertex*>& elements(Vertex*)	{return m_vVrt;}
+		std::vector<Edge*>& elements(Edge*)		{return m_vEdge;}
+		std::vector<Face*>& elements(Face*)		{return m_vFace;}
+		std::vector<Volume*>& elements(Volume*)	{return m_vVol;}
+	///	\}
+
+	protected:
+	///	added grid functions
+		std::vector<SmartPtr<function_type> > m_vspGridFct;
+
+	///	domain read by read_domain
+		SmartPtr<TDomain> m_spDomain;
+
+	///	elements of the read domain, in the order of the checkpoint
+	///	\{
+		std::vector<Vertex*> m_vVrt;
+		std::vector<Edge*> m_vEdge;
+		std::vector<Face*> m_vFace;
+		std::vector<Volume*> m_vVol;
+	///	\}
+
+	///	remaining data of the file (i.e. the grid function part)
+		BinaryBuffer m_fctBuffer;
+
+	///	number of grid functions in file
+		size_t m_numFctInFile;
+};
+
+} // end namespace ug
+
+#include "checkpoint_impl.h"
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT__ */
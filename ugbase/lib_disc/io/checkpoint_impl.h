@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+
+#include <cstdio>
+
+#include "checkpoint.h"
+#include "common/serialization.h"
+#include "common/profiler/profiler.h"
+#include "lib_grid/algorithms/serialization.h"
+#include "lib_grid/lib_grid_messages.h"
+
+#ifdef UG_PARALLEL
+#include "pcl/pcl.h"
+#include "pcl/parallel_file.h"
+#endif
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+// File access
+////////////////////////////////////////////////////////////////////////////////
+
+///	magic number at the beginning of each process part of a checkpoint
+const int CHECKPOINT_MAGIC = 0x75673463;
+
+///	version of the checkpoint format
+const int CHECKPOINT_VERSION = 1;
+
+///	writes the buffer of each process into one combined file
+inline void WriteCheckpointFile(BinaryBuffer& buf, const char* filename)
+{
+#ifdef UG_PARALLEL
+	pcl::WriteCombinedParallelFile(buf, filename);
+#else
+//	same layout as WriteCombinedParallelFile for one process
+	FILE* f = fopen(filename, "wb");
+	if(!f) UG_THROW("Checkpoint: cannot open file '"<<filename<<"' for writing.");
+
+	int numProcs = 1;
+	int nextOffset = 2*sizeof(int) + buf.write_pos();
+	bool bOK = fwrite(&numProcs, sizeof(int), 1, f) == 1
+			&& fwrite(&nextOffset, sizeof(int), 1, f) == 1
+			&& fwrite(buf.buffer(), sizeof(char), buf.write_pos(), f) == buf.write_pos();
+	fclose(f);
+
+	if(!bOK) UG_THROW("Checkpoint: error while writing file '"<<filename<<"'.");
+#endif
+}
+
+///	reads the part of the calling process from a combined file
+inline void ReadCheckpointFile(BinaryBuffer& buf, const char* filename)
+{
+#ifdef UG_PARALLEL
+	pcl::ReadCombinedParallelFile(buf, filename);
+#else
+	FILE* f = fopen(filename, "rb");
+	if(!f) UG_THROW("Checkpoint: cannot open file '"<<filename<<"' for reading.");
+
+	int numProcs = 0, nextOffset = 0;
+	if(fread(&numProcs, sizeof(int), 1, f) != 1
+		|| fread(&nextOffset, sizeof(int), 1, f) != 1){
+		fclose(f);
+		UG_THROW("Checkpoint: file '"<<filename<<"' is not a checkpoint.");
+	}
+	if(numProcs != 1){
+		fclose(f);
+		UG_THROW("Checkpoint: file '"<<filename<<"' has been written by "
+				<<numProcs<<" processes, but running serial.");
+	}
+
+	const int size = nextOffset - 2*(int)sizeof(int);
+	std::vector<char> vData(size > 0 ? size : 0);
+	if(size < 0 || (size > 0 && fread(&vData[0], sizeof(char), size, f) != (size_t)size)){
+		fclose(f);
+		UG_THROW("Checkpoint: file '"<<filename<<"' is truncated.");
+	}
+	fclose(f);
+
+	buf.clear();
+	buf.reserve(size);
+	if(size > 0) buf.write(&vData[0], size);
+#endif
+}
+
+///	returns the elements of a grid sorted by an index attachment
+template <class TElem>
+void SortedByIndex(std::vector<TElem*>& vElem, MultiGrid& mg,
+                   MultiElementAttachmentAccessor<AInt>& aaIndex)
+{
+	typedef typename geometry_traits<TElem>::iterator iterator;
+	vElem.assign(mg.num<TElem>(), NULL);
+	for(iterator iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter){
+		const int ind = aaIndex[*iter];
+		if(ind < 0 || ind >= (int)vElem.size())
+			UG_THROW("Checkpoint: invalid element index "<<ind<<".");
+		vElem[ind] = *iter;
+	}
+}
+
+///	writes the subset index of each element
+template <class TElem>
+void WriteCheckpointSubsets(BinaryBuffer& out, ISubsetHandler& sh,
+                            const std::vector<TElem*>& vElem)
+{
+	for(size_t i = 0; i < vElem.size(); ++i)
+		Serialize(out, sh.get_subset_index(vElem[i]));
+}
+
+///	reads and assigns the subset index of each element
+template <class TElem>
+void ReadCheckpointSubsets(BinaryBuffer& in, ISubsetHandler& sh,
+                           const std::vector<TElem*>& vElem)
+{
+	for(size_t i = 0; i < vElem.size(); ++i){
+		int si; Deserialize(in, si);
+		if(si >= 0) sh.assign_subset(vElem[i], si);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Checkpoint
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+add(SmartPtr<function_type> spGridFct)
+{
+	if(spGridFct.invalid())
+		UG_THROW("Checkpoint::add: invalid grid function.");
+	m_vspGridFct.push_back(spGridFct);
+}
+
+template <typename TDomain, typename TAlgebra>
+template <class TElem>
+void Checkpoint<TDomain, TAlgebra>::
+write_layouts(BinaryBuffer& out, MultiGrid& mg,
+              MultiElementAttachmentAccessor<AInt>& aaIndex)
+{
+#ifdef UG_PARALLEL
+	typedef typename GridLayoutMap::Types<TElem>::Map::iterator map_iterator;
+	typedef typename GridLayoutMap::Types<TElem>::Layout layout_type;
+	typedef typename GridLayoutMap::Types<TElem>::Interface interface_type;
+
+	GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+
+	Serialize(out, (int)std::distance(glm.layouts_begin<TElem>(),
+	                                  glm.layouts_end<TElem>()));
+
+	for(map_iterator iter = glm.layouts_begin<TElem>();
+			iter != glm.layouts_end<TElem>(); ++iter)
+	{
+		const int key = iter->first;
+		layout_type& layout = iter->second;
+
+		Serialize(out, key);
+		Serialize(out, layout.num_levels());
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			Serialize(out, (int)std::distance(layout.begin(lvl), layout.end(lvl)));
+			for(typename layout_type::iterator it = layout.begin(lvl);
+					it != layout.end(lvl); ++it)
+			{
+				interface_type& intfc = layout.interface(it);
+				Serialize(out, layout.proc_id(it));
+				Serialize(out, intfc.size());
+				for(typename interface_type::iterator eIt = intfc.begin();
+						eIt != intfc.end(); ++eIt)
+					Serialize(out, aaIndex[intfc.get_element(eIt)]);
+			}
+		}
+	}
+#else
+	Serialize(out, (int)0);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+template <class TElem>
+void Checkpoint<TDomain, TAlgebra>::
+read_layouts(BinaryBuffer& in, MultiGrid& mg)
+{
+	std::vector<TElem*>& vElem = elements((TElem*)NULL);
+
+	int numLayouts; Deserialize(in, numLayouts);
+
+#ifdef UG_PARALLEL
+	typedef typename GridLayoutMap::Types<TElem>::Layout layout_type;
+	typedef typename GridLayoutMap::Types<TElem>::Interface interface_type;
+
+	GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+
+	for(int l = 0; l < numLayouts; ++l){
+		int key; Deserialize(in, key);
+		size_t numLevels; Deserialize(in, numLevels);
+
+		layout_type& layout = glm.get_layout<TElem>(key);
+		for(size_t lvl = 0; lvl < numLevels; ++lvl){
+			int numIntfc; Deserialize(in, numIntfc);
+			for(int i = 0; i < numIntfc; ++i){
+				int procID; Deserialize(in, procID);
+				size_t size; Deserialize(in, size);
+
+				interface_type& intfc = layout.interface(procID, lvl);
+				for(size_t e = 0; e < size; ++e){
+					int ind; Deserialize(in, ind);
+					if(ind < 0 || ind >= (int)vElem.size())
+						UG_THROW("Checkpoint: invalid element index "<<ind
+						         <<" in layout "<<key<<".");
+					intfc.push_back(vElem[ind]);
+				}
+			}
+		}
+	}
+#else
+	if(numLayouts != 0)
+		UG_THROW("Checkpoint: file contains parallel layouts, but running serial.");
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+template <class TBaseElem>
+void Checkpoint<TDomain, TAlgebra>::
+write_indices(BinaryBuffer& out, DoFDistribution& dd,
+              MultiElementAttachmentAccessor<AInt>& aaIndex)
+{
+	typedef typename DoFDistribution::traits<TBaseElem>::const_iterator iterator;
+
+//	entries: element index, number of indices, indices
+	std::vector<size_t> vEntry, vInd;
+	iterator iterEnd = dd.end<TBaseElem>(SurfaceView::ALL);
+	for(iterator iter = dd.begin<TBaseElem>(SurfaceView::ALL); iter != iterEnd; ++iter){
+		TBaseElem* elem = *iter;
+		if(dd.inner_algebra_indices(elem, vInd) == 0) continue;
+
+		vEntry.push_back(aaIndex[elem]);
+		vEntry.push_back(vInd.size());
+		vEntry.insert(vEntry.end(), vInd.begin(), vInd.end());
+	}
+	Serialize(out, vEntry);
+}
+
+template <typename TDomain, typename TAlgebra>
+template <class TBaseElem>
+bool Checkpoint<TDomain, TAlgebra>::
+read_indices(BinaryBuffer& in, DoFDistribution& dd, std::vector<size_t>& vNewInd)
+{
+	std::vector<TBaseElem*>& vElem = elements((TBaseElem*)NULL);
+
+	std::vector<size_t> vEntry, vInd;
+	Deserialize(in, vEntry);
+
+	bool bIdentity = true;
+	for(size_t i = 0; i < vEntry.size(); ){
+		if(i + 2 > vEntry.size() || vEntry[i] >= vElem.size())
+			UG_THROW("Checkpoint: corrupt DoF numbering.");
+
+		TBaseElem* elem = vElem[vEntry[i]];
+		const size_t numInd = vEntry[i+1];
+		i += 2;
+
+		if(i + numInd > vEntry.size() || dd.inner_algebra_indices(elem, vInd) != numInd)
+			UG_THROW("Checkpoint: DoF numbering does not match the grid function. "
+					"Same approximation space as for writing required.");
+
+		for(size_t k = 0; k < numInd; ++k, ++i){
+			if(vEntry[i] >= vNewInd.size())
+				UG_THROW("Checkpoint: stored index "<<vEntry[i]<<" out of range.");
+			vNewInd[vInd[k]] = vEntry[i];
+			if(vInd[k] != vEntry[i]) bIdentity = false;
+		}
+	}
+	return bIdentity;
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+write_values(BinaryBuffer& out, const function_type& u)
+{
+#ifdef UG_PARALLEL
+	Serialize(out, (uint)u.get_storage_mask());
+#else
+	Serialize(out, (uint)0);
+#endif
+	Serialize(out, u.size());
+	for(size_t i = 0; i < u.size(); ++i){
+		const size_t blockSize = GetSize(u[i]);
+		Serialize(out, blockSize);
+		for(size_t k = 0; k < blockSize; ++k)
+			Serialize(out, (double)BlockRef(u[i], k));
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_values(BinaryBuffer& in, function_type& u)
+{
+	uint storageMask; Deserialize(in, storageMask);
+	size_t size; Deserialize(in, size);
+	if(size != u.size())
+		UG_THROW("Checkpoint: stored grid function has "<<size<<" entries, "
+		         "but grid function has "<<u.size()<<".");
+
+	for(size_t i = 0; i < u.size(); ++i){
+		size_t blockSize; Deserialize(in, blockSize);
+		if(blockSize != GetSize(u[i]))
+			UG_THROW("Checkpoint: block size mismatch at index "<<i<<".");
+		for(size_t k = 0; k < blockSize; ++k){
+			double val; Deserialize(in, val);
+			BlockRef(u[i], k) = val;
+		}
+	}
+
+#ifdef UG_PARALLEL
+	if(storageMask != 0) u.set_storage_type(storageMask);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+write(const char* filename)
+{
+	PROFILE_FUNC_GROUP("disc io");
+
+	if(m_vspGridFct.empty())
+		UG_THROW("Checkpoint::write: no grid function added.");
+
+	SmartPtr<TDomain> spDomain = m_vspGridFct[0]->domain();
+	for(size_t i = 1; i < m_vspGridFct.size(); ++i)
+		if(m_vspGridFct[i]->domain() != spDomain)
+			UG_THROW("Checkpoint::write: all grid functions must be defined "
+					"on the same domain.");
+
+	MultiGrid& mg = *spDomain->grid();
+	ISubsetHandler& sh = *spDomain->subset_handler();
+	typename TDomain::position_accessor_type& aaPos = spDomain->position_accessor();
+
+	BinaryBuffer out;
+
+//	header
+	Serialize(out, CHECKPOINT_MAGIC);
+	Serialize(out, CHECKPOINT_VERSION);
+#ifdef UG_PARALLEL
+	Serialize(out, pcl::NumProcs());
+#else
+	Serialize(out, (int)1);
+#endif
+	Serialize(out, (int)dim);
+
+//	grid elements, the indices are assigned in write order
+	AInt aIndex;
+	mg.attach_to_all(aIndex);
+	MultiElementAttachmentAccessor<AInt> aaIndex(mg, aIndex);
+
+	try{
+		if(!SerializeMultiGridElements(mg, mg.get_grid_objects(), aaIndex, out))
+			UG_THROW("Checkpoint::write: serialization of grid failed.");
+
+		std::vector<Vertex*> vVrt; SortedByIndex(vVrt, mg, aaIndex);
+		std::vector<Edge*> vEdge; SortedByIndex(vEdge, mg, aaIndex);
+		std::vector<Face*> vFace; SortedByIndex(vFace, mg, aaIndex);
+		std::vector<Volume*> vVol; SortedByIndex(vVol, mg, aaIndex);
+
+	//	positions
+		for(size_t i = 0; i < vVrt.size(); ++i)
+			for(int d = 0; d < dim; ++d)
+				Serialize(out, (double)aaPos[vVrt[i]][d]);
+
+	//	subset infos and subset indices
+		SerializeSubsetHandler(mg, sh, GridObjectCollection(), out);
+		WriteCheckpointSubsets(out, sh, vVrt);
+		WriteCheckpointSubsets(out, sh, vEdge);
+		WriteCheckpointSubsets(out, sh, vFace);
+		WriteCheckpointSubsets(out, sh, vVol);
+
+	//	layouts
+		write_layouts<Vertex>(out, mg, aaIndex);
+		write_layouts<Edge>(out, mg, aaIndex);
+		write_layouts<Face>(out, mg, aaIndex);
+		write_layouts<Volume>(out, mg, aaIndex);
+
+	//	grid functions
+		Serialize(out, m_vspGridFct.size());
+		for(size_t f = 0; f < m_vspGridFct.size(); ++f){
+			function_type& u = *m_vspGridFct[f];
+			DoFDistribution& dd = *u.dd();
+
+			Serialize(out, u.num_fct());
+			for(size_t fct = 0; fct < u.num_fct(); ++fct)
+				Serialize(out, std::string(u.name(fct)));
+
+			Serialize(out, dd.num_indices());
+			write_indices<Vertex>(out, dd, aaIndex);
+			write_indices<Edge>(out, dd, aaIndex);
+			write_indices<Face>(out, dd, aaIndex);
+			write_indices<Volume>(out, dd, aaIndex);
+
+			write_values(out, u);
+		}
+	}
+	UG_CATCH_THROW("Checkpoint::write: cannot write checkpoint '"<<filename<<"'.");
+
+	mg.detach_from_all(aIndex);
+
+	WriteCheckpointFile(out, filename);
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_domain(SmartPtr<TDomain> spDomain, const char* filename)
+{
+	PROFILE_FUNC_GROUP("disc io");
+
+	if(spDomain.invalid())
+		UG_THROW("Checkpoint::read_domain: invalid domain.");
+
+	MultiGrid& mg = *spDomain->grid();
+	ISubsetHandler& sh = *spDomain->subset_handler();
+	typename TDomain::position_accessor_type& aaPos = spDomain->position_accessor();
+
+	if(mg.num_vertices() != 0)
+		UG_THROW("Checkpoint::read_domain: domain must be empty.");
+
+	BinaryBuffer& in = m_fctBuffer;
+	ReadCheckpointFile(in, filename);
+
+//	header
+	int magic = 0, version = 0, numProcs = 0, fileDim = 0;
+	if(in.eof()) UG_THROW("Checkpoint::read_domain: empty checkpoint '"<<filename<<"'.");
+	Deserialize(in, magic);
+	if(magic != CHECKPOINT_MAGIC)
+		UG_THROW("Checkpoint::read_domain: '"<<filename<<"' is not a checkpoint.");
+	Deserialize(in, version);
+	if(version != CHECKPOINT_VERSION)
+		UG_THROW("Checkpoint::read_domain: unsupported version "<<version<<".");
+	Deserialize(in, numProcs);
+#ifdef UG_PARALLEL
+	if(numProcs != pcl::NumProcs())
+#else
+	if(numProcs != 1)
+#endif
+		UG_THROW("Checkpoint::read_domain: checkpoint has been written by "
+				<<numProcs<<" processes. Restart on the same number required.");
+	Deserialize(in, fileDim);
+	if(fileDim != dim)
+		UG_THROW("Checkpoint::read_domain: checkpoint written for dim "
+		         <<fileDim<<", but domain has dim "<<dim<<".");
+
+#ifdef UG_PARALLEL
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	distGridMgr.enable_interface_management(false);
+#endif
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS));
+
+	try{
+	//	grid elements
+		if(!DeserializeMultiGridElements(mg, in, &m_vVrt, &m_vEdge, &m_vFace, &m_vVol))
+			UG_THROW("Deserialization of grid failed.");
+
+	//	positions
+		for(size_t i = 0; i < m_vVrt.size(); ++i)
+			for(int d = 0; d < dim; ++d){
+				double x; Deserialize(in, x);
+				aaPos[m_vVrt[i]][d] = x;
+			}
+
+	//	subset infos and subset indices
+		if(!DeserializeSubsetHandler(mg, sh, GridObjectCollection(), in))
+			UG_THROW("Deserialization of subset handler failed.");
+		ReadCheckpointSubsets(in, sh, m_vVrt);
+		ReadCheckpointSubsets(in, sh, m_vEdge);
+		ReadCheckpointSubsets(in, sh, m_vFace);
+		ReadCheckpointSubsets(in, sh, m_vVol);
+
+	//	layouts
+		read_layouts<Vertex>(in, mg);
+		read_layouts<Edge>(in, mg);
+		read_layouts<Face>(in, mg);
+		read_layouts<Volume>(in, mg);
+	}
+	UG_CATCH_THROW("Checkpoint::read_domain: cannot read checkpoint '"<<filename<<"'.");
+
+#ifdef UG_PARALLEL
+	GridLayoutMap& glm = distGridMgr.grid_layout_map();
+	glm.remove_empty_interfaces();
+	distGridMgr.enable_interface_management(true);
+	distGridMgr.grid_layouts_changed(false);
+#endif
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS));
+
+	Deserialize(in, m_numFctInFile);
+	m_spDomain = spDomain;
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_functions()
+{
+	PROFILE_FUNC_GROUP("disc io");
+
+	if(m_spDomain.invalid())
+		UG_THROW("Checkpoint::read_functions: call read_domain first.");
+	if(m_vspGridFct.size() != m_numFctInFile)
+		UG_THROW("Checkpoint::read_functions: checkpoint contains "<<m_numFctInFile
+		         <<" grid functions, but "<<m_vspGridFct.size()<<" added.");
+
+	BinaryBuffer& in = m_fctBuffer;
+	for(size_t f = 0; f < m_vspGridFct.size(); ++f){
+		function_type& u = *m_vspGridFct[f];
+		if(u.domain() != m_spDomain)
+			UG_THROW("Checkpoint::read_functions: grid function "<<f
+			         <<" is not defined on the domain of the checkpoint.");
+
+		try{
+		//	function names
+			size_t numFct; Deserialize(in, numFct);
+			if(numFct != u.num_fct())
+				UG_THROW("Stored grid function "<<f<<" has "<<numFct
+				         <<" functions, but grid function has "<<u.num_fct()<<".");
+			for(size_t fct = 0; fct < numFct; ++fct){
+				std::string name; Deserialize(in, name);
+				if(name != u.name(fct))
+					UG_THROW("Stored function '"<<name<<"' does not match function '"
+					         <<u.name(fct)<<"' of grid function "<<f<<".");
+			}
+
+		//	numbering, permuted to the stored one if needed
+			DoFDistribution& dd = *u.dd();
+			size_t numIndex; Deserialize(in, numIndex);
+			if(numIndex != dd.num_indices())
+				UG_THROW("Stored grid function "<<f<<" has "<<numIndex
+				         <<" indices, but grid function has "<<dd.num_indices()<<".");
+
+			std::vector<size_t> vNewInd(numIndex, (size_t)-1);
+			bool bIdentity = true;
+			bIdentity &= read_indices<Vertex>(in, dd, vNewInd);
+			bIdentity &= read_indices<Edge>(in, dd, vNewInd);
+			bIdentity &= read_indices<Face>(in, dd, vNewInd);
+			bIdentity &= read_indices<Volume>(in, dd, vNewInd);
+
+			for(size_t i = 0; i < vNewInd.size(); ++i)
+				if(vNewInd[i] == (size_t)-1)
+					UG_THROW("Index "<<i<<" of grid function "<<f<<" not stored.");
+
+			if(!bIdentity) dd.permute_indices(vNewInd);
+
+		//	values
+			read_values(in, u);
+		}
+		UG_CATCH_THROW("Checkpoint::read_functions: cannot restore grid function "<<f<<".");
+	}
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__ */
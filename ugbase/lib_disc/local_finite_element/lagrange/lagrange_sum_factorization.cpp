@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "lagrange_sum_factorization.h"
+#include "../common/lagrange1d.h"
+#include "../local_finite_element_provider.h"
+#include <cmath>
+
+namespace ug{
+
+template <int TDim>
+bool LagrangeSumFactorization<TDim>::
+init(ReferenceObjectID roid, const LFEID& lfeID,
+     const MathVector<dim>* vLocIP, size_t numIP)
+{
+	m_bValid = false;
+
+//	only Lagrange spaces on tensor product elements
+	if(lfeID.type() != LFEID::LAGRANGE || lfeID.order() < 1) return false;
+	if(!(dim == 2 && roid == ROID_QUADRILATERAL)
+		&& !(dim == 3 && roid == ROID_HEXAHEDRON)) return false;
+	if(numIP == 0) return false;
+
+//	number of 1D points
+	size_t nq = 1, nip = 1;
+	for(;; ++nq){
+		nip = 1;
+		for(int d = 0; d < dim; ++d) nip *= nq;
+		if(nip >= numIP) break;
+	}
+	if(nip != numIP) return false;
+
+//	the 1D points are the coordinates in the fastest direction and the
+//	remaining coordinates must match the tensor product ordering
+	std::vector<number> vPoint1D(nq);
+	for(size_t q = 0; q < nq; ++q)
+		vPoint1D[q] = vLocIP[q][dim-1];
+
+	for(size_t ip = 0; ip < numIP; ++ip){
+		size_t rest = ip;
+		for(int d = dim-1; d >= 0; --d){
+			const size_t q = rest % nq; rest /= nq;
+			if(std::fabs(vLocIP[ip][d] - vPoint1D[q]) > 1e-12) return false;
+		}
+	}
+
+//	get the tensor index of each shape function from its position
+	const size_t p = lfeID.order();
+	const size_t n1 = p+1;
+	size_t nsh = 1;
+	for(int d = 0; d < dim; ++d) nsh *= n1;
+
+	const LocalShapeFunctionSet<dim>& rTrialSpace
+		= LocalFiniteElementProvider::get<dim>(roid, lfeID);
+	if(rTrialSpace.num_sh() != nsh) return false;
+
+	m_vLexIndex.resize(nsh);
+	std::vector<bool> vUsed(nsh, false);
+	for(size_t sh = 0; sh < nsh; ++sh){
+		MathVector<dim> pos;
+		if(!rTrialSpace.position(sh, pos)) return false;
+
+		size_t lex = 0;
+		for(int d = 0; d < dim; ++d){
+			const number ind = std::floor(pos[d] * p + 0.5);
+			if(ind < 0 || ind > p || std::fabs(ind - pos[d] * p) > 1e-8)
+				return false;
+			lex = lex * n1 + (size_t)ind;
+		}
+		if(vUsed[lex]) return false;
+		vUsed[lex] = true;
+		m_vLexIndex[sh] = lex;
+	}
+
+//	1D tables
+	m_vShape1D.resize(nq * n1);
+	m_vDeriv1D.resize(nq * n1);
+	for(size_t i = 0; i < n1; ++i){
+		const EquidistantLagrange1D poly(i, p);
+		const Polynomial1D dPoly = poly.derivative();
+		for(size_t q = 0; q < nq; ++q){
+			m_vShape1D[q*n1 + i] = poly.value(vPoint1D[q]);
+			m_vDeriv1D[q*n1 + i] = dPoly.value(vPoint1D[q]);
+		}
+	}
+
+//	buffers large enough for all intermediate tensors
+	size_t bufSize = 1;
+	for(int d = 0; d < dim; ++d) bufSize *= std::max(n1, nq);
+	for(size_t i = 0; i < 3; ++i) m_vBuffer[i].resize(bufSize);
+
+	m_p = p; m_n1 = n1; m_nq = nq; m_nsh = nsh; m_nip = numIP;
+	m_bValid = true;
+	return true;
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+contract(number* vOut, const number* vIn,
+         const std::vector<number>& vTable, size_t nRow, size_t nCol,
+         const size_t* vShape, int dir, bool bTransposed)
+{
+//	the tensor is split into [pre][dir][post], where post is contiguous
+	size_t pre = 1, post = 1;
+	for(int d = 0; d < dir; ++d) pre *= vShape[d];
+	for(int d = dir+1; d < dim; ++d) post *= vShape[d];
+
+	const size_t nIn = bTransposed ? nRow : nCol;
+	const size_t nOut = bTransposed ? nCol : nRow;
+
+	for(size_t a = 0; a < pre; ++a){
+		const number* in = vIn + a * nIn * post;
+		number* out = vOut + a * nOut * post;
+
+		for(size_t o = 0; o < nOut; ++o){
+			number* outRow = out + o * post;
+			for(size_t b = 0; b < post; ++b) outRow[b] = 0.0;
+
+			for(size_t k = 0; k < nIn; ++k){
+				const number t = bTransposed ? vTable[k * nCol + o]
+				                             : vTable[o * nCol + k];
+				const number* inRow = in + k * post;
+				for(size_t b = 0; b < post; ++b)
+					outRow[b] += t * inRow[b];
+			}
+		}
+	}
+}
+
+template <int TDim>
+const number* LagrangeSumFactorization<TDim>::
+contract_all(const number* vIn, bool bTransposed, int derivDir) const
+{
+	size_t vShape[dim];
+	for(int d = 0; d < dim; ++d) vShape[d] = bTransposed ? m_nq : m_n1;
+
+	const number* src = vIn;
+	for(int d = dim-1; d >= 0; --d){
+		number* dst = (src == &m_vBuffer[0][0]) ? &m_vBuffer[1][0]
+		                                         : &m_vBuffer[0][0];
+		contract(dst, src, (d == derivDir) ? m_vDeriv1D : m_vShape1D,
+		         m_nq, m_n1, vShape, d, bTransposed);
+		vShape[d] = bTransposed ? m_n1 : m_nq;
+		src = dst;
+	}
+	return src;
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+values(number* vValIP, const number* vCoeff) const
+{
+	UG_ASSERT(m_bValid, "LagrangeSumFactorization not initialized.");
+
+	number* vLex = &m_vBuffer[2][0];
+	for(size_t sh = 0; sh < m_nsh; ++sh)
+		vLex[m_vLexIndex[sh]] = vCoeff[sh];
+
+	const number* vRes = contract_all(vLex, false, -1);
+	for(size_t ip = 0; ip < m_nip; ++ip)
+		vValIP[ip] = vRes[ip];
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+local_grads(MathVector<dim>* vGradIP, const number* vCoeff) const
+{
+	UG_ASSERT(m_bValid, "LagrangeSumFactorization not initialized.");
+
+	number* vLex = &m_vBuffer[2][0];
+	for(size_t sh = 0; sh < m_nsh; ++sh)
+		vLex[m_vLexIndex[sh]] = vCoeff[sh];
+
+	for(int d = 0; d < dim; ++d){
+		const number* vRes = contract_all(vLex, false, d);
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			vGradIP[ip][d] = vRes[ip];
+	}
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+add_values_transposed(number* vCoeff, const number* vValIP) const
+{
+	UG_ASSERT(m_bValid, "LagrangeSumFactorization not initialized.");
+
+	const number* vRes = contract_all(vValIP, true, -1);
+	for(size_t sh = 0; sh < m_nsh; ++sh)
+		vCoeff[sh] += vRes[m_vLexIndex[sh]];
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+add_local_grads_transposed(number* vCoeff, const MathVector<dim>* vGradIP) const
+{
+	UG_ASSERT(m_bValid, "LagrangeSumFactorization not initialized.");
+
+	number* vComp = &m_vBuffer[2][0];
+	for(int d = 0; d < dim; ++d){
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			vComp[ip] = vGradIP[ip][d];
+
+		const number* vRes = contract_all(vComp, true, d);
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			vCoeff[sh] += vRes[m_vLexIndex[sh]];
+	}
+}
+
+template <int dim>
+void EvaluateShapeExpansion(number* vValIP, MathVector<dim>* vLocGradIP,
+                            ReferenceObjectID roid, const LFEID& lfeID,
+                            const number* vCoeff,
+                            const MathVector<dim>* vLocIP, size_t numIP)
+{
+//	use sum factorization if possible
+	LagrangeSumFactorization<dim> sumFact;
+	if(sumFact.init(roid, lfeID, vLocIP, numIP)){
+		if(vValIP) sumFact.values(vValIP, vCoeff);
+		if(vLocGradIP) sumFact.local_grads(vLocGradIP, vCoeff);
+		return;
+	}
+
+//	evaluate all shape functions otherwise
+	const LocalShapeFunctionSet<dim>& rTrialSpace =
+					LocalFiniteElementProvider::get<dim>(roid, lfeID);
+	const size_t nsh = rTrialSpace.num_sh();
+
+	std::vector<number> vShape(nsh);
+	std::vector<MathVector<dim> > vGrad(nsh);
+	for(size_t ip = 0; ip < numIP; ++ip){
+		if(vValIP){
+			rTrialSpace.shapes(&vShape[0], vLocIP[ip]);
+			vValIP[ip] = 0.0;
+			for(size_t sh = 0; sh < nsh; ++sh)
+				vValIP[ip] += vCoeff[sh] * vShape[sh];
+		}
+		if(vLocGradIP){
+			rTrialSpace.grads(&vGrad[0], vLocIP[ip]);
+			VecSet(vLocGradIP[ip], 0.0);
+			for(size_t sh = 0; sh < nsh; ++sh)
+				VecScaleAppend(vLocGradIP[ip], vCoeff[sh], vGrad[sh]);
+		}
+	}
+}
+
+template class LagrangeSumFactorization<1>;
+template class LagrangeSumFactorization<2>;
+template class LagrangeSumFactorization<3>;
+
+template void EvaluateShapeExpansion<1>(number*, MathVector<1>*, ReferenceObjectID,
+                                        const LFEID&, const number*,
+                                        const MathVector<1>*, size_t);
+template void EvaluateShapeExpansion<2>(number*, MathVector<2>*, ReferenceObjectID,
+                                        const LFEID&, const number*,
+                                        const MathVector<2>*, size_t);
+template void EvaluateShapeExpansion<3>(number*, MathVector<3>*, ReferenceObjectID,
+                                        const LFEID&, const number*,
+                                        const MathVector<3>*, size_t);
+
+} // end namespace ug
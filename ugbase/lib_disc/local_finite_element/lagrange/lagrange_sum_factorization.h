@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACTORIZATION__
+#define __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACTORIZATION__
+
+#include <vector>
+#include "common/math/ugmath.h"
+#include "lib_grid/grid/grid_base_objects.h"
+#include "../local_finite_element_id.h"
+
+namespace ug{
+
+/// sum factorization for Lagrange shape functions on tensor product elements
+/**
+ * The Lagrange shape functions on quadrilaterals and hexahedra are products
+ * of 1D Lagrange polynomials. If in addition the integration points are a
+ * tensor product of 1D points (as for the GaussQuadratureQuadrilateral and
+ * GaussQuadratureHexahedron rules), a function sum_sh c_sh phi_sh can be
+ * evaluated at all points by successive 1D contractions, one direction at a
+ * time. For order p and n 1D points this costs O(dim * n^{dim} * (p+1))
+ * operations per element instead of O(n^{dim} * (p+1)^{dim}), e.g. O(p^4)
+ * instead of O(p^6) for hexahedra. The same holds for the transposed
+ * operation, that integrates ip values against all shape functions.
+ *
+ * The integration points must be ordered as in the gauss_tensor_prod rules,
+ * i.e. the first coordinate varies slowest and the last one fastest. The
+ * coefficients and results are given in the usual shape function ordering.
+ *
+ * The methods use internal buffers, thus an instance must not be used by
+ * several threads concurrently.
+ *
+ * \tparam	TDim		dimension of reference element
+ */
+template <int TDim>
+class LagrangeSumFactorization
+{
+	public:
+	///	dimension of reference element
+		static const int dim = TDim;
+
+	public:
+	///	constructor
+		LagrangeSumFactorization() : m_bValid(false), m_p(0), m_n1(0), m_nq(0),
+									 m_nsh(0), m_nip(0) {}
+
+	///	prepares the evaluation
+	/**
+	 * Initializes the 1D tables for the trial space and the integration
+	 * points. If sum factorization is not applicable (no Lagrange space on
+	 * a quadrilateral or hexahedron, or no tensor product points), false is
+	 * returned and the instance is invalid.
+	 *
+	 * \param[in]	roid		reference object id
+	 * \param[in]	lfeID		trial space
+	 * \param[in]	vLocIP		local integration points
+	 * \param[in]	numIP		number of integration points
+	 * \returns		true if sum factorization can be used
+	 */
+		bool init(ReferenceObjectID roid, const LFEID& lfeID,
+		          const MathVector<dim>* vLocIP, size_t numIP);
+
+	///	returns if initialized successfully
+		bool valid() const {return m_bValid;}
+
+	///	number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	computes the values sum_sh vCoeff[sh] * phi_sh(ip) at all ips
+		void values(number* vValIP, const number* vCoeff) const;
+
+	///	computes the local gradients sum_sh vCoeff[sh] * grad phi_sh(ip) at all ips
+		void local_grads(MathVector<dim>* vGradIP, const number* vCoeff) const;
+
+	///	adds sum_ip phi_sh(ip) * vValIP[ip] to vCoeff[sh] for all sh
+		void add_values_transposed(number* vCoeff, const number* vValIP) const;
+
+	///	adds sum_ip grad phi_sh(ip) * vGradIP[ip] to vCoeff[sh] for all sh
+		void add_local_grads_transposed(number* vCoeff, const MathVector<dim>* vGradIP) const;
+
+	protected:
+	///	applies 1D contractions in all directions, returns pointer to result
+	/**
+	 * In direction derivDir the derivative table is used, in all other
+	 * directions the value table. A negative derivDir uses values only.
+	 */
+		const number* contract_all(const number* vIn, bool bTransposed,
+		                           int derivDir) const;
+
+	///	contracts a tensor in one direction with a 1D table
+		static void contract(number* vOut, const number* vIn,
+		                     const std::vector<number>& vTable,
+		                     size_t nRow, size_t nCol,
+		                     const size_t* vShape, int dir, bool bTransposed);
+
+	protected:
+	///	flag if initialized
+		bool m_bValid;
+
+	///	order of trial space
+		size_t m_p;
+
+	///	number of 1D shape functions (p+1)
+		size_t m_n1;
+
+	///	number of 1D integration points
+		size_t m_nq;
+
+	///	number of shape functions ((p+1)^dim)
+		size_t m_nsh;
+
+	///	number of integration points (nq^dim)
+		size_t m_nip;
+
+	///	1D shape values at 1D points (size nq x (p+1), row major)
+		std::vector<number> m_vShape1D;
+
+	///	1D shape derivatives at 1D points (size nq x (p+1), row major)
+		std::vector<number> m_vDeriv1D;
+
+	///	lexicographic (tensor) index of each shape function
+		std::vector<size_t> m_vLexIndex;
+
+	///	buffers for intermediate tensors
+		mutable std::vector<number> m_vBuffer[3];
+};
+
+/// evaluates a finite element function and its local gradient at points
+/**
+ * This function computes the values (and local gradients) of the function
+ * sum_sh vCoeff[sh] * phi_sh at the given local points. For Lagrange spaces on
+ * quadrilaterals and hexahedra evaluated at tensor product points, sum
+ * factorization is used, otherwise the shape functions are evaluated for
+ * every point.
+ *
+ * \param[out]	vValIP		values at points (may be NULL)
+ * \param[out]	vLocGradIP	local gradients at points (may be NULL)
+ * \param[in]	roid		reference object id
+ * \param[in]	lfeID		trial space
+ * \param[in]	vCoeff		coefficients w.r.t. shape functions
+ * \param[in]	vLocIP		local points
+ * \param[in]	numIP		number of points
+ */
+template <int dim>
+void EvaluateShapeExpansion(number* vValIP, MathVector<dim>* vLocGradIP,
+                            ReferenceObjectID roid, const LFEID& lfeID,
+                            const number* vCoeff,
+                            const MathVector<dim>* vLocIP, size_t numIP);
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACTORIZATION__ */
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__
+#define __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__
+
+#include <vector>
+
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "lib_grid/grid/grid_base_objects.h"
+#include "local_finite_element_id.h"
+#include "local_finite_element_provider.h"
+
+namespace ug{
+
+/// Table of shape function values and gradients at a set of local points
+/**
+ * This class stores the values and local gradients of the shape functions of
+ * a scalar local finite element at a given series of local (reference element)
+ * points. One table is kept per reference object id. A request via update() only
+ * recomputes the table if the finite element or the local points have changed
+ * since the last request for the same reference object, such that evaluations
+ * on elements of the same type with the same integration points (e.g. a fixed
+ * quadrature rule or the integration points of a finite volume geometry) do
+ * not evaluate the shape functions again.
+ *
+ * The values are stored ip-major, i.e. shapes(ip) returns a contiguous array
+ * of num_sh() values, and the evaluation of a finite element function at the
+ * ips is a small dense matrix-vector product with the local coefficients.
+ *
+ * \tparam	TRefDim		dimension of the reference element
+ */
+template <int TRefDim>
+class LocalShapeTable
+{
+	public:
+	///	reference dimension
+		static const int refDim = TRefDim;
+
+	///	type of local gradients
+		typedef MathVector<refDim> grad_type;
+
+	public:
+	///	makes sure that the table for roid matches the passed local points
+	/**
+	 * \param[in]	roid		reference object id
+	 * \param[in]	lfeID		local finite element id
+	 * \param[in]	vLocIP		local points
+	 * \param[in]	nip			number of local points
+	 * \param[in]	bGrad		flag if gradients are needed as well
+	 * \returns		true if the table has been recomputed
+	 */
+		bool update(ReferenceObjectID roid, const LFEID& lfeID,
+		            const MathVector<refDim>* vLocIP, size_t nip, bool bGrad = false)
+		{
+			UG_ASSERT(roid >= 0 && roid < NUM_REFERENCE_OBJECTS,
+			          "LocalShapeTable: Invalid reference object id " << roid);
+			m_pCur = &m_vEntry[roid];
+			Entry& e = *m_pCur;
+
+			if(e.valid && e.lfeID == lfeID && e.vLocIP.size() == nip
+				&& (e.bGrad || !bGrad) && same_points(e, vLocIP, nip))
+				return false;
+
+			const LocalShapeFunctionSet<refDim>& rTrialSpace =
+					LocalFiniteElementProvider::get<refDim>(roid, lfeID);
+
+			e.valid = false;
+			e.lfeID = lfeID;
+			e.bGrad = bGrad;
+			e.nsh = rTrialSpace.num_sh();
+			e.vLocIP.assign(vLocIP, vLocIP + nip);
+
+			e.vShape.resize(nip * e.nsh);
+			for(size_t ip = 0; ip < nip; ++ip)
+				rTrialSpace.shapes(&e.vShape[ip * e.nsh], vLocIP[ip]);
+
+			if(bGrad){
+				e.vGrad.resize(nip * e.nsh);
+				for(size_t ip = 0; ip < nip; ++ip)
+					rTrialSpace.grads(&e.vGrad[ip * e.nsh], vLocIP[ip]);
+			}
+
+			e.valid = true;
+			return true;
+		}
+
+	///	number of local points of the current table
+		size_t num_ip() const {return m_pCur->vLocIP.size();}
+
+	///	number of shape functions of the current table
+		size_t num_sh() const {return m_pCur->nsh;}
+
+	///	shape function values at a local point of the current table
+		const number* shapes(size_t ip) const
+		{
+			UG_ASSERT(ip < num_ip(), "LocalShapeTable: Invalid ip " << ip);
+			return &m_pCur->vShape[ip * m_pCur->nsh];
+		}
+
+	///	local shape function gradients at a local point of the current table
+		const grad_type* grads(size_t ip) const
+		{
+			UG_ASSERT(m_pCur->bGrad, "LocalShapeTable: Gradients not requested.");
+			UG_ASSERT(ip < num_ip(), "LocalShapeTable: Invalid ip " << ip);
+			return &m_pCur->vGrad[ip * m_pCur->nsh];
+		}
+
+	///	evaluates sum_sh vCoeff[sh] * shape_sh(ip) for all ips
+		void values(number* vValue, const number* vCoeff) const
+		{
+			const size_t nsh = num_sh(), nip = num_ip();
+			for(size_t ip = 0; ip < nip; ++ip)
+			{
+				const number* vShape = shapes(ip);
+				number val = 0.0;
+				for(size_t sh = 0; sh < nsh; ++sh)
+					val += vCoeff[sh] * vShape[sh];
+				vValue[ip] = val;
+			}
+		}
+
+	///	evaluates sum_sh vCoeff[sh] * grad shape_sh(ip) for one ip
+		void local_grad(grad_type& locGrad, size_t ip, const number* vCoeff) const
+		{
+			const grad_type* vGrad = grads(ip);
+			VecSet(locGrad, 0.0);
+			for(size_t sh = 0; sh < num_sh(); ++sh)
+				VecScaleAppend(locGrad, vCoeff[sh], vGrad[sh]);
+		}
+
+	public:
+		LocalShapeTable() : m_pCur(&m_vEntry[0]) {}
+		LocalShapeTable(const LocalShapeTable&) : m_pCur(&m_vEntry[0]) {}
+		LocalShapeTable& operator=(const LocalShapeTable&)
+		{
+			for(int i = 0; i < NUM_REFERENCE_OBJECTS; ++i) m_vEntry[i] = Entry();
+			m_pCur = &m_vEntry[0];
+			return *this;
+		}
+
+	protected:
+		struct Entry
+		{
+			Entry() : valid(false), bGrad(false), nsh(0) {}
+			bool valid;
+			LFEID lfeID;
+			bool bGrad;
+			size_t nsh;
+			std::vector<MathVector<refDim> > vLocIP;
+			std::vector<number> vShape;
+			std::vector<grad_type> vGrad;
+		};
+
+		static bool same_points(const Entry& e, const MathVector<refDim>* vLocIP, size_t nip)
+		{
+			for(size_t ip = 0; ip < nip; ++ip)
+				for(int d = 0; d < refDim; ++d)
+					if(e.vLocIP[ip][d] != vLocIP[ip][d])
+						return false;
+			return true;
+		}
+
+	///	tables per reference object id
+		Entry m_vEntry[NUM_REFERENCE_OBJECTS];
+
+	///	table of the last update
+		Entry* m_pCur;
+};
+
+/// Shape tables for all reference dimensions
+/**
+ * Helper for classes evaluating at local points of elements of varying
+ * reference dimension, e.g. in a template method on the reference dimension.
+ */
+class LocalShapeTableSet
+{
+	public:
+	///	returns the shape table for a reference dimension
+		template <int refDim>
+		LocalShapeTable<refDim>& get();
+
+	protected:
+		LocalShapeTable<1> m_table1;
+		LocalShapeTable<2> m_table2;
+		LocalShapeTable<3> m_table3;
+};
+
+template <> inline LocalShapeTable<1>& LocalShapeTableSet::get<1>() {return m_table1;}
+template <> inline LocalShapeTable<2>& LocalShapeTableSet::get<2>() {return m_table2;}
+template <> inline LocalShapeTable<3>& LocalShapeTableSet::get<3>() {return m_table3;}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LOCAL_SHAPE_TABLE__ */
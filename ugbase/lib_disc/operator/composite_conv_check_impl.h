@@ -446,6 +446,9 @@ void CompositeConvCheck<TVector, TDomain>::start(const TVector& vec)
 
 	m_currentStep = 0;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::begin_solve(this, m_name, defect());
+
 	if (m_verbose)
 	{
 		UG_LOG("\n");
@@ -547,6 +550,9 @@ void CompositeConvCheck<TVector, TDomain>::update(const TVector& vec)
 
 	m_currentStep++;
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::iteration(this, defect());
+
 	if (m_verbose)
 	{
 		for (size_t cmp = 0; cmp < m_CmpInfo.size(); cmp++)
@@ -659,6 +665,9 @@ bool CompositeConvCheck<TVector, TDomain>::post()
 		if (!cmpFinished) success = false;
 	}
 
+	if(SolverTelemetry::enabled())
+		SolverTelemetry::end_solve(this, success);
+
 	if (m_verbose)
 	{
 		print_offset();
@@ -71,14 +71,15 @@ class AssembledLinearOperator :
 
 	public:
 	///	Default Constructor
-		AssembledLinearOperator() :	m_spAss(NULL) {};
+		AssembledLinearOperator() :	m_spAss(NULL), m_bCompleteInterfaceRows(false) {};
 
 	///	Constructor
-		AssembledLinearOperator(SmartPtr<IAssemble<TAlgebra> > ass) : m_spAss(ass) {};
+		AssembledLinearOperator(SmartPtr<IAssemble<TAlgebra> > ass)
+			: m_spAss(ass), m_bCompleteInterfaceRows(false) {};
 
 	///	Constructor
 		AssembledLinearOperator(SmartPtr<IAssemble<TAlgebra> > ass, const GridLevel& gl)
-			: m_spAss(ass), m_gridLevel(gl) {};
+			: m_spAss(ass), m_gridLevel(gl), m_bCompleteInterfaceRows(false) {};
 
 	///	sets the discretization to be used
 		void set_discretization(SmartPtr<IAssemble<TAlgebra> > ass) {m_spAss = ass;}
@@ -92,6 +93,18 @@ class AssembledLinearOperator :
 	///	returns the level
 		const GridLevel& level() const {return m_gridLevel;}
 
+	///	sets if the interface rows are completed once after each assembly
+	/**
+	 * In parallel, the matrix is assembled additively from the local elements.
+	 * If enabled, the rows of the interface unknowns are additionally
+	 * completed by the contributions of the neighbor processes right after
+	 * assembling, as if the layer of elements behind the interface had been
+	 * assembled as well. Smoothers needing complete rows then reuse them
+	 * instead of exchanging them on each preprocess. The additive matrix,
+	 * used for defect computations, is not changed.
+	 */
+		void set_complete_interface_rows(bool bComplete) {m_bCompleteInterfaceRows = bComplete;}
+
 	///	initializes the operator that may depend on the current solution
 		virtual void init(const vector_type& u);
 
@@ -119,6 +132,12 @@ class AssembledLinearOperator :
 
 	// 	DoF Distribution used
 		GridLevel m_gridLevel;
+
+	///	completes the interface rows after assembling (if requested)
+		void complete_interface_rows();
+
+	//	flag if interface rows are completed after assembling
+		bool m_bCompleteInterfaceRows;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
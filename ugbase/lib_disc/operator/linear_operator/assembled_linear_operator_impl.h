@@ -35,6 +35,9 @@
 
 #include "assembled_linear_operator.h"
 #include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallel_matrix_overlap_impl.h"
+#endif
 
 #define PROFILE_ASS
 #ifdef PROFILE_ASS
@@ -61,6 +64,8 @@ AssembledLinearOperator<TAlgebra>::init(const vector_type& u)
 		m_spAss->assemble_jacobian(*this, u, m_gridLevel);
 	}
 	UG_CATCH_THROW("AssembledLinearOperator: Cannot assemble Jacobi matrix.");
+
+	complete_interface_rows();
 }
 
 //	Initialize the operator
@@ -79,6 +84,8 @@ AssembledLinearOperator<TAlgebra>::init()
 		m_spAss->assemble_linear(*this, dummy, m_gridLevel);
 	}
 	UG_CATCH_THROW("AssembledLinearOperator::init: Cannot assemble Matrix.");
+
+	complete_interface_rows();
 }
 
 //	Initialize the operator
@@ -97,6 +104,24 @@ AssembledLinearOperator<TAlgebra>::init_op_and_rhs(vector_type& b)
 	}
 	UG_CATCH_THROW("AssembledLinearOperator::init_op_and_rhs:"
 						" Cannot assemble Matrix and Rhs.");
+
+	complete_interface_rows();
+}
+
+template <typename TAlgebra>
+void
+AssembledLinearOperator<TAlgebra>::complete_interface_rows()
+{
+#ifdef UG_PARALLEL
+	this->set_consistent_rows_matrix(SPNULL);
+	if(!m_bCompleteInterfaceRows || pcl::NumProcs() == 1) return;
+
+	ASS_PROFILE_BEGIN(ASS_CompleteInterfaceRows);
+	SmartPtr<matrix_type> spRows = make_sp(new matrix_type);
+	MakeConsistent(static_cast<const matrix_type&>(*this), *spRows);
+	this->set_consistent_rows_matrix(spRows);
+	ASS_PROFILE_END();
+#endif
 }
 
 template <typename TAlgebra>
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_disc/spatial_disc/domain_disc_interface.h"
+
+namespace ug{
+
+///	matrix-free linear operator based on the element discretizations
+/**
+ * This operator applies the Jacobian of a domain discretization element by
+ * element (gather local vector, apply local Jacobian, scatter), i.e. the
+ * global matrix is never assembled. Element discretizations may provide a
+ * direct application of their local Jacobian (IElemDisc::set_apply_jac_A_elem_fct),
+ * otherwise the local Jacobian is assembled and applied per element.
+ *
+ * The matrix part of this MatrixOperator only contains the diagonal (blocks)
+ * of the Jacobian, that is assembled separately in init. Thus, point-wise
+ * smoothers like Jacobi can be used as preconditioners, while preconditioners
+ * that need the whole matrix (ILU, Gauss-Seidel, AMG, ...) can not.
+ *
+ * Only Dirichlet constraints are supported.
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeOperator :
+	public virtual MatrixOperator<	typename TAlgebra::matrix_type,
+									typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Type of Matrix
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Type of base class
+		typedef MatrixOperator<matrix_type,vector_type> base_type;
+
+	public:
+	///	Default Constructor
+		MatrixFreeOperator() :	m_spDomDisc(NULL) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IDomainDiscretization<TAlgebra> > domDisc)
+			: m_spDomDisc(domDisc) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IDomainDiscretization<TAlgebra> > domDisc, const GridLevel& gl)
+			: m_spDomDisc(domDisc), m_gridLevel(gl) {};
+
+	///	sets the discretization to be used
+		void set_discretization(SmartPtr<IDomainDiscretization<TAlgebra> > domDisc) {m_spDomDisc = domDisc;}
+
+	///	returns the discretization to be used
+		SmartPtr<IDomainDiscretization<TAlgebra> > discretization() {return m_spDomDisc;}
+
+	///	sets the level used for assembling
+		void set_level(const GridLevel& gl) {m_gridLevel = gl;}
+
+	///	returns the level
+		const GridLevel& level() const {return m_gridLevel;}
+
+	///	initializes the operator at the current solution, i.e. J(u)
+		virtual void init(const vector_type& u);
+
+	///	initializes the operator for a linear problem
+		virtual void init();
+
+	///	initializes the operator and assembles the passed rhs vector
+		void init_op_and_rhs(vector_type& b);
+
+	///	compute d = J(u)*c (matrix-free)
+		virtual void apply(vector_type& d, const vector_type& c);
+
+	///	Compute d := d - J(u)*c (matrix-free)
+		virtual void apply_sub(vector_type& d, const vector_type& c);
+
+	///	Set Dirichlet values
+		void set_dirichlet_values(vector_type& u);
+
+	///	Destructor
+		virtual ~MatrixFreeOperator() {};
+
+	protected:
+	///	assembles the diagonal
+		void init_diagonal();
+
+	protected:
+	// 	domain discretization
+		SmartPtr<IDomainDiscretization<TAlgebra> > m_spDomDisc;
+
+	// 	DoF Distribution used
+		GridLevel m_gridLevel;
+
+	//	point of linearization (invalid for linear problems)
+		SmartPtr<vector_type> m_spU;
+
+	//	temporary for apply_sub
+		SmartPtr<vector_type> m_spTmp;
+};
+
+} // namespace ug
+
+// include implementation
+#include "matrix_free_operator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__ */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+
+#include "matrix_free_operator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init_diagonal()
+{
+	if(m_spDomDisc.invalid())
+		UG_THROW("MatrixFreeOperator: Discretization not set.");
+
+	vector_type dummy;
+	try{
+		m_spDomDisc->assemble_jacobian_diagonal(*this, m_spU.valid() ? *m_spU : dummy,
+		                                        m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator: Cannot assemble diagonal of Jacobian.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init(const vector_type& u)
+{
+//	remember point of linearization
+	m_spU = u.clone();
+	init_diagonal();
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init()
+{
+	m_spU = SPNULL;
+	init_diagonal();
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init_op_and_rhs(vector_type& b)
+{
+	init();
+
+	try{
+		m_spDomDisc->assemble_rhs(b, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::init_op_and_rhs: Cannot assemble Rhs.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply(vector_type& d, const vector_type& c)
+{
+	PROFILE_FUNC_GROUP("discretization");
+#ifdef UG_PARALLEL
+	if(!c.has_storage_type(PST_CONSISTENT))
+		UG_THROW("Inadequate storage format of Vector c.");
+#endif
+
+	if(m_spDomDisc.invalid())
+		UG_THROW("MatrixFreeOperator: Discretization not set.");
+
+	if(c.size() != this->num_cols())
+		UG_THROW("MatrixFreeOperator::apply: Size of operator ["<<
+		        this->num_rows() << " x " << this->num_cols() << "] must match the "
+		        "size of vector x ["<<c.size()<<"] for the operation b = A*x."
+		        " Maybe the operator is not initialized ?");
+
+	vector_type dummy;
+	try{
+		m_spDomDisc->apply_jacobian(d, c, m_spU.valid() ? *m_spU : dummy, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::apply: Cannot apply Jacobian.");
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply_sub(vector_type& d, const vector_type& c)
+{
+#ifdef UG_PARALLEL
+	if(!d.has_storage_type(PST_ADDITIVE))
+		UG_THROW("Inadequate storage format of Vector d.");
+#endif
+
+	if(c.size() != this->num_cols() || d.size() != this->num_rows())
+		UG_THROW("MatrixFreeOperator::apply_sub: Size of operator ["<<
+		        this->num_rows() << " x " << this->num_cols() << "] must match the "
+		        "sizes of vectors x ["<<c.size()<<"], b ["<<d.size()<<"] for the "
+		        " operation b -= A*x. Maybe the operator is not initialized ?");
+
+	if(m_spTmp.invalid() || m_spTmp->size() != d.size())
+		m_spTmp = d.clone_without_values();
+
+	apply(*m_spTmp, c);
+	VecScaleAdd(d, 1.0, d, -1.0, *m_spTmp);
+}
+
+template <typename TAlgebra>
+void MatrixFreeOperator<TAlgebra>::set_dirichlet_values(vector_type& u)
+{
+	if(m_spDomDisc.invalid())
+		UG_THROW("MatrixFreeOperator: Discretization not set.");
+
+	try{
+		m_spDomDisc->adjust_solution(u, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::set_dirichlet_values:"
+				" Cannot assemble solution.");
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__ */
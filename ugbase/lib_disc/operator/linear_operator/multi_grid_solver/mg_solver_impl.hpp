@@ -37,6 +37,7 @@
 #include <sstream>
 #include <string>
 #include "common/profiler/profiler.h"
+#include "common/profiler/solver_telemetry.h"
  #include "common/error.h"
 #include "lib_disc/function_spaces/grid_function_util.h"
 #include "lib_disc/operator/linear_operator/std_transfer.h"
@@ -169,6 +170,7 @@ bool AssembledMultiGridCycle<TDomain, TAlgebra>::
 apply(vector_type& rC, const vector_type& rD)
 {
 	GMG_PROFILE_FUNC();
+	SOLVER_TELEMETRY_BEGIN(tsApply, "precond_apply");
 	GF* pC = dynamic_cast<GF*>(&rC);
 	if(!pC) UG_THROW("GMG::apply: Expect Correction to be grid based.")
 	const GF* pD = dynamic_cast<const GF*>(&rD);
@@ -311,6 +313,7 @@ bool AssembledMultiGridCycle<TDomain, TAlgebra>::
 init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
 {
 	GMG_PROFILE_FUNC();
+	SOLVER_TELEMETRY_BEGIN(tsInit, "precond_setup");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - init(J, u)\n");
 
 	// try to extract assembling routine
@@ -338,6 +341,7 @@ bool AssembledMultiGridCycle<TDomain, TAlgebra>::
 init(SmartPtr<ILinearOperator<vector_type> > L)
 {
 	GMG_PROFILE_FUNC();
+	SOLVER_TELEMETRY_BEGIN(tsInit, "precond_setup");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - init(L)\n");
 
 	// try to extract assembling routine
@@ -1646,6 +1650,7 @@ presmooth_and_restriction(int lev)
 
 //	PRESMOOTH
 	GMG_PROFILE_BEGIN(GMG_PreSmooth);
+	SOLVER_TELEMETRY_LEVEL_BEGIN(tsPreSmooth, "presmooth", lev);
 	try{
 	//	smooth several times
 		for(int nu = 0; nu < m_numPreSmooth; ++nu)
@@ -1679,8 +1684,12 @@ presmooth_and_restriction(int lev)
 		}
 	}
 	UG_CATCH_THROW("GMG: Pre-Smoothing on level "<<lev<<" failed.");
+	SOLVER_TELEMETRY_END(tsPreSmooth);
 	GMG_PROFILE_END();
 
+//	the restriction includes the vertical communication
+	SOLVER_TELEMETRY_LEVEL_BEGIN(tsRestrict, "restrict", lev);
+
 	log_debug_data(lev, "AfterPreSmooth_BeforeCom");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - presmooth on level "<<lev<<"\n");
 
@@ -1768,6 +1777,7 @@ prolongation_and_postsmooth(int lev)
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - prolongation on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforeProlong");
+	SOLVER_TELEMETRY_LEVEL_BEGIN(tsProlong, "prolong", lev);
 
 //	ADAPTIVE CASE:
 	if(lev > m_LocalFullRefLevel)
@@ -1845,12 +1855,14 @@ prolongation_and_postsmooth(int lev)
 	(*lf.sc) += (*lf.st);
 	GMG_PROFILE_END();
 
+	SOLVER_TELEMETRY_END(tsProlong);
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - prolongation on level "<<lev<<"\n");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - postsmooth on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforePostSmooth");
 
 // 	POST-SMOOTH:
 	GMG_PROFILE_BEGIN(GMG_PostSmooth);
+	SOLVER_TELEMETRY_LEVEL_BEGIN(tsPostSmooth, "postsmooth", lev);
 	try{
 	//	smooth several times
 		for(int nu = 0; nu < m_numPostSmooth; ++nu)
@@ -1898,6 +1910,7 @@ void AssembledMultiGridCycle<TDomain, TAlgebra>::
 base_solve(int lev)
 {
 	GMG_PROFILE_FUNC();
+	SOLVER_TELEMETRY_BEGIN(tsBaseSolve, "mg_base_solve");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - base_solve on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforeBaseSolver");
 
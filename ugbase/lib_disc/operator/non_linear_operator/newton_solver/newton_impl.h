@@ -39,6 +39,7 @@
 #include "newton.h"
 #include "lib_disc/function_spaces/grid_function_util.h"
 #include "common/util/string_util.h"
+#include "common/profiler/solver_telemetry.h"
 
 #define PROFILE_NEWTON
 #ifdef PROFILE_NEWTON
@@ -167,7 +168,9 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 // 	Compute first Defect
 	try{
 	NEWTON_PROFILE_BEGIN(NewtonComputeDefect1);
+	SOLVER_TELEMETRY_BEGIN(tsDefect, "assemble_defect");
 	m_N->apply(*spD, u);
+	SOLVER_TELEMETRY_END(tsDefect);
 	NEWTON_PROFILE_END();
 	}UG_CATCH_THROW("NewtonSolver::apply: Computation of Start-Defect failed.");
 
@@ -207,7 +210,9 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	// 	Compute Jacobian
 		try{
 		NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
+		SOLVER_TELEMETRY_BEGIN(tsJacobian, "assemble_jacobian");
 		m_J->init(u);
+		SOLVER_TELEMETRY_END(tsJacobian);
 		NEWTON_PROFILE_END();
 		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
 
@@ -219,24 +224,28 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	// 	Init Jacobi Inverse
 		try{
 		NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
+		SOLVER_TELEMETRY_BEGIN(tsLinInit, "linear_solver_init");
 		if(!m_spLinearSolver->init(m_J, u))
 		{
 			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
 					"Operator for Jacobi-Operator.\n");
 			return false;
 		}
+		SOLVER_TELEMETRY_END(tsLinInit);
 		NEWTON_PROFILE_END();
 		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
 
 	// 	Solve Linearized System
 		try{
 		NEWTON_PROFILE_BEGIN(NewtonApplyLinSolver);
+		SOLVER_TELEMETRY_BEGIN(tsLinSolve, "linear_solve");
 		if(!m_spLinearSolver->apply(*spC, *spD))
 		{
 			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot apply Inverse Linear "
 					"Operator for Jacobi-Operator.\n");
 			return false;
 		}
+		SOLVER_TELEMETRY_END(tsLinSolve);
 		NEWTON_PROFILE_END();
 		}UG_CATCH_THROW("NewtonSolver::apply: Application of Linear Solver failed.");
 
@@ -255,6 +264,7 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		{
 			m_spLineSearch->set_offset("   #  ");
 			NEWTON_PROFILE_BEGIN(NewtonLineSearch);
+			SOLVER_TELEMETRY_BEGIN(tsLineSearch, "line_search");
 			if(!m_spLineSearch->search(m_N, u, *spC, *spD, m_spConvCheck->defect()))
 			{
 				UG_LOG("ERROR in 'NewtonSolver::apply': "
@@ -271,8 +281,10 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 
 		// 	compute new Defect
 			NEWTON_PROFILE_BEGIN(NewtonComputeDefect);
+			SOLVER_TELEMETRY_BEGIN(tsDefect, "assemble_defect");
 			m_N->prepare(u);
 			m_N->apply(*spD, u);
+			SOLVER_TELEMETRY_END(tsDefect);
 			NEWTON_PROFILE_END();
 		}
 		}UG_CATCH_THROW("NewtonSolver::apply: Line Search update failed.");
@@ -213,6 +213,12 @@ class DimReferenceMappingWrapper
 			TRefMapping::sqrt_gram_det(vDet, vLocPos);
 		}
 
+	///	returns a new, independent copy of this mapping
+		virtual SmartPtr<DimReferenceMapping<dim, worldDim> > clone() const
+		{
+			return make_sp(new DimReferenceMappingWrapper<TRefMapping>(*this));
+		}
+
 	///	virtual destructor
 		virtual ~DimReferenceMappingWrapper() {}
 };
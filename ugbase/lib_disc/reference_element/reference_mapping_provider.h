@@ -36,6 +36,7 @@
 
 #include "common/common.h"
 #include "common/math/ugmath.h"
+#include "common/util/smart_pointer.h"
 #include "lib_grid/grid/grid_base_objects.h"
 
 namespace ug{
@@ -154,6 +155,19 @@ class DimReferenceMapping
 		virtual void sqrt_gram_det(std::vector<number>& vDet,
 								  const std::vector<MathVector<dim> >& vLocPos) const = 0;
 
+	///	returns a new, independent copy of this mapping
+	/**
+	 * The mappings handed out by the ReferenceMappingProvider are shared
+	 * instances. Code that updates mappings concurrently (e.g. from several
+	 * threads) must work on private copies created by this method. The
+	 * default implementation throws, such that existing derived mappings
+	 * need not implement it unless they are used this way.
+	 */
+		virtual SmartPtr<DimReferenceMapping<TDim, TWorldDim> > clone() const
+		{
+			UG_THROW("DimReferenceMapping::clone: not implemented for this mapping.");
+		}
+
 	///	virtual destructor
 		virtual ~DimReferenceMapping() {}
 };
@@ -234,6 +234,11 @@ class AssemblingTuner
 		void set_dirichlet_row(matrix_type& mat, const DoFIndex& ind) const;
 		void set_dirichlet_val(vector_type& vec, const DoFIndex& ind, const double val) const;
 
+	///	sets dirichlet rows / values for a list of indices at once
+		void set_dirichlet_rows(matrix_type& mat, const std::vector<DoFIndex>& vInd) const;
+		void set_dirichlet_vals(vector_type& vec, const std::vector<DoFIndex>& vInd, const std::vector<number>& vVal) const;
+		void set_dirichlet_vals(vector_type& vec, const std::vector<DoFIndex>& vInd, const double val) const;
+
 	/**
 	 * specify whether matrix will be modified by assembling
 	 * disables matrix assembling if set to true
@@ -131,6 +131,48 @@ void AssemblingTuner<TAlgebra>::set_dirichlet_val(vector_type& vec, const DoFInd
 	}
 }
 
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::set_dirichlet_rows(matrix_type& mat, const std::vector<DoFIndex>& vInd) const
+{
+	if(single_index_assembling_enabled())
+	{
+		for(size_t i = 0; i < vInd.size(); ++i)
+			set_dirichlet_row(mat, vInd[i]);
+	}
+	else{
+		SetDirichletRow(mat, vInd);
+	}
+}
+
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::set_dirichlet_vals(vector_type& vec, const std::vector<DoFIndex>& vInd, const std::vector<number>& vVal) const
+{
+	UG_ASSERT(vInd.size() == vVal.size(), "Size mismatch");
+
+	if(single_index_assembling_enabled())
+	{
+		for(size_t i = 0; i < vInd.size(); ++i)
+			set_dirichlet_val(vec, vInd[i], vVal[i]);
+	}
+	else{
+		for(size_t i = 0; i < vInd.size(); ++i)
+			DoFRef(vec, vInd[i]) = vVal[i];
+	}
+}
+
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::set_dirichlet_vals(vector_type& vec, const std::vector<DoFIndex>& vInd, const double val) const
+{
+	if(single_index_assembling_enabled())
+	{
+		for(size_t i = 0; i < vInd.size(); ++i)
+			set_dirichlet_val(vec, vInd[i], val);
+	}
+	else{
+		for(size_t i = 0; i < vInd.size(); ++i)
+			DoFRef(vec, vInd[i]) = val;
+	}
+}
 
 } // end namespace ug
 
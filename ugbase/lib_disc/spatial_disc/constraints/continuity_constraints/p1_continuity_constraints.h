@@ -45,6 +45,45 @@ void CollectConstraining(std::vector<Vertex*>& vConstrainingVrt,
                          ConstrainedVertex* hgVrt,
                          bool bClearContainer = true);
 
+///	interpolation matrix of the hanging node constraints of a dof distribution
+/**
+ * Only the rows of the constrained indices are stored (all other rows of the
+ * interpolation matrix are the identity): The constrained index vConstrained[i]
+ * is interpolated from the constraining indices
+ * vConstraining[vRowStart[i]], ..., vConstraining[vRowStart[i+1]-1], each of
+ * them weighted by the inverse number of constraining indices.
+ */
+struct P1ConstraintInterpolation
+{
+	P1ConstraintInterpolation() : vRowStart(1, 0) {}
+
+///	number of constrained indices
+	size_t num_rows() const {return vConstrained.size();}
+
+///	number of constraining indices of a constrained index
+	size_t num_constraining(size_t i) const {return vRowStart[i+1] - vRowStart[i];}
+
+///	removes all rows
+	void clear() {vConstrained.clear(); vRowStart.assign(1, 0); vConstraining.clear();}
+
+///	appends the rows for the indices of a constrained vertex
+	void add_rows(const std::vector<size_t>& constrainedInd,
+	              const std::vector<std::vector<size_t> >& vConstrainingInd)
+	{
+		for(size_t i = 0; i < constrainedInd.size(); ++i)
+		{
+			vConstrained.push_back(constrainedInd[i]);
+			for(size_t j = 0; j < vConstrainingInd.size(); ++j)
+				vConstraining.push_back(vConstrainingInd[j][i]);
+			vRowStart.push_back(vConstraining.size());
+		}
+	}
+
+	std::vector<size_t> vConstrained;
+	std::vector<size_t> vRowStart;
+	std::vector<size_t> vConstraining;
+};
+
 
 template <typename TDomain, typename TAlgebra>
 class SymP1Constraints
@@ -61,11 +100,35 @@ class SymP1Constraints
 		typedef typename algebra_type::vector_type vector_type;
 
 	public:
-		SymP1Constraints() : IDomainConstraint<TDomain, TAlgebra>(), m_bAssembleLinearProblem(false) {}
+		SymP1Constraints() : IDomainConstraint<TDomain, TAlgebra>(), m_bAssembleLinearProblem(false),
+			m_bUseInterpolation(true) {}
 		virtual ~SymP1Constraints() {}
 
 		virtual int type() const {return CT_HANGING;}
 
+		virtual void set_approximation_space(SmartPtr<ApproximationSpace<TDomain> > approxSpace)
+		{
+			IDomainConstraint<TDomain, TAlgebra>::set_approximation_space(approxSpace);
+			m_mInterpolationCache.clear();
+		}
+
+	///	enables the application of the constraints by a cached interpolation matrix
+	/**	If enabled (default), the constrained and constraining indices are
+	 * collected once per dof distribution and grid revision and the constraints
+	 * are applied algebraically (A -> P^T A P, with the interpolation rows
+	 * for the constrained indices) in one pass over the cached interpolation
+	 * matrix. Otherwise, the indices are collected from the grid on each call.*/
+		void set_use_interpolation(bool bUse) {m_bUseInterpolation = bUse;}
+
+	///	drops all cached interpolation matrices
+		void invalidate_interpolation() {m_mInterpolationCache.clear();}
+
+	///	returns the (cached) interpolation matrix for a dof distribution
+	/**	The matrix is rebuilt if the dof distribution or the revision of the
+	 * approximation space has changed. It can e.g. be reused by transfer
+	 * operators.*/
+		const P1ConstraintInterpolation& interpolation(ConstSmartPtr<DoFDistribution> dd);
+
 		void adjust_jacobian(matrix_type& J, const vector_type& u,
 		                     ConstSmartPtr<DoFDistribution> dd, int type, number time = 0.0,
                              ConstSmartPtr<VectorTimeSeries<vector_type> > vSol = NULL,
@@ -107,6 +170,22 @@ class SymP1Constraints
 
 	protected:
 		bool m_bAssembleLinearProblem;
+
+	///	cached interpolation matrix for a dof distribution
+		struct InterpolationCache
+		{
+			InterpolationCache() : pDD(NULL) {}
+
+			const DoFDistribution* pDD;
+			RevisionCounter revCnt;
+			P1ConstraintInterpolation P;
+		};
+
+	///	flag if constraints are applied using the cached interpolation matrix
+		bool m_bUseInterpolation;
+
+	///	cache of interpolation matrices, per grid level
+		std::map<GridLevel, InterpolationCache> m_mInterpolationCache;
 };
 
 
@@ -129,11 +208,35 @@ class OneSideP1Constraints
 		typedef IDomainConstraint<TDomain, TAlgebra> base_type;
 
 	public:
-		OneSideP1Constraints() : IDomainConstraint<TDomain, TAlgebra>(), m_bAssembleLinearProblem(false) {}
+		OneSideP1Constraints() : IDomainConstraint<TDomain, TAlgebra>(), m_bAssembleLinearProblem(false),
+			m_bUseInterpolation(true) {}
 		virtual ~OneSideP1Constraints() {}
 
 		virtual int type() const {return CT_HANGING;}
 
+		virtual void set_approximation_space(SmartPtr<ApproximationSpace<TDomain> > approxSpace)
+		{
+			IDomainConstraint<TDomain, TAlgebra>::set_approximation_space(approxSpace);
+			m_mInterpolationCache.clear();
+		}
+
+	///	enables the application of the constraints by a cached interpolation matrix
+	/**	If enabled (default), the constrained and constraining indices are
+	 * collected once per dof distribution and grid revision and the constraints
+	 * are applied algebraically (A -> P^T A P, with the interpolation rows
+	 * for the constrained indices) in one pass over the cached interpolation
+	 * matrix. Otherwise, the indices are collected from the grid on each call.*/
+		void set_use_interpolation(bool bUse) {m_bUseInterpolation = bUse;}
+
+	///	drops all cached interpolation matrices
+		void invalidate_interpolation() {m_mInterpolationCache.clear();}
+
+	///	returns the (cached) interpolation matrix for a dof distribution
+	/**	The matrix is rebuilt if the dof distribution or the revision of the
+	 * approximation space has changed. It can e.g. be reused by transfer
+	 * operators.*/
+		const P1ConstraintInterpolation& interpolation(ConstSmartPtr<DoFDistribution> dd);
+
 		void adjust_jacobian(matrix_type& J, const vector_type& u,
 		                     ConstSmartPtr<DoFDistribution> dd, int type, number time = 0.0,
                              ConstSmartPtr<VectorTimeSeries<vector_type> > vSol = NULL,
@@ -175,6 +278,22 @@ class OneSideP1Constraints
 
 	protected:
 		bool m_bAssembleLinearProblem;
+
+	///	cached interpolation matrix for a dof distribution
+		struct InterpolationCache
+		{
+			InterpolationCache() : pDD(NULL) {}
+
+			const DoFDistribution* pDD;
+			RevisionCounter revCnt;
+			P1ConstraintInterpolation P;
+		};
+
+	///	flag if constraints are applied using the cached interpolation matrix
+		bool m_bUseInterpolation;
+
+	///	cache of interpolation matrices, per grid level
+		std::map<GridLevel, InterpolationCache> m_mInterpolationCache;
 };
 
 }; // namespace ug
@@ -295,6 +295,185 @@ void SplitAddRhs_OneSide(TVector& rhs,
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+//	Application of a cached interpolation matrix
+////////////////////////////////////////////////////////////////////////////////
+
+///	sets the row of a constrained index to the interpolation
+template <typename TMatrix>
+inline void SetInterpolationRow(TMatrix& A, size_t constrained,
+                                const size_t* vConstraining, size_t numConstraining,
+                                bool assembleLinearProblem)
+{
+	typedef typename TMatrix::row_iterator row_iterator;
+
+	const row_iterator iterEnd = A.end_row(constrained);
+	for(row_iterator conn = A.begin_row(constrained); conn != iterEnd; ++conn)
+		conn.value() = 0.0;
+
+	A(constrained, constrained) = 1.0;
+
+	if(assembleLinearProblem)
+	{
+		const number frac = -1.0/numConstraining;
+		for(size_t k = 0; k < numConstraining; ++k)
+			A(constrained, vConstraining[k]) = frac;
+	}
+}
+
+///	applies the constraints to a matrix by the symmetric splitting
+/**
+ * Computes P^T A P for the interpolation matrix P and replaces the rows of the
+ * constrained indices by the interpolation. The rows of P are processed one
+ * after the other, which is the same as SplitAddRow_Symmetric followed by
+ * SetInterpolation, since no constraining index is constrained itself.
+ */
+template <typename TMatrix>
+void CondenseMatrix_Symmetric(TMatrix& A, const P1ConstraintInterpolation& P,
+                              bool assembleLinearProblem)
+{
+	typedef typename TMatrix::value_type block_type;
+	typedef typename TMatrix::row_iterator row_iterator;
+
+	for(size_t r = 0; r < P.num_rows(); ++r)
+	{
+		const size_t constrained = P.vConstrained[r];
+		const size_t numConstraining = P.num_constraining(r);
+		const size_t* vConstraining = &P.vConstraining[P.vRowStart[r]];
+		UG_ASSERT(numConstraining > 0, "There have to be constraining indices!");
+
+		const number frac = 1./numConstraining;
+
+	//	coupling constrained dof -> constrained dof
+		block_type block = A(constrained, constrained);
+		block *= frac*frac;
+		for(size_t k = 0; k < numConstraining; ++k)
+			for(size_t m = 0; m < numConstraining; ++m)
+				A(vConstraining[k], vConstraining[m]) += block;
+
+	//	couplings constrained dof <-> other dofs
+		for(row_iterator conn = A.begin_row(constrained);
+				conn != A.end_row(constrained); ++conn)
+		{
+			const size_t j = conn.index();
+			if(j == constrained) continue;
+
+			block_type block = conn.value();
+			block_type blockT = A(j, constrained);
+			block *= frac;
+			blockT *= frac;
+
+			for(size_t k = 0; k < numConstraining; ++k)
+			{
+				UG_ASSERT(vConstraining[k] != constrained,
+						"Modifying 'this' (=conn referenced) matrix row is invalid!" << constrained);
+				A(vConstraining[k], j) += block;
+				A(j, vConstraining[k]) += blockT;
+			}
+
+			A(j, constrained) = 0.0;
+		}
+
+		SetInterpolationRow(A, constrained, vConstraining, numConstraining,
+		                    assembleLinearProblem);
+	}
+}
+
+///	applies the constraints to a matrix by adding the constrained rows to one constraining row
+/**	Same as SplitAddRow_OneSide followed by SetInterpolation, for all rows of P.*/
+template <typename TMatrix>
+void CondenseMatrix_OneSide(TMatrix& A, const P1ConstraintInterpolation& P,
+                            bool assembleLinearProblem)
+{
+	typedef typename TMatrix::value_type block_type;
+	typedef typename TMatrix::row_iterator row_iterator;
+
+	for(size_t r = 0; r < P.num_rows(); ++r)
+	{
+		const size_t constrained = P.vConstrained[r];
+		const size_t numConstraining = P.num_constraining(r);
+		const size_t* vConstraining = &P.vConstraining[P.vRowStart[r]];
+		UG_ASSERT(numConstraining > 0, "There have to be constraining indices!");
+
+		const number frac = 1./numConstraining;
+		const size_t addTo = vConstraining[0];
+
+		block_type block = A(constrained, constrained);
+		block *= frac;
+		for(size_t k = 0; k < numConstraining; ++k)
+			A(addTo, vConstraining[k]) += block;
+
+		for(row_iterator conn = A.begin_row(constrained);
+				conn != A.end_row(constrained); ++conn)
+		{
+			const size_t j = conn.index();
+			if(j == constrained) continue;
+
+			block_type blockT = A(j, constrained);
+			blockT *= frac;
+			for(size_t k = 0; k < numConstraining; ++k)
+				A(j, vConstraining[k]) += blockT;
+
+			A(addTo, j) += conn.value();
+
+			A(j, constrained) = 0.0;
+		}
+
+		SetInterpolationRow(A, constrained, vConstraining, numConstraining,
+		                    assembleLinearProblem);
+	}
+}
+
+///	splits the entries of the constrained indices equally onto the constraining indices
+template <typename TVector>
+void SplitAddRhs_Symmetric(TVector& rhs, const P1ConstraintInterpolation& P)
+{
+	typedef typename TVector::value_type block_type;
+
+	for(size_t r = 0; r < P.num_rows(); ++r)
+	{
+		block_type& val = rhs[P.vConstrained[r]];
+		val *= 1./P.num_constraining(r);
+
+		for(size_t k = P.vRowStart[r]; k < P.vRowStart[r+1]; ++k)
+			rhs[P.vConstraining[k]] += val;
+
+		val = 0.0;
+	}
+}
+
+///	adds the entries of the constrained indices to the first constraining index
+template <typename TVector>
+void SplitAddRhs_OneSide(TVector& rhs, const P1ConstraintInterpolation& P)
+{
+	typedef typename TVector::value_type block_type;
+
+	for(size_t r = 0; r < P.num_rows(); ++r)
+	{
+		block_type& val = rhs[P.vConstrained[r]];
+		rhs[P.vConstraining[P.vRowStart[r]]] += val;
+		val = 0.0;
+	}
+}
+
+///	sets the values of the constrained indices to the interpolated values
+template <typename TVector>
+void InterpolateValues(TVector& u, const P1ConstraintInterpolation& P)
+{
+	typedef typename TVector::value_type block_type;
+
+	for(size_t r = 0; r < P.num_rows(); ++r)
+	{
+		const number frac = 1./P.num_constraining(r);
+
+		block_type& val = u[P.vConstrained[r]];
+		val = 0.0;
+		for(size_t k = P.vRowStart[r]; k < P.vRowStart[r+1]; ++k)
+			VecScaleAdd(val, 1.0, val, frac, u[P.vConstraining[k]]);
+	}
+}
+
+
 inline void get_algebra_indices(ConstSmartPtr<DoFDistribution> dd,
 						 ConstrainedVertex* hgVrt,
 						 std::vector<Vertex*>& vConstrainingVrt,
@@ -346,6 +525,38 @@ inline void get_algebra_indices(ConstSmartPtr<DoFDistribution> dd,
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 
+template <typename TDomain, typename TAlgebra>
+const P1ConstraintInterpolation&
+SymP1Constraints<TDomain,TAlgebra>::
+interpolation(ConstSmartPtr<DoFDistribution> dd)
+{
+//	return cached interpolation if up to date
+	InterpolationCache& cache = m_mInterpolationCache[dd->grid_level()];
+	if(cache.pDD == dd.get() && cache.revCnt == this->m_spApproxSpace->revision())
+		return cache.P;
+
+	cache.P.clear();
+	cache.pDD = dd.get();
+	cache.revCnt = this->m_spApproxSpace->revision();
+
+//	storage for indices and vertices
+	std::vector<std::vector<size_t> > vConstrainingInd;
+	std::vector<size_t>  constrainedInd;
+	std::vector<Vertex*> vConstrainingVrt;
+
+//	collect the rows in the order of the hanging vertices
+	DoFDistribution::traits<ConstrainedVertex>::const_iterator iter, iterEnd;
+	iter = dd->begin<ConstrainedVertex>();
+	iterEnd = dd->end<ConstrainedVertex>();
+	for(; iter != iterEnd; ++iter)
+	{
+		get_algebra_indices(dd, *iter, vConstrainingVrt, constrainedInd, vConstrainingInd);
+		cache.P.add_rows(constrainedInd, vConstrainingInd);
+	}
+
+	return cache.P;
+}
+
 template <typename TDomain, typename TAlgebra>
 void
 SymP1Constraints<TDomain,TAlgebra>::
@@ -359,6 +570,12 @@ adjust_defect(vector_type& d, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		SplitAddRhs_Symmetric(d, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -394,6 +611,12 @@ adjust_rhs(vector_type& rhs, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		SplitAddRhs_Symmetric(rhs, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -430,6 +653,12 @@ adjust_jacobian(matrix_type& J, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		CondenseMatrix_Symmetric(J, interpolation(dd), m_bAssembleLinearProblem);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -469,6 +698,14 @@ adjust_linear(matrix_type& mat, vector_type& rhs,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& P = interpolation(dd);
+		CondenseMatrix_Symmetric(mat, P, true);
+		SplitAddRhs_Symmetric(rhs, P);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -509,6 +746,12 @@ adjust_solution(vector_type& u, ConstSmartPtr<DoFDistribution> dd,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		InterpolateValues(u, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -552,6 +795,14 @@ adjust_prolongation
 			UG_THROW("index-wise assemble routine is not "
 					"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& I = interpolation(ddFine);
+		for(size_t i = 0; i < I.num_rows(); ++i)
+			SetRow(P, I.vConstrained[i], 0.0);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -612,6 +863,14 @@ adjust_correction
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& P = interpolation(dd);
+		for(size_t i = 0; i < P.num_rows(); ++i)
+			u[P.vConstrained[i]] = 0.0;
+		return;
+	}
+
 	// storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -752,6 +1011,48 @@ inline void get_algebra_indices(ConstSmartPtr<DoFDistribution> dd,
 }
 
 
+template <typename TDomain, typename TAlgebra>
+const P1ConstraintInterpolation&
+OneSideP1Constraints<TDomain,TAlgebra>::
+interpolation(ConstSmartPtr<DoFDistribution> dd)
+{
+//	return cached interpolation if up to date
+	InterpolationCache& cache = m_mInterpolationCache[dd->grid_level()];
+	if(cache.pDD == dd.get() && cache.revCnt == this->m_spApproxSpace->revision())
+		return cache.P;
+
+	cache.P.clear();
+	cache.pDD = dd.get();
+	cache.revCnt = this->m_spApproxSpace->revision();
+
+//	storage for indices and vertices
+	std::vector<std::vector<size_t> > vConstrainingInd;
+	std::vector<size_t>  constrainedInd;
+	std::vector<Vertex*> vConstrainingVrt;
+
+#ifdef UG_PARALLEL
+	SortVertexPos<TDomain::dim> sortVertexPos(this->approximation_space()->domain());
+#endif
+
+//	collect the rows in the order of the hanging vertices
+//	(in parallel, the constraining vertices are sorted by position, such that
+//	the index the rows are added to is the same on all processes)
+	DoFDistribution::traits<ConstrainedVertex>::const_iterator iter, iterEnd;
+	iter = dd->begin<ConstrainedVertex>();
+	iterEnd = dd->end<ConstrainedVertex>();
+	for(; iter != iterEnd; ++iter)
+	{
+#ifdef UG_PARALLEL
+		get_algebra_indices<TDomain>(dd, *iter, vConstrainingVrt, constrainedInd, vConstrainingInd, sortVertexPos);
+#else
+		get_algebra_indices(dd, *iter, vConstrainingVrt, constrainedInd, vConstrainingInd);
+#endif
+		cache.P.add_rows(constrainedInd, vConstrainingInd);
+	}
+
+	return cache.P;
+}
+
 template <typename TDomain, typename TAlgebra>
 void
 OneSideP1Constraints<TDomain,TAlgebra>::
@@ -765,6 +1066,12 @@ adjust_defect(vector_type& d, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		SplitAddRhs_OneSide(d, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -808,6 +1115,12 @@ adjust_rhs(vector_type& rhs, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		SplitAddRhs_OneSide(rhs, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -852,6 +1165,12 @@ adjust_jacobian(matrix_type& J, const vector_type& u,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		CondenseMatrix_OneSide(J, interpolation(dd), m_bAssembleLinearProblem);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -899,6 +1218,14 @@ adjust_linear(matrix_type& mat, vector_type& rhs,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& P = interpolation(dd);
+		CondenseMatrix_OneSide(mat, P, true);
+		SplitAddRhs_OneSide(rhs, P);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -947,6 +1274,12 @@ adjust_solution(vector_type& u, ConstSmartPtr<DoFDistribution> dd,
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		InterpolateValues(u, interpolation(dd));
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -991,6 +1324,14 @@ adjust_prolongation
 			UG_THROW("index-wise assemble routine is not "
 					"implemented for SymP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& I = interpolation(ddFine);
+		for(size_t i = 0; i < I.num_rows(); ++i)
+			SetRow(P, I.vConstrained[i], 0.0);
+		return;
+	}
+
 //	storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
@@ -1050,6 +1391,14 @@ adjust_correction
 		UG_THROW("index-wise assemble routine is not "
 				"implemented for OneSideP1Constraints \n");
 
+	if(m_bUseInterpolation)
+	{
+		const P1ConstraintInterpolation& P = interpolation(dd);
+		for(size_t i = 0; i < P.num_rows(); ++i)
+			u[P.vConstrained[i]] = 0.0;
+		return;
+	}
+
 	// storage for indices and vertices
 	std::vector<std::vector<size_t> > vConstrainingInd;
 	std::vector<size_t>  constrainedInd;
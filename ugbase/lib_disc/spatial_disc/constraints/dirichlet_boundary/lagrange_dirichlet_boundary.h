@@ -123,6 +123,13 @@ class DirichletBoundary
 	///	removes all scheduled dirichlet data.
 		void clear();
 
+	///	drops the cached dirichlet dofs and positions
+	/**	The dirichlet dof indices and their positions are cached per dof
+	 * distribution and recomputed automatically, whenever the approximation
+	 * space changes. If only the vertex positions are altered (e.g. for a
+	 * moving mesh), this method must be called to update the positions. */
+		void invalidate_dof_cache() {m_mDirichletDoFCache.clear();}
+
 	///	Sets dirichlet rows for all registered dirichlet values
 	/**	(implemented by Mr. Xylouris and Mr. Reiter)
 	 *
@@ -316,6 +323,15 @@ class DirichletBoundary
 				(*spFunctor)(val[0], x, time, si); return true;
 			}
 
+			void operator()(std::vector<number>& vVal, std::vector<bool>& vIsDirichlet,
+			                size_t f, const std::vector<MathVector<dim> >& vPos,
+			                number time, int si) const
+			{
+				vVal.resize(vPos.size());
+				if(!vPos.empty())
+					(*spFunctor)(&vVal[0], &vPos[0], time, si, vPos.size());
+			}
+
 			SmartPtr<UserData<number, dim> > spFunctor;
 			std::string fctName;
 			std::string ssName;
@@ -339,6 +355,18 @@ class DirichletBoundary
 				return (*spFunctor)(val[0], x, time, si);
 			}
 
+		//	the batched UserData interface has no condition flags, thus
+		//	conditional data is still evaluated point by point
+			void operator()(std::vector<number>& vVal, std::vector<bool>& vIsDirichlet,
+			                size_t f, const std::vector<MathVector<dim> >& vPos,
+			                number time, int si) const
+			{
+				vVal.resize(vPos.size());
+				vIsDirichlet.resize(vPos.size());
+				for(size_t j = 0; j < vPos.size(); ++j)
+					vIsDirichlet[j] = (*spFunctor)(vVal[j], vPos[j], time, si);
+			}
+
 			SmartPtr<UserData<number, dim, bool> > spFunctor;
 			std::string fctName;
 			std::string ssName;
@@ -362,6 +390,13 @@ class DirichletBoundary
 				val[0] = functor; return true;
 			}
 
+			void operator()(std::vector<number>& vVal, std::vector<bool>& vIsDirichlet,
+			                size_t f, const std::vector<MathVector<dim> >& vPos,
+			                number time, int si) const
+			{
+				vVal.assign(vPos.size(), functor);
+			}
+
 			number functor;
 			std::string fctName;
 			std::string ssName;
@@ -385,6 +420,19 @@ class DirichletBoundary
 				(*spFunctor)(val, x, time, si); return true;
 			}
 
+			void operator()(std::vector<number>& vVal, std::vector<bool>& vIsDirichlet,
+			                size_t f, const std::vector<MathVector<dim> >& vPos,
+			                number time, int si) const
+			{
+				std::vector<MathVector<dim> > vVec(vPos.size());
+				if(!vPos.empty())
+					(*spFunctor)(&vVec[0], &vPos[0], time, si, vPos.size());
+
+				vVal.resize(vPos.size());
+				for(size_t j = 0; j < vPos.size(); ++j)
+					vVal[j] = vVec[j][f];
+			}
+
 			SmartPtr<UserData<MathVector<dim>, dim> > spFunctor;
 			std::string fctName;
 			std::string ssName;
@@ -410,6 +458,50 @@ class DirichletBoundary
 	///	non-conditional boundary values for all subsets
 		std::map<int, std::vector<VectorData*> > m_mVectorBndSegment;
 
+	protected:
+	///	dirichlet dofs of a function on a subset and base element type
+		struct DirichletDoFs
+		{
+			std::vector<DoFIndex> vInd;
+			std::vector<position_type> vPos;
+		};
+
+	///	key for cached dirichlet dofs (function, subset, base object id)
+		struct DirichletDoFKey
+		{
+			DirichletDoFKey(size_t fct_, int si_, int baseObjID_)
+				: fct(fct_), si(si_), baseObjID(baseObjID_) {}
+
+			bool operator<(const DirichletDoFKey& rhs) const
+			{
+				if(fct != rhs.fct) return fct < rhs.fct;
+				if(si != rhs.si) return si < rhs.si;
+				return baseObjID < rhs.baseObjID;
+			}
+
+			size_t fct;
+			int si;
+			int baseObjID;
+		};
+
+	///	cached dirichlet dofs for a dof distribution
+		struct DirichletDoFCache
+		{
+			DirichletDoFCache() : pDD(NULL) {}
+
+			const DoFDistribution* pDD;
+			RevisionCounter revCnt;
+			std::map<DirichletDoFKey, DirichletDoFs> mDoFs;
+		};
+
+	///	returns the (cached) dirichlet dofs of a function on a subset
+		template <typename TBaseElem>
+		const DirichletDoFs& dirichlet_dofs(ConstSmartPtr<DoFDistribution> dd,
+		                                    size_t fct, int si);
+
+	///	cache of dirichlet dofs, per grid level
+		std::map<GridLevel, DirichletDoFCache> m_mDirichletDoFCache;
+
 	protected:
 	/// flag for setting dirichlet columns
 		bool m_bDirichletColumns;
@@ -56,6 +56,7 @@ set_approximation_space(SmartPtr<ApproximationSpace<TDomain> > approxSpace)
 	m_spApproxSpace = approxSpace;
 	m_spDomain = approxSpace->domain();
 	m_aaPos = m_spDomain->position_accessor();
+	m_mDirichletDoFCache.clear();
 }
 
 template <typename TDomain, typename TAlgebra>
@@ -388,6 +389,60 @@ extract_data()
 	extract_data(m_mVectorBndSegment, m_vVectorData);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//	dirichlet dof cache
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TDomain, typename TAlgebra>
+template <typename TBaseElem>
+const typename DirichletBoundary<TDomain, TAlgebra>::DirichletDoFs&
+DirichletBoundary<TDomain, TAlgebra>::
+dirichlet_dofs(ConstSmartPtr<DoFDistribution> dd, size_t fct, int si)
+{
+//	get cache for the grid level, drop outdated entries
+	DirichletDoFCache& cache = m_mDirichletDoFCache[dd->grid_level()];
+	if(cache.pDD != dd.get() || cache.revCnt != m_spApproxSpace->revision())
+	{
+		cache.mDoFs.clear();
+		cache.pDD = dd.get();
+		cache.revCnt = m_spApproxSpace->revision();
+	}
+
+//	return cached dofs if present
+	const DirichletDoFKey key(fct, si, TBaseElem::BASE_OBJECT_ID);
+	typename std::map<DirichletDoFKey, DirichletDoFs>::iterator it = cache.mDoFs.find(key);
+	if(it != cache.mDoFs.end()) return it->second;
+
+//	collect dofs and positions
+	DirichletDoFs& dofs = cache.mDoFs[key];
+
+	const LFEID& lfeID = dd->local_finite_element_id(fct);
+
+	std::vector<DoFIndex> multInd;
+	std::vector<position_type> vPos;
+
+	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
+	iter = dd->begin<TBaseElem>(si);
+	iterEnd = dd->end<TBaseElem>(si);
+
+	for( ; iter != iterEnd; iter++)
+	{
+		TBaseElem* elem = *iter;
+
+		dd->inner_dof_indices(elem, fct, multInd);
+		InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
+
+		UG_ASSERT(multInd.size() == vPos.size(),
+				  "Mismatch: numInd="<<multInd.size()<<", numPos="
+				  <<vPos.size()<<" on "<<elem->reference_object_id());
+
+		dofs.vInd.insert(dofs.vInd.end(), multInd.begin(), multInd.end());
+		dofs.vPos.insert(dofs.vPos.end(), vPos.begin(), vPos.end());
+	}
+
+	return dofs;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //	assemble_dirichlet_rows
 ////////////////////////////////////////////////////////////////////////////////
@@ -756,67 +811,44 @@ adjust_jacobian(const std::vector<TUserData*>& vUserData, int si,
                 matrix_type& J, const vector_type& u,
            	    ConstSmartPtr<DoFDistribution> dd, number time)
 {
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
-//	dummy for readin
-	typename TUserData::value_type val;
-
-//	position of dofs
-	std::vector<position_type> vPos;
+//	dirichlet indices of conditional data
+	std::vector<DoFIndex> vCondInd;
 
 // 	save all dirichlet degree of freedom indices.
 	std::set<size_t> dirichletDoFIndices;
 
-
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
-
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
+			const std::vector<DoFIndex>* pvInd = &dofs.vInd;
 
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
+		// 	check which dofs are dirichlet
+			if(TUserData::isConditional){
+				(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-			//	get dof position
-				if(TUserData::isConditional){
-					InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
-					UG_ASSERT(multInd.size() == vPos.size(), "Size mismatch");
-				}
-
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
-				{
-				// 	check if function is dirichlet
-					if(TUserData::isConditional){
-						if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
-					}
-
-					this->m_spAssTuner->set_dirichlet_row(J, multInd[j]);
-					if(m_bDirichletColumns)
-						dirichletDoFIndices.insert(multInd[j][0]);
-				}
+				vCondInd.clear();
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
+					if(vIsDirichlet[j]) vCondInd.push_back(dofs.vInd[j]);
+				pvInd = &vCondInd;
 			}
+
+			this->m_spAssTuner->set_dirichlet_rows(J, *pvInd);
+			if(m_bDirichletColumns)
+				for(size_t j = 0; j < pvInd->size(); ++j)
+					dirichletDoFIndices.insert((*pvInd)[j][0]);
 		}
 	}
 
-
 	if(m_bDirichletColumns){
 	//	UG_LOG("adjust jacobian\n")
 
@@ -921,59 +953,29 @@ adjust_defect(const std::vector<TUserData*>& vUserData, int si,
               vector_type& d, const vector_type& u,
               ConstSmartPtr<DoFDistribution> dd, number time)
 {
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
-
-//	dummy for readin
-	typename TUserData::value_type val;
-
-//	position of dofs
-	std::vector<position_type> vPos;
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
-
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
-
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
-
-			//	get dof position
-				if(TUserData::isConditional){
-					InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
-					UG_ASSERT(multInd.size() == vPos.size(), "Size mismatch. (multInd.size()="<<
-					          multInd.size()<<", vPos.size()="<<vPos.size()<<")");
-				}
+		//	set zero for dirichlet values
+			if(TUserData::isConditional){
+				(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
-				{
-				// 	check if function is dirichlet
-					if(TUserData::isConditional){
-						if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
-					}
-
-					//	set zero for dirichlet values
-					this->m_spAssTuner->set_dirichlet_val(d, multInd[j], 0.0);
-				}
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
+					if(vIsDirichlet[j])
+						this->m_spAssTuner->set_dirichlet_val(d, dofs.vInd[j], 0.0);
 			}
+			else
+				this->m_spAssTuner->set_dirichlet_vals(d, dofs.vInd, 0.0);
 		}
 	}
 }
@@ -1035,54 +1037,29 @@ void DirichletBoundary<TDomain, TAlgebra>::
 adjust_solution(const std::vector<TUserData*>& vUserData, int si,
                 vector_type& u, ConstSmartPtr<DoFDistribution> dd, number time)
 {
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
-//	value readin
-	typename TUserData::value_type val;
-
-//	position of dofs
-	std::vector<position_type> vPos;
-
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
-
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
-
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
-
-			//	get dof position
-				InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
-
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
-
-				UG_ASSERT(multInd.size() == vPos.size(), "Size mismatch");
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
-				{
-				//  get dirichlet value
-					if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
+		//  get dirichlet values for all dofs at once
+			(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-					this->m_spAssTuner->set_dirichlet_val(u, multInd[j], val[f]);
-				}
+			if(TUserData::isConditional){
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
+					if(vIsDirichlet[j])
+						this->m_spAssTuner->set_dirichlet_val(u, dofs.vInd[j], vVal[j]);
 			}
+			else
+				this->m_spAssTuner->set_dirichlet_vals(u, dofs.vInd, vVal);
 		}
 	}
 }
@@ -1150,54 +1127,29 @@ void DirichletBoundary<TDomain, TAlgebra>::
 adjust_correction(const std::vector<TUserData*>& vUserData, int si,
                 vector_type& c, ConstSmartPtr<DoFDistribution> dd, number time)
 {
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
-
-//	value readin
-	typename TUserData::value_type val;
-
-//	position of dofs
-	std::vector<position_type> vPos;
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
-
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
-
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	get dof position
-				InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
+		//  find out whether to use dirichlet value; concrete value is of no consequence
+			if(TUserData::isConditional){
+				(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
-
-				UG_ASSERT(multInd.size() == vPos.size(), "Size mismatch");
-
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
-				{
-				//  find out whether to use dirichlet value; concrete value is of no consequence
-					if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
-
-					this->m_spAssTuner->set_dirichlet_val(c, multInd[j], 0.0);
-				}
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
+					if(vIsDirichlet[j])
+						this->m_spAssTuner->set_dirichlet_val(c, dofs.vInd[j], 0.0);
 			}
+			else
+				this->m_spAssTuner->set_dirichlet_vals(c, dofs.vInd, 0.0);
 		}
 	}
 }
@@ -1263,63 +1215,46 @@ adjust_linear(const std::vector<TUserData*>& vUserData, int si,
               matrix_type& A, vector_type& b,
               ConstSmartPtr<DoFDistribution> dd, number time)
 {
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
-
-//	readin value
-	typename TUserData::value_type val;
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
 // 	save all dirichlet degree of freedom indices.
 	std::set<size_t> dirichletDoFIndices;
 
-//	position of dofs
-	std::vector<position_type> vPos;
-
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
-
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
-
-			//	get dof position
-				InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
-
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
-
-				UG_ASSERT(multInd.size() == vPos.size(),
-						  "Mismatch: numInd="<<multInd.size()<<", numPos="
-						  <<vPos.size()<<" on "<<elem->reference_object_id());
+		// 	read values for all dofs at once
+			(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
+			if(TUserData::isConditional){
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
 				{
-				// 	check if function is dirichlet and read value
-					if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
+				// 	check if function is dirichlet
+					if(!vIsDirichlet[j]) continue;
 
-					this->m_spAssTuner->set_dirichlet_row(A, multInd[j]);
+					this->m_spAssTuner->set_dirichlet_row(A, dofs.vInd[j]);
 					if(m_bDirichletColumns)
-						dirichletDoFIndices.insert(multInd[j][0]);
+						dirichletDoFIndices.insert(dofs.vInd[j][0]);
 
-					this->m_spAssTuner->set_dirichlet_val(b, multInd[j], val[f]);
+					this->m_spAssTuner->set_dirichlet_val(b, dofs.vInd[j], vVal[j]);
 				}
 			}
+			else{
+				this->m_spAssTuner->set_dirichlet_rows(A, dofs.vInd);
+				if(m_bDirichletColumns)
+					for(size_t j = 0; j < dofs.vInd.size(); ++j)
+						dirichletDoFIndices.insert(dofs.vInd[j][0]);
+
+				this->m_spAssTuner->set_dirichlet_vals(b, dofs.vInd, vVal);
+			}
 		}
 	}
 
@@ -1447,57 +1382,30 @@ adjust_rhs(const std::vector<TUserData*>& vUserData, int si,
 
 	UG_LOG("Entered dirichlet adjust right hand side\n");
 
-//	create Multiindex
-	std::vector<DoFIndex> multInd;
-
-//	readin value
-	typename TUserData::value_type val;
-
-//	position of dofs
-	std::vector<position_type> vPos;
-
-//	iterators
-	typename DoFDistribution::traits<TBaseElem>::const_iterator iter, iterEnd;
-	iter = dd->begin<TBaseElem>(si);
-	iterEnd = dd->end<TBaseElem>(si);
+//	values and flags for conditional data
+	std::vector<number> vVal;
+	std::vector<bool> vIsDirichlet;
 
-//	loop elements
-	for( ; iter != iterEnd; iter++)
+//	loop dirichlet functions on this segment
+	for(size_t i = 0; i < vUserData.size(); ++i)
 	{
-	//	get vertex
-		TBaseElem* elem = *iter;
-
-	//	loop dirichlet functions on this segment
-		for(size_t i = 0; i < vUserData.size(); ++i)
+		for(size_t f = 0; f < TUserData::numFct; ++f)
 		{
-			for(size_t f = 0; f < TUserData::numFct; ++f)
-			{
-			//	get function index
-				const size_t fct = vUserData[i]->fct[f];
-
-			//	get local finite element id
-				const LFEID& lfeID = dd->local_finite_element_id(fct);
-
-			//	get dof position
-				InnerDoFPosition<TDomain>(vPos, elem, *m_spDomain, lfeID);
+		//	get (cached) dirichlet dofs
+			const DirichletDoFs& dofs
+				= dirichlet_dofs<TBaseElem>(dd, vUserData[i]->fct[f], si);
 
-			//	get multi indices
-				dd->inner_dof_indices(elem, fct, multInd);
+		// 	read values for all dofs at once
+			(*vUserData[i])(vVal, vIsDirichlet, f, dofs.vPos, time, si);
 
-				UG_ASSERT(multInd.size() == vPos.size(), "Size mismatch");
-
-			//	loop dofs on element
-				for(size_t j = 0; j < multInd.size(); ++j)
-				{
-				// 	check if function is dirichlet and read value
-					if(!(*vUserData[i])(val, vPos[j], time, si)) continue;
-
-					this->m_spAssTuner->set_dirichlet_val(b, multInd[j], val[f]);
-
-				}
+			if(TUserData::isConditional){
+				for(size_t j = 0; j < dofs.vInd.size(); ++j)
+					if(vIsDirichlet[j])
+						this->m_spAssTuner->set_dirichlet_val(b, dofs.vInd[j], vVal[j]);
 			}
+			else
+				this->m_spAssTuner->set_dirichlet_vals(b, dofs.vInd, vVal);
 		}
-
 	}
 
 
@@ -118,6 +118,10 @@ update_local(ReferenceObjectID roid, const LFEID& lfeID, size_t orderQuad)
 	}
 
 	}UG_CATCH_THROW("FEGeometry::update: Shape Function error.");
+
+//	prepare sum factorization (if applicable)
+	m_sumFact.init(roid, m_lfeID, m_vIPLocal, m_nip);
+	m_vLocVecIP.resize(m_nip);
 }
 
 template <int TWorldDim, int TRefDim>
@@ -295,6 +299,75 @@ update_boundary_faces(GridObject* pElem,
 // explicit instantiations
 ////////////////////////////////////////////////////////////////////////////////
 
+template <int TWorldDim, int TRefDim>
+void
+DimFEGeometry<TWorldDim,TRefDim>::
+interpolate(number* vValIP, const number* vCoeff) const
+{
+	if(m_sumFact.valid()){
+		m_sumFact.values(vValIP, vCoeff);
+		return;
+	}
+
+	for(size_t ip = 0; ip < m_nip; ++ip){
+		vValIP[ip] = 0.0;
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			vValIP[ip] += vCoeff[sh] * m_vvShape[ip][sh];
+	}
+}
+
+template <int TWorldDim, int TRefDim>
+void
+DimFEGeometry<TWorldDim,TRefDim>::
+interpolate_global_grad(MathVector<worldDim>* vGradIP, const number* vCoeff) const
+{
+	if(m_sumFact.valid()){
+		m_sumFact.local_grads(&m_vLocVecIP[0], vCoeff);
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			MatVecMult(vGradIP[ip], m_vJTInv[ip], m_vLocVecIP[ip]);
+		return;
+	}
+
+	for(size_t ip = 0; ip < m_nip; ++ip){
+		VecSet(vGradIP[ip], 0.0);
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			VecScaleAppend(vGradIP[ip], vCoeff[sh], m_vvGradGlobal[ip][sh]);
+	}
+}
+
+template <int TWorldDim, int TRefDim>
+void
+DimFEGeometry<TWorldDim,TRefDim>::
+integrate(number* vCoeff, const number* vValIP) const
+{
+	if(m_sumFact.valid()){
+		m_sumFact.add_values_transposed(vCoeff, vValIP);
+		return;
+	}
+
+	for(size_t ip = 0; ip < m_nip; ++ip)
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			vCoeff[sh] += m_vvShape[ip][sh] * vValIP[ip];
+}
+
+template <int TWorldDim, int TRefDim>
+void
+DimFEGeometry<TWorldDim,TRefDim>::
+integrate_global_grad(number* vCoeff, const MathVector<worldDim>* vVecIP) const
+{
+	if(m_sumFact.valid()){
+	//	grad phi * v = (JTInv * locGrad phi) * v = locGrad phi * (JTInv^T * v)
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			TransposedMatVecMult(m_vLocVecIP[ip], m_vJTInv[ip], vVecIP[ip]);
+		m_sumFact.add_local_grads_transposed(vCoeff, &m_vLocVecIP[0]);
+		return;
+	}
+
+	for(size_t ip = 0; ip < m_nip; ++ip)
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			vCoeff[sh] += VecDot(m_vvGradGlobal[ip][sh], vVecIP[ip]);
+}
+
 template class DimFEGeometry<1, 1>;
 template class DimFEGeometry<2, 1>;
 template class DimFEGeometry<3, 1>;
@@ -36,6 +36,7 @@
 #include "lib_grid/tools/subset_handler_interface.h"
 #include "lib_disc/quadrature/quadrature.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_sum_factorization.h"
 #include "lib_disc/reference_element/reference_mapping_provider.h"
 #include "lib_disc/reference_element/reference_mapping.h"
 #include "common/util/provider.h"
@@ -258,6 +259,37 @@ class DimFEGeometry
 			return m_vvGradGlobal[ip][sh];
 		}
 
+	///	returns if sum factorization is used for the current element type
+	/**
+	 * For Lagrange spaces on quadrilaterals and hexahedra with tensor product
+	 * quadrature rules, the following interpolation and integration methods
+	 * use sum factorization. Otherwise, the precomputed shape functions and
+	 * gradients are used.
+	 */
+		bool sum_factorization() const {return m_sumFact.valid();}
+
+	///	computes sum_sh vCoeff[sh] * shape(ip, sh) for all ip
+		void interpolate(number* vValIP, const number* vCoeff) const;
+
+	///	computes sum_sh vCoeff[sh] * global_grad(ip, sh) for all ip
+		void interpolate_global_grad(MathVector<worldDim>* vGradIP,
+		                             const number* vCoeff) const;
+
+	///	adds sum_ip shape(ip, sh) * vValIP[ip] to vCoeff[sh] for all sh
+	/**
+	 * The integration weights are not applied, i.e. vValIP usually contains
+	 * the integrand multiplied by weight(ip).
+	 */
+		void integrate(number* vCoeff, const number* vValIP) const;
+
+	///	adds sum_ip global_grad(ip, sh) * vVecIP[ip] to vCoeff[sh] for all sh
+	/**
+	 * The integration weights are not applied, i.e. vVecIP usually contains
+	 * the integrand multiplied by weight(ip).
+	 */
+		void integrate_global_grad(number* vCoeff,
+		                           const MathVector<worldDim>* vVecIP) const;
+
 	/// update Geometry for roid
 		void update_local(ReferenceObjectID roid, const LFEID& lfeID, size_t orderQuad);
 		void update_local(ReferenceObjectID roid, const LFEID& lfeID){
@@ -465,6 +497,12 @@ class DimFEGeometry
 
 	///	local gradient evaluated at ip (size = nip x nsh)
 		std::vector<std::vector<MathVector<worldDim> > > m_vvGradGlobal;
+
+	///	sum factorization for tensor product elements
+		LagrangeSumFactorization<dim> m_sumFact;
+
+	///	buffer for local vectors at ip (size = nip)
+		mutable std::vector<MathVector<dim> > m_vLocVecIP;
 };
 
 } // end namespace ug
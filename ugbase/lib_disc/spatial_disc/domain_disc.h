@@ -118,6 +118,20 @@ class DomainDiscretizationBase
 		virtual void assemble_jacobian(matrix_type& J, const vector_type& u, const GridLevel& gl)
 		{assemble_jacobian(J, u, dd(gl));}
 
+	/// \copydoc IDomainDiscretization::apply_jacobian()
+	/**
+	 * Only Dirichlet constraints are supported, the rows of constrained
+	 * indices act as identity (as in the assembled Jacobian).
+	 */
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u, ConstSmartPtr<DoFDistribution> dd);
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u, const GridLevel& gl)
+		{apply_jacobian(d, c, u, dd(gl));}
+
+	/// \copydoc IDomainDiscretization::assemble_jacobian_diagonal()
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u, ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u, const GridLevel& gl)
+		{assemble_jacobian_diagonal(D, u, dd(gl));}
+
 	/// \copydoc IAssemble::assemble_defect()
 		virtual void assemble_defect(vector_type& d, const vector_type& u, ConstSmartPtr<DoFDistribution> dd);
 		virtual void assemble_defect(vector_type& d, const vector_type& u, const GridLevel& gl)
@@ -500,6 +514,19 @@ class DomainDiscretizationBase
 									matrix_type& J,
 									const vector_type& u);
 	template <typename TElem>
+	void ApplyJacobian(				const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& d,
+									const vector_type& c,
+									const vector_type& u);
+	template <typename TElem>
+	void AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									matrix_type& D,
+									const vector_type& u);
+	template <typename TElem>
 	void AssembleDefect( 			const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 									ConstSmartPtr<DoFDistribution> dd,
 									int si, bool bNonRegularGrid,
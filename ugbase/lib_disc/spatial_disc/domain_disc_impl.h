@@ -596,6 +596,341 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Matrix-free Jacobian (stationary)
+///////////////////////////////////////////////////////////////////////////////
+
+///	checks that the domain discretization can be used matrix-free
+template <typename TAlgebra, typename TDomain>
+static void CheckMatrixFreeSupport(const AssemblingTuner<TAlgebra>& assTuner,
+                                   const std::vector<SmartPtr<IDomainConstraint<TDomain, TAlgebra> > >& vConstraint,
+                                   const char* name)
+{
+	if(assTuner.modify_solution_enabled())
+		UG_THROW("DomainDiscretization::"<<name<<": Modification of the "
+				"solution not supported in matrix-free application.");
+	if(assTuner.single_index_assembling_enabled())
+		UG_THROW("DomainDiscretization::"<<name<<": Index-wise assembling "
+				"not supported in matrix-free application.");
+
+	for(int type = 1; type < CT_ALL; type = type << 1){
+		if(!assTuner.constraint_type_enabled(type)) continue;
+		if(type == CT_DIRICHLET) continue;
+		for(size_t i = 0; i < vConstraint.size(); ++i)
+			if(vConstraint[i]->type() & type)
+				UG_THROW("DomainDiscretization::"<<name<<": Only Dirichlet "
+						"constraints are supported in matrix-free application.");
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& d,
+               const vector_type& c,
+               const vector_type& u,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	CheckMatrixFreeSupport(*m_spAssTuner, m_vConstraint, "apply_jacobian");
+
+	if(c.size() != dd->num_indices())
+		UG_THROW("DomainDiscretization::apply_jacobian: Size of vector c ["
+				<<c.size()<<"] does not match number of indices ["<<dd->num_indices()<<"].");
+
+//	point of linearization, zero if not given
+	vector_type zero;
+	const vector_type* pU = &u;
+	if(u.size() == 0){
+		m_spAssTuner->resize(dd, zero);
+		pU = &zero;
+	}
+	else if(u.size() != dd->num_indices())
+		UG_THROW("DomainDiscretization::apply_jacobian: Size of vector u ["
+				<<u.size()<<"] does not match number of indices ["<<dd->num_indices()<<"].");
+
+	prep_assemble_loop(m_vElemDisc);
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, d);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 1:
+			this->template ApplyJacobian<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			break;
+		case 2:
+			this->template ApplyJacobian<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			break;
+		case 3:
+			this->template ApplyJacobian<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			this->template ApplyJacobian<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, c, *pU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::apply_jacobian:"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	Dirichlet rows act as identity: d = c on constrained indices
+	try{
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET)){
+		SmartPtr<vector_type> spDirC;
+		for(size_t i = 0; i < m_vConstraint.size(); ++i){
+			if(!(m_vConstraint[i]->type() & CT_DIRICHLET)) continue;
+			if(spDirC.invalid()) spDirC = c.clone();
+			m_vConstraint[i]->adjust_correction(d, dd, CT_DIRICHLET);
+			m_vConstraint[i]->adjust_correction(*spDirC, dd, CT_DIRICHLET);
+		}
+		if(spDirC.valid()){
+		//	spDirC = c - spDirC equals c on constrained indices, zero elsewhere
+			VecScaleAdd(*spDirC, 1.0, c, -1.0, *spDirC);
+			VecScaleAdd(d, 1.0, d, 1.0, *spDirC);
+		}
+	}
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	d.set_storage_type(PST_ADDITIVE);
+	d.set_layouts(dd->layouts());
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(matrix_type& D,
+                           const vector_type& u,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	CheckMatrixFreeSupport(*m_spAssTuner, m_vConstraint, "assemble_jacobian_diagonal");
+
+//	point of linearization, zero if not given
+	vector_type zero;
+	const vector_type* pU = &u;
+	if(u.size() == 0){
+		m_spAssTuner->resize(dd, zero);
+		pU = &zero;
+	}
+	else if(u.size() != dd->num_indices())
+		UG_THROW("DomainDiscretization::assemble_jacobian_diagonal: Size of vector u ["
+				<<u.size()<<"] does not match number of indices ["<<dd->num_indices()<<"].");
+
+	prep_assemble_loop(m_vElemDisc);
+
+//	reset matrix to zero and resize
+	m_spAssTuner->resize(dd, D);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 1:
+			this->template AssembleJacobianDiagonal<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			break;
+		case 2:
+			this->template AssembleJacobianDiagonal<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			break;
+		case 3:
+			this->template AssembleJacobianDiagonal<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			this->template AssembleJacobianDiagonal<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, D, *pU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process (Dirichlet rows only touch the diagonal)
+	try{
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET)){
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & CT_DIRICHLET)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_jacobian(D, *pU, dd, CT_DIRICHLET);
+			}
+	}
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	D.set_storage_type(PST_ADDITIVE);
+	D.set_layouts(dd->layouts());
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+				ConstSmartPtr<DoFDistribution> dd,
+				int si, bool bNonRegularGrid,
+				vector_type& d,
+				const vector_type& c,
+				const vector_type& u)
+{
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, d, c, u, m_spAssTuner);
+	}
+	else
+	{
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, d, c, u, m_spAssTuner);
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<DoFDistribution> dd,
+							int si, bool bNonRegularGrid,
+							matrix_type& D,
+							const vector_type& u)
+{
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, D, u, m_spAssTuner);
+	}
+	else
+	{
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, D, u, m_spAssTuner);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Defect (stationary)
 ///////////////////////////////////////////////////////////////////////////////
@@ -134,6 +134,28 @@ class IDomainDiscretization : public IAssemble<TAlgebra>
 		virtual void assemble_stiffness_matrix(matrix_type& A, const vector_type& u, const GridLevel& gl) = 0;
 		virtual void assemble_stiffness_matrix(matrix_type& A, const vector_type& u, ConstSmartPtr<DoFDistribution> dd) = 0;
 
+		/// applies the Jacobian without assembling it
+		/**
+		 * Computes d = J(u)*c element by element, where J(u) is the Jacobian
+		 * that assemble_jacobian would assemble. The default implementation
+		 * throws, i.e. discretizations have to support this explicitly.
+		 *
+		 * \param[out] 	d 	result, additive in parallel
+		 * \param[in]  	c 	vector to apply the Jacobian to, consistent in parallel
+		 * \param[in]  	u 	Current iterate (empty vector for u = 0)
+		 * \param[in]	dd	DoF Distribution
+		 */
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IDomainDiscretization: apply_jacobian not implemented.");}
+		virtual void apply_jacobian(vector_type& d, const vector_type& c, const vector_type& u, ConstSmartPtr<DoFDistribution> dd)
+		{UG_THROW("IDomainDiscretization: apply_jacobian not implemented.");}
+
+		/// assembles only the diagonal (blocks) of the Jacobian
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IDomainDiscretization: assemble_jacobian_diagonal not implemented.");}
+		virtual void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u, ConstSmartPtr<DoFDistribution> dd)
+		{UG_THROW("IDomainDiscretization: assemble_jacobian_diagonal not implemented.");}
+
 
 	public:
 	/// prepares time step
@@ -412,6 +412,225 @@ public:
 		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Apply (stationary) Jacobian
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+	/**
+	 * This function adds the application of the (stationary) Jacobian of all
+	 * passed element discretizations on one given subset to a vector, i.e.
+	 * d += J(u)*c, without assembling the global Jacobian. The element
+	 * discretizations that registered an apply_jac_A_elem method are applied
+	 * directly, for all others the local Jacobian is assembled and applied.
+	 * (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	d				result vector
+	 * \param[in]		c				vector the Jacobian is applied to
+	 * \param[in]		u				solution (point of linearization)
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+					ConstSmartPtr<domain_type> spDomain,
+					ConstSmartPtr<DoFDistribution> dd,
+					TIterator iterBegin,
+					TIterator iterEnd,
+					int si, bool bNonRegularGrid,
+					vector_type& d,
+					const vector_type& c,
+					const vector_type& u,
+					ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locC, locD; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locC.resize(ind); locD.resize(ind); locJ.resize(ind);
+
+		//	read local values of u and c
+			GetLocalVector(locU, u);
+			GetLocalVector(locC, c);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot prepare element.");
+
+		//	reset local algebra
+			locD = 0.0;
+
+		//	Apply JA
+			try
+			{
+				Eval.apply_jac_A_elem(locD, locC, locU, locJ, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot apply Jacobian (A).");
+
+		// send local to global vector
+			try{
+				spAssTuner->add_local_vec_to_global(d, locD, dd);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot add local vector.");
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot create Data Evaluator.");
+	}
+
+	/**
+	 * This function adds the diagonal of the (stationary) Jacobian of all
+	 * passed element discretizations on one given subset to a matrix. Only
+	 * the diagonal entries (resp. diagonal blocks) are written to the matrix.
+	 * (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	D				diagonal of jacobian
+	 * \param[in]		u				solution
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+								ConstSmartPtr<domain_type> spDomain,
+								ConstSmartPtr<DoFDistribution> dd,
+								TIterator iterBegin,
+								TIterator iterEnd,
+								int si, bool bNonRegularGrid,
+								matrix_type& D,
+								const vector_type& u,
+								ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot compute Jacobian (A).");
+
+		// send diagonal of local matrix to global matrix
+			AddLocalMatrixDiagonalToGlobal(D, locJ);
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot create Data Evaluator.");
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Assemble (instationary) Jacobian
 ////////////////////////////////////////////////////////////////////////////////
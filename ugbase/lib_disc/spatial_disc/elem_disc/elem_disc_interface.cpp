@@ -92,6 +92,7 @@ void IElemDisc<TDomain>::clear_add_fct(ReferenceObjectID id)
 
 	m_vElemJAFct[id] = NULL;
 	m_vElemJMFct[id] = NULL;
+	m_vElemApplyJAFct[id] = NULL;
 
 	m_vElemdAFct[id] = NULL;
 	m_vElemdAExplFct[id] = NULL;
@@ -135,6 +136,7 @@ void IElemDisc<TDomain>::set_default_add_fct()
 
 		m_vElemJAFct[i] = &T::add_jac_A_elem;
 		m_vElemJMFct[i] = &T::add_jac_M_elem;
+		m_vElemApplyJAFct[i] = NULL;
 
 		m_vElemdAFct[i] = &T::add_def_A_elem;
 		m_vElemdAExplFct[i] = &T::add_def_A_expl_elem;
@@ -455,6 +457,22 @@ do_add_jac_A_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVe
 	(this->*m_vElemJAFct[m_id])(J, u, elem, vCornerCoords);
 }
 
+template <typename TDomain>
+void IElemDisc<TDomain>::
+do_apply_jac_A_elem(LocalVector& d, LocalVector& c, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[])
+{
+	//	access by map
+	u.access_by_map(map());
+	c.access_by_map(map());
+	d.access_by_map(map());
+	if(local_time_series_needed())
+		m_pLocalVectorTimeSeries->access_by_map(map());
+
+	//	call application routine
+	UG_ASSERT(m_vElemApplyJAFct[m_id]!=NULL, "ElemDisc method apply_jac_A missing.");
+	(this->*m_vElemApplyJAFct[m_id])(d, c, u, elem, vCornerCoords);
+}
+
 template <typename TDomain>
 void IElemDisc<TDomain>::
 do_add_jac_M_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[])
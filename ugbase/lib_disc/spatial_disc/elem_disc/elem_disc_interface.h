@@ -480,6 +480,7 @@ class IElemDisc
 		void do_fsh_timestep_elem(const number time, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 		void do_add_jac_A_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 		void do_add_jac_M_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
+		void do_apply_jac_A_elem(LocalVector& d, LocalVector& c, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 		void do_add_def_A_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
    	    void do_add_def_A_expl_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 		void do_add_def_M_elem(LocalVector& d, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
@@ -492,6 +493,16 @@ class IElemDisc
 		void do_fsh_err_est_elem_loop();
 	/// \}
 
+	///	returns if the element Jacobian (Stiffness part) can be applied without assembling
+	/**
+	 * Element discretizations may register a method computing d += J_A(u) * c
+	 * for the current element directly (see set_apply_jac_A_elem_fct). If
+	 * no such method is registered for the current reference object, the
+	 * matrix-free operator application falls back to the local Jacobian
+	 * computed by add_jac_A_elem.
+	 */
+		bool apply_jac_A_elem_enabled() const {return m_vElemApplyJAFct[m_id] != NULL;}
+
 	private:
 	//	abbreviation for own type
 		typedef IElemDisc<TDomain> T;
@@ -510,6 +521,7 @@ class IElemDisc
 	// 	types of Jacobian assemble functions
 		typedef void (T::*ElemJAFct)(LocalMatrix& J, const LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 		typedef void (T::*ElemJMFct)(LocalMatrix& J, const LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
+		typedef void (T::*ElemApplyJAFct)(LocalVector& d, const LocalVector& c, const LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
 
 	// 	types of Defect assemble functions
 		typedef void (T::*ElemdAFct)(LocalVector& d, const LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[]);
@@ -539,6 +551,7 @@ class IElemDisc
 
 		template <typename TAssFunc> void set_add_jac_A_elem_fct(ReferenceObjectID id, TAssFunc func);
 		template <typename TAssFunc> void set_add_jac_M_elem_fct(ReferenceObjectID id, TAssFunc func);
+		template <typename TAssFunc> void set_apply_jac_A_elem_fct(ReferenceObjectID id, TAssFunc func);
 		template <typename TAssFunc> void set_add_def_A_elem_fct(ReferenceObjectID id, TAssFunc func);
 		template <typename TAssFunc> void set_add_def_A_expl_elem_fct(ReferenceObjectID id, TAssFunc func);
 		template <typename TAssFunc> void set_add_def_M_elem_fct(ReferenceObjectID id, TAssFunc func);
@@ -563,6 +576,7 @@ class IElemDisc
 
 		void remove_add_jac_A_elem_fct(ReferenceObjectID id);
 		void remove_add_jac_M_elem_fct(ReferenceObjectID id);
+		void remove_apply_jac_A_elem_fct(ReferenceObjectID id);
 		void remove_add_def_A_elem_fct(ReferenceObjectID id);
 		void remove_add_def_A_expl_elem_fct(ReferenceObjectID id);
 		void remove_add_def_M_elem_fct(ReferenceObjectID id);
@@ -610,6 +624,9 @@ class IElemDisc
 		ElemJAFct 	m_vElemJAFct[NUM_REFERENCE_OBJECTS];
 		ElemJMFct 	m_vElemJMFct[NUM_REFERENCE_OBJECTS];
 
+	// 	Jacobian application function pointers (optional)
+		ElemApplyJAFct 	m_vElemApplyJAFct[NUM_REFERENCE_OBJECTS];
+
 	// 	Defect function pointers
 		ElemdAFct 	m_vElemdAFct[NUM_REFERENCE_OBJECTS];
 		ElemdAFct 	m_vElemdAExplFct[NUM_REFERENCE_OBJECTS];
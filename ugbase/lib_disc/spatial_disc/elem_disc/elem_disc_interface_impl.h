@@ -115,6 +115,18 @@ void IElemDisc<TDomain>::remove_add_jac_A_elem_fct(ReferenceObjectID id)
 	m_vElemJAFct[id] = NULL;
 };
 
+template <typename TDomain>
+template<typename TAssFunc>
+void IElemDisc<TDomain>::set_apply_jac_A_elem_fct(ReferenceObjectID id, TAssFunc func)
+{
+	m_vElemApplyJAFct[id] = static_cast<ElemApplyJAFct>(func);
+};
+template <typename TDomain>
+void IElemDisc<TDomain>::remove_apply_jac_A_elem_fct(ReferenceObjectID id)
+{
+	m_vElemApplyJAFct[id] = NULL;
+};
+
 template <typename TDomain>
 template<typename TAssFunc>
 void IElemDisc<TDomain>::set_add_jac_M_elem_fct(ReferenceObjectID id, TAssFunc func)
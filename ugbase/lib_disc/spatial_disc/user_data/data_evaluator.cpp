@@ -524,6 +524,54 @@ add_jac_A_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVecto
 	UG_CATCH_THROW("DataEvaluator::add_jac_A_elem: Cannot add couplings.");
 }
 
+template <typename TDomain>
+void DataEvaluator<TDomain>::
+apply_jac_A_elem(LocalVector& d, LocalVector& c, LocalVector& u, LocalMatrix& J,
+                 GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type)
+{
+	UG_ASSERT(m_discPart & STIFF, "Using apply_jac_A_elem, but not STIFF requested.");
+
+	bool bMatrixUsed = false;
+	J = 0.0;
+
+	// compute elem-owned contribution
+	try{
+		for(size_t i = 0; i < m_vElemDisc[type].size(); ++i){
+			if(m_vElemDisc[type][i]->apply_jac_A_elem_enabled())
+				m_vElemDisc[type][i]->do_apply_jac_A_elem(d, c, u, elem, vCornerCoords);
+			else{
+				m_vElemDisc[type][i]->do_add_jac_A_elem(J, u, elem, vCornerCoords);
+				bMatrixUsed = true;
+			}
+		}
+	}
+	UG_CATCH_THROW("DataEvaluator::apply_jac_A_elem: Cannot apply Jacobian (A)");
+
+	//	add couplings (always assembled locally)
+	if(!m_vImport[type][STIFF].empty() || !m_vImport[type][RHS].empty())
+	{
+		try{
+			for(size_t i = 0; i < m_vImport[type][STIFF].size(); ++i)
+				m_vImport[type][STIFF][i]->compute_lin_defect(u);
+
+			for(size_t i = 0; i < m_vImport[type][RHS].size(); ++i)
+				m_vImport[type][RHS][i]->compute_lin_defect(u);
+
+			for(size_t i = 0; i < m_vImport[type][STIFF].size(); ++i)
+				m_vImport[type][STIFF][i]->add_jacobian(J, 1.0);
+
+			for(size_t i = 0; i < m_vImport[type][RHS].size(); ++i)
+				m_vImport[type][RHS][i]->add_jacobian(J, -1.0);
+		}
+		UG_CATCH_THROW("DataEvaluator::apply_jac_A_elem: Cannot add couplings.");
+		bMatrixUsed = true;
+	}
+
+	//	apply assembled part
+	if(bMatrixUsed)
+		AddLocalMatVec(d, J, c);
+}
+
 template <typename TDomain>
 void DataEvaluator<TDomain>::
 add_jac_M_elem(LocalMatrix& J, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type)
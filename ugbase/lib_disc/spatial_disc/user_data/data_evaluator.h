@@ -105,6 +105,15 @@ class DataEvaluator
 	///	compute local stiffness matrix for all IElemDiscs
 		void add_jac_A_elem(LocalMatrix& A, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type = PT_ALL);
 
+	///	applies the local stiffness matrix for all IElemDiscs: d += J_A(u) * c
+	/**
+	 * Element discretizations that registered a matrix-free application are
+	 * called directly. For all others, and for the couplings of imports, the
+	 * local Jacobian is assembled into the passed workspace J and applied.
+	 */
+		void apply_jac_A_elem(LocalVector& d, LocalVector& c, LocalVector& u, LocalMatrix& J,
+		                      GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type = PT_ALL);
+
 	///	compute local mass matrix for all IElemDiscs
 		void add_jac_M_elem(LocalMatrix& M, LocalVector& u, GridObject* elem, const MathVector<dim> vCornerCoords[], ProcessType type = PT_ALL);
 
@@ -92,6 +92,9 @@ class StdDataLinker
 	///	returns if provided data is continuous over geometric object boundaries
 		virtual bool continuous() const;
 
+	///	returns if all inputs may be evaluated concurrently
+		virtual bool thread_safe() const;
+
 	///	returns if derivative is zero
 		virtual bool zero_derivative() const;
 
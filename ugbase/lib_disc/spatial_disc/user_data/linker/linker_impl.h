@@ -175,6 +175,15 @@ bool StdDataLinker<TImpl,TData,dim>::continuous() const
 	return bRet;
 }
 
+template <typename TImpl, typename TData, int dim>
+bool StdDataLinker<TImpl,TData,dim>::thread_safe() const
+{
+	bool bRet = true;
+	for(size_t i = 0; i < this->m_vspICplUserData.size(); ++i)
+		bRet &= this->m_vspUserDataInfo[i]->thread_safe();
+	return bRet;
+}
+
 template <typename TImpl, typename TData, int dim>
 bool StdDataLinker<TImpl,TData,dim>::zero_derivative() const
 {
@@ -64,6 +64,12 @@ class UserDataInfo {
 	///	returns if grid function is needed for evaluation
 		virtual bool requires_grid_fct() const = 0;
 
+	///	returns if the evaluation may be called concurrently from several threads
+	/**
+	 * Data calling back into an interpreter (e.g. lua) must return false.
+	 */
+		virtual bool thread_safe() const {return true;}
+
 	///	sets the function pattern for a possibly needed grid function
 		virtual void set_function_pattern(ConstSmartPtr<FunctionPattern> fctPatt) {
 			m_fctGrp.set_function_pattern(fctPatt);
@@ -43,6 +43,9 @@
 #include "parallelization_util.h"
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/global_attachments.h"
+#include "common/stopwatch.h"
+#include "common/util/binary_compression.h"
+#include "pcl/pcl_chunked_exchange.h"
 
 //#define LG_DISTRIBUTION_DEBUG
 //#define LG_DISTRIBUTION_Z_OUTPUT_TRANSFORM 40
@@ -54,6 +57,76 @@ namespace ug{
 
 static DebugID LG_DIST("LG_DIST");
 
+///	settings and statistics of grid distribution
+static size_t g_distChunkSize = 16 << 20;
+static size_t g_distMaxPendingBytes = 0;
+static bool g_distCompression = false;
+static GridDistributionStatistics g_distStats;
+
+void SetGridDistributionChunkSize(size_t numBytes)
+{
+	UG_COND_THROW(numBytes == 0, "SetGridDistributionChunkSize: chunk size has to be positive.");
+	g_distChunkSize = numBytes;
+}
+
+void SetGridDistributionMaxPendingBytes(size_t numBytes)
+{
+	g_distMaxPendingBytes = numBytes;
+}
+
+void EnableGridDistributionCompression(bool enable)
+{
+	g_distCompression = enable;
+}
+
+void GridDistributionStatistics::clear()
+{
+	numBytesSerialized = numBytesSent = numBytesReceived = numBytesDeserialized = 0;
+	tPreparation = tSerialization = tCleanup = tReceive = tDeserialization
+		= tFinalization = tTotal = 0;
+}
+
+const GridDistributionStatistics& GetGridDistributionStatistics()
+{
+	return g_distStats;
+}
+
+void PrintGridDistributionStatistics()
+{
+	const GridDistributionStatistics& s = g_distStats;
+	pcl::ProcessCommunicator com;
+
+	const size_t numBytes[] = {s.numBytesSerialized, s.numBytesSent,
+							   s.numBytesReceived, s.numBytesDeserialized};
+	const char* bytesName[] = {"serialized", "sent", "received", "deserialized"};
+
+	const double times[] = {s.tPreparation, s.tSerialization, s.tCleanup,
+							s.tReceive, s.tDeserialization, s.tFinalization, s.tTotal};
+	const char* timesName[] = {"preparation", "serialization", "cleanup",
+							   "waiting for data", "deserialization",
+							   "finalization", "total"};
+
+	StringStreamTable t;
+	t(0, 0) << "data";		t(0, 1) << "sum (MB)";	t(0, 2) << "max (MB)";
+	for(size_t i = 0; i < 4; ++i){
+		const double mb = numBytes[i] / (1024. * 1024.);
+		t(i+1, 0) << bytesName[i];
+		t(i+1, 1) << com.allreduce(mb, PCL_RO_SUM);
+		t(i+1, 2) << com.allreduce(mb, PCL_RO_MAX);
+	}
+
+	StringStreamTable tt;
+	tt(0, 0) << "phase";	tt(0, 1) << "max (s)";
+	for(size_t i = 0; i < 7; ++i){
+		tt(i+1, 0) << timesName[i];
+		tt(i+1, 1) << com.allreduce(times[i], PCL_RO_MAX);
+	}
+
+	UG_LOG("Grid distribution statistics (compression "
+		   << (g_distCompression ? "enabled" : "disabled") << "):\n");
+	UG_LOG(t << "\n" << tt);
+}
+
 
 struct TargetProcInfo
 {
@@ -1797,6 +1870,11 @@ bool DistributeGrid(MultiGrid& mg,
 	GDIST_PROFILE(performRedistribution);
 	UG_STATIC_ASSERT(IS_DUMMY < 256, RedistributeGrid_IS_DUMMY_too_big);
 
+	GridDistributionStatistics& stats = g_distStats;
+	stats.clear();
+	const double tStart = get_clock_s();
+	double tPhase = tStart;
+
 	UG_DLOG(LG_DIST, 3, "dist-start: DistributeGrid\n");
 	const char* errprefix = "ERROR in DistributeGrid: ";
 
@@ -1926,17 +2004,34 @@ bool DistributeGrid(MultiGrid& mg,
 	GDIST_PROFILE_END();
 
 
+	stats.tPreparation = get_clock_s() - tPhase;
+	tPhase = get_clock_s();
+
 ////////////////////////////////
-//	SERIALIZE THE GRID, THE GLOBAL IDS AND THE DISTRIBUTION INFOS.
+//	SERIALIZE THE GRID, THE GLOBAL IDS AND THE DISTRIBUTION INFOS AND SEND THEM.
+//	The data for each target process is sent in chunks as soon as it is
+//	serialized. Incoming data is received in the background meanwhile and
+//	deserialized as soon as the local grid has been cleaned up.
 	GDIST_PROFILE(gdist_Serialization);
 	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Serialization\n");
 	AInt aLocalInd("distribution-tmp-local-index");
 	mg.attach_to_all(aLocalInd);
 	MultiElementAttachmentAccessor<AInt> aaInt(mg, aLocalInd);
 
-//	outBufs will be used to serialize and distribute the grid.
-//	don't resize outBufs later on! Would be expensive!
-	std::vector<BinaryBuffer> outBufs(sendToRanks.size());
+//	there is nothing to receive from the local process
+	vector<int> recvFromOtherRanks;
+	for(size_t i = 0; i < recvFromRanks.size(); ++i){
+		if(recvFromRanks[i] != pcl::ProcRank())
+			recvFromOtherRanks.push_back(recvFromRanks[i]);
+	}
+
+	pcl::ChunkedBufferExchange exchange(procComm, g_distChunkSize, 4712);
+	exchange.set_max_pending_send_bytes(g_distMaxPendingBytes);
+	exchange.begin_receive(recvFromOtherRanks);
+
+//	out is reused for all target processes. Its content is handed to the
+//	exchange (or compressed into compOut) after each serialization.
+	BinaryBuffer out, compOut;
 
 //	the magic number is used for debugging to make sure that the stream is read correctly
 	int magicNumber1 = 75234587;
@@ -1961,7 +2056,7 @@ bool DistributeGrid(MultiGrid& mg,
 	//	don't serialize the local partition since we'll keep it here on the local
 	//	process anyways.
 		if(!localPartition){
-			BinaryBuffer& out = outBufs[i_to];
+			out.clear();
 
 		//	write a magic number for debugging purposes
 			out.write((char*)&magicNumber1, sizeof(int));
@@ -1985,31 +2080,25 @@ bool DistributeGrid(MultiGrid& mg,
 
 		//	write a magic number for debugging purposes
 			out.write((char*)&magicNumber2, sizeof(int));
+
+		//	send the data (optionally compressed)
+			stats.numBytesSerialized += out.write_pos();
+			if(g_distCompression){
+				compOut.clear();
+				CompressBinaryData(compOut, out.buffer(), out.write_pos());
+				exchange.send(sendToRanks[i_to], compOut);
+			}
+			else
+				exchange.send(sendToRanks[i_to], out);
 		}
 	}
-	PCL_DEBUG_BARRIER(procComm);
-	GDIST_PROFILE_END();
-
-
-
-////////////////////////////////
-//	COMMUNICATE SERIALIZED DATA
-	GDIST_PROFILE(gdist_CommunicateSerializedData);
-	UG_DLOG(LG_DIST, 2, "dist-DistributeGrid: Distribute data\n");
-//	now distribute the packs between involved processes
-	std::vector<BinaryBuffer> inBufs(recvFromRanks.size());
-
-	procComm.distribute_data(GetDataPtr(inBufs), GetDataPtr(recvFromRanks),
-							(int)recvFromRanks.size(),
-							GetDataPtr(outBufs), GetDataPtr(sendToRanks),
-							(int)sendToRanks.size());
-
-//	clear out-buffers, since they are no longer needed
-	for(size_t i = 0; i < outBufs.size(); ++i)
-		outBufs[i] = BinaryBuffer();
+	out = BinaryBuffer();
+	compOut = BinaryBuffer();
 
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
+	stats.tSerialization = get_clock_s() - tPhase;
+	tPhase = get_clock_s();
 
 
 ////////////////////////////////
@@ -2186,6 +2275,8 @@ bool DistributeGrid(MultiGrid& mg,
 	}
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
+	stats.tCleanup = get_clock_s() - tPhase;
+	tPhase = get_clock_s();
 
 //	DEBUGGING...
 	// {
@@ -2209,14 +2300,27 @@ bool DistributeGrid(MultiGrid& mg,
 	vector<Face*> faces;
 	vector<Volume*> vols;
 
-	for(size_t i = 0; i < recvFromRanks.size(); ++i){
-	//	there is nothing to serialize from the local rank
-		if(recvFromRanks[i] == pcl::ProcRank())
-			continue;
+//	used to decompress incoming data
+	BinaryBuffer decompIn;
+
+//	buffers are processed in a fixed order, so that the resulting element
+//	order does not depend on the arrival of the data.
+	for(size_t i = 0; i < recvFromOtherRanks.size(); ++i){
+		const double tWait = get_clock_s();
+		BinaryBuffer* pIn = &exchange.wait_for_buffer(i);
+		stats.tReceive += get_clock_s() - tWait;
+
+		if(IsCompressedBinaryData(pIn->buffer(), pIn->write_pos())){
+			decompIn.clear();
+			DecompressBinaryData(decompIn, pIn->buffer(), pIn->write_pos());
+			exchange.release_buffer(i);
+			pIn = &decompIn;
+		}
 
-		BinaryBuffer& in = inBufs[i];
+		BinaryBuffer& in = *pIn;
+		stats.numBytesDeserialized += in.write_pos();
 
-		UG_DLOG(LG_DIST, 2, "Deserializing from rank " << recvFromRanks[i] << "\n");
+		UG_DLOG(LG_DIST, 2, "Deserializing from rank " << recvFromOtherRanks[i] << "\n");
 
 	//	read the magic number and make sure that it matches our magicNumber
 		int tmp = 0;
@@ -2255,15 +2359,22 @@ bool DistributeGrid(MultiGrid& mg,
 					 "Magic number mismatch after deserialization.\n");
 		}
 
-		UG_DLOG(LG_DIST, 2, "Deserialization from rank " << recvFromRanks[i] << " done\n");
-	}
+		UG_DLOG(LG_DIST, 2, "Deserialization from rank " << recvFromOtherRanks[i] << " done\n");
 
-	//	clear in-buffers, since they are no longer needed
-	for(size_t i = 0; i < inBufs.size(); ++i)
-		inBufs[i] = BinaryBuffer();
+	//	the buffer is no longer needed
+		exchange.release_buffer(i);
+	}
+	decompIn = BinaryBuffer();
 
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
+	stats.tDeserialization = get_clock_s() - tPhase - stats.tReceive;
+	tPhase = get_clock_s();
+
+//	wait until our data was received by all target processes
+	exchange.wait_all();
+	stats.numBytesSent = exchange.num_bytes_sent();
+	stats.numBytesReceived = exchange.num_bytes_received();
 
 //	DEBUG: output distInfos...
 	#ifdef LG_DISTRIBUTION_DEBUG
@@ -2314,6 +2425,12 @@ bool DistributeGrid(MultiGrid& mg,
 
 
 	GDIST_PROFILE_END_(performRedistribution);
+	stats.tFinalization = get_clock_s() - tPhase;
+	stats.tTotal = get_clock_s() - tStart;
+
+	UG_DLOG(LG_DIST, 1, "dist-DistributeGrid: serialized " << stats.numBytesSerialized
+			<< " bytes, sent " << stats.numBytesSent << " bytes, received "
+			<< stats.numBytesReceived << " bytes, took " << stats.tTotal << " s\n");
 
 //	execute callbacks for external postprocessing
 	GDIST_PROFILE(gdist_ExternalPostProcessing);
@@ -86,6 +86,49 @@ bool DistributeGrid(MultiGrid& mg,
 					const pcl::ProcessCommunicator& procComm =
 												pcl::ProcessCommunicator());
 
+
+///	Sets the maximal size of a single message sent during grid distribution.
+/**	Serialized grid parts are sent in chunks of at most the given size (in bytes).
+ * The default is 16 MB. The same value has to be used on all processes.*/
+void SetGridDistributionChunkSize(size_t numBytes);
+
+///	Bounds the volume of serialized grid data which is buffered for sending.
+/**	If the volume of serialized data which was not yet delivered exceeds the
+ * given number of bytes, serialization of further parts waits until earlier
+ * parts have been received. 0 (default) disables the bound.*/
+void SetGridDistributionMaxPendingBytes(size_t numBytes);
+
+///	Enables compression of the serialized grid data sent during grid distribution.
+/**	A fast LZ77 variant is used (see ug::CompressBinaryData). Compression
+ * is disabled by default. Processes may use different settings.*/
+void EnableGridDistributionCompression(bool enable);
+
+///	Timings and communicated data volume of the last call to DistributeGrid on this process
+struct GridDistributionStatistics
+{
+	GridDistributionStatistics()	{clear();}
+	void clear();
+
+	size_t	numBytesSerialized;		///< serialized data for other processes (before compression)
+	size_t	numBytesSent;			///< data sent to other processes (after compression)
+	size_t	numBytesReceived;		///< data received from other processes (before decompression)
+	size_t	numBytesDeserialized;	///< deserialized data (after decompression)
+	double	tPreparation;			///< global ids, distribution infos and involved processes
+	double	tSerialization;			///< serialization, compression and posting of sends
+	double	tCleanup;				///< removal of elements which don't stay on the process
+	double	tReceive;				///< time spent waiting for incoming data
+	double	tDeserialization;		///< decompression and deserialization
+	double	tFinalization;			///< creation of layouts and completion of sends
+	double	tTotal;
+};
+
+///	returns the statistics of the last call to DistributeGrid on this process
+const GridDistributionStatistics& GetGridDistributionStatistics();
+
+///	prints the statistics of the last call to DistributeGrid (sum and max over all processes)
+/**	Involves communication. Has to be called on all processes.*/
+void PrintGridDistributionStatistics();
+
 }// end of namespace
 
 #endif
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include "pcl_chunked_exchange.h"
+#include "pcl_profiling.h"
+
+namespace pcl
+{
+
+ChunkedBufferExchange::
+ChunkedBufferExchange(const ProcessCommunicator& procComm, size_t chunkSize, int tag) :
+	m_procComm(procComm),
+	m_chunkSize(chunkSize),
+	m_tag(tag),
+	m_maxPendingSendBytes(0),
+	m_pendingSendBytes(0),
+	m_numBytesSent(0),
+	m_numBytesReceived(0)
+{
+	UG_COND_THROW(chunkSize == 0 || chunkSize > (size_t)std::numeric_limits<int>::max(),
+				  "ChunkedBufferExchange: Invalid chunk size " << chunkSize);
+}
+
+ChunkedBufferExchange::
+~ChunkedBufferExchange()
+{
+//	make sure that no request refers to released memory. During stack unwinding
+//	other processes may not participate anymore, so we don't wait in that case.
+	if(!std::uncaught_exception())
+		wait_all();
+}
+
+void ChunkedBufferExchange::
+begin_receive(const std::vector<int>& recvFromRanks)
+{
+	PCL_PROFILE(pcl_ChunkedBufferExchange_begin_receive);
+	UG_COND_THROW(!m_recvs.empty(), "ChunkedBufferExchange::begin_receive may only be called once.");
+
+	m_recvs.resize(recvFromRanks.size());
+	for(size_t i = 0; i < recvFromRanks.size(); ++i){
+		RecvInfo& info = m_recvs[i];
+		info.fromRank = recvFromRanks[i];
+		MPI_Irecv(&info.size, sizeof(uint64), MPI_UNSIGNED_CHAR,
+				  info.fromRank, m_tag, m_procComm.get_mpi_communicator(),
+				  &info.sizeRequest);
+	}
+}
+
+void ChunkedBufferExchange::
+send(int toRank, ug::BinaryBuffer& buf)
+{
+	PCL_PROFILE(pcl_ChunkedBufferExchange_send);
+
+	m_sends.push_back(SendInfo());
+	SendInfo& info = m_sends.back();
+	info.toRank = toRank;
+	info.buf.swap(buf);
+	buf = ug::BinaryBuffer();
+	info.size = info.buf.write_pos();
+
+	MPI_Comm comm = m_procComm.get_mpi_communicator();
+	const size_t numChunks = (info.size + m_chunkSize - 1) / m_chunkSize;
+	info.vRequests.resize(numChunks + 1);
+
+	MPI_Isend(&info.size, sizeof(uint64), MPI_UNSIGNED_CHAR, toRank, m_tag,
+			  comm, &info.vRequests[0]);
+
+	for(size_t i = 0; i < numChunks; ++i){
+		const size_t offset = i * m_chunkSize;
+		const size_t size = std::min<size_t>(m_chunkSize, info.size - offset);
+		MPI_Isend(info.buf.buffer() + offset, (int)size, MPI_UNSIGNED_CHAR, toRank,
+				  m_tag, comm, &info.vRequests[i + 1]);
+	}
+
+	m_pendingSendBytes += info.size;
+	m_numBytesSent += info.size;
+
+//	bound memory consumption by waiting for earlier sends
+	progress();
+	while(m_maxPendingSendBytes > 0 && m_pendingSendBytes > m_maxPendingSendBytes
+		  && m_sends.size() > 1)
+	{
+		progress();
+	}
+}
+
+void ChunkedBufferExchange::
+post_chunk_receives(RecvInfo& info)
+{
+	info.bSizeKnown = true;
+	info.buf.clear();
+	info.buf.reserve(info.size);
+
+	const size_t numChunks = (info.size + m_chunkSize - 1) / m_chunkSize;
+	info.vRequests.resize(numChunks);
+
+	MPI_Comm comm = m_procComm.get_mpi_communicator();
+	for(size_t i = 0; i < numChunks; ++i){
+		const size_t offset = i * m_chunkSize;
+		const size_t size = std::min<size_t>(m_chunkSize, info.size - offset);
+		MPI_Irecv(info.buf.buffer() + offset, (int)size, MPI_UNSIGNED_CHAR,
+				  info.fromRank, m_tag, comm, &info.vRequests[i]);
+	}
+}
+
+void ChunkedBufferExchange::
+test_sends()
+{
+	for(std::list<SendInfo>::iterator iter = m_sends.begin(); iter != m_sends.end();){
+		int flag = 0;
+		MPI_Testall((int)iter->vRequests.size(), &iter->vRequests.front(),
+					&flag, MPI_STATUSES_IGNORE);
+		if(flag){
+			m_pendingSendBytes -= iter->size;
+			iter = m_sends.erase(iter);
+		}
+		else
+			++iter;
+	}
+}
+
+void ChunkedBufferExchange::
+progress()
+{
+	for(size_t i = 0; i < m_recvs.size(); ++i){
+		RecvInfo& info = m_recvs[i];
+		if(info.bDone) continue;
+
+		int flag = 0;
+		if(!info.bSizeKnown){
+			MPI_Test(&info.sizeRequest, &flag, MPI_STATUS_IGNORE);
+			if(!flag) continue;
+			post_chunk_receives(info);
+		}
+
+		if(info.vRequests.empty())
+			flag = 1;
+		else
+			MPI_Testall((int)info.vRequests.size(), &info.vRequests.front(),
+						&flag, MPI_STATUSES_IGNORE);
+
+		if(flag){
+			info.bDone = true;
+			info.buf.set_write_pos(info.size);
+			m_numBytesReceived += info.size;
+		}
+	}
+
+	test_sends();
+}
+
+ug::BinaryBuffer& ChunkedBufferExchange::
+wait_for_buffer(size_t i)
+{
+	PCL_PROFILE(pcl_ChunkedBufferExchange_wait_for_buffer);
+	UG_COND_THROW(i >= m_recvs.size(), "ChunkedBufferExchange: Invalid buffer index " << i);
+
+//	we keep progressing all communication, since other processes may wait
+//	for our receives to be posted.
+	while(!m_recvs[i].bDone)
+		progress();
+
+	return m_recvs[i].buf;
+}
+
+void ChunkedBufferExchange::
+release_buffer(size_t i)
+{
+	UG_COND_THROW(i >= m_recvs.size() || !m_recvs[i].bDone,
+				  "ChunkedBufferExchange: Can't release buffer " << i);
+	m_recvs[i].buf = ug::BinaryBuffer();
+}
+
+void ChunkedBufferExchange::
+wait_all()
+{
+	PCL_PROFILE(pcl_ChunkedBufferExchange_wait_all);
+	for(;;){
+		progress();
+
+		bool bDone = m_sends.empty();
+		for(size_t i = 0; i < m_recvs.size(); ++i)
+			bDone &= m_recvs[i].bDone;
+
+		if(bDone) break;
+	}
+}
+
+}//	end of namespace
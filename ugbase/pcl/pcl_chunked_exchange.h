@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2015:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__PCL__PCL_CHUNKED_EXCHANGE__
+#define __H__PCL__PCL_CHUNKED_EXCHANGE__
+
+#include <list>
+#include <vector>
+#include "pcl_process_communicator.h"
+#include "common/types.h"
+#include "common/util/binary_buffer.h"
+
+namespace pcl
+{
+
+/// \addtogroup pcl
+/// \{
+
+///	Exchanges binary buffers between processes in chunks of bounded size.
+/**	Each buffer is sent as a message containing its size, followed by chunks
+ * of at most chunk_size() bytes. Receives for the chunks of an incoming buffer
+ * are posted as soon as its size is known. Communication is thus performed in
+ * the background while the caller proceeds (e.g. serializes the next buffer or
+ * deserializes a buffer which has already arrived).
+ *
+ * Usage:
+ * - call begin_receive with the ranks from which buffers will arrive,
+ * - call send for each outgoing buffer (at most one per target rank),
+ * - access the received buffers in arbitrary order through wait_for_buffer,
+ * - call wait_all before the exchange is destroyed.
+ *
+ * If set_max_pending_send_bytes was called, send blocks until the volume of
+ * buffers which are not yet delivered drops below the given bound. Incoming
+ * data is received meanwhile, thus no deadlock can occur.
+ *
+ * All involved processes have to use the same chunk size and tag.
+ */
+class ChunkedBufferExchange
+{
+	public:
+		ChunkedBufferExchange(const ProcessCommunicator& procComm,
+							  size_t chunkSize = 16 << 20, int tag = 4711);
+
+		~ChunkedBufferExchange();
+
+	///	the maximal size in bytes of a single message
+		size_t chunk_size() const					{return m_chunkSize;}
+
+	///	bound for the volume of outgoing buffers which are not yet delivered (0: no bound)
+		void set_max_pending_send_bytes(size_t numBytes)	{m_maxPendingSendBytes = numBytes;}
+
+	///	posts receives for buffers from the given ranks
+		void begin_receive(const std::vector<int>& recvFromRanks);
+
+	///	sends the given buffer to the given rank.
+	/**	The content of buf is taken over by the exchange and released as soon
+	 * as it is delivered. buf is empty after the call.*/
+		void send(int toRank, ug::BinaryBuffer& buf);
+
+	///	waits until the buffer from the i-th rank passed to begin_receive has arrived
+		ug::BinaryBuffer& wait_for_buffer(size_t i);
+
+	///	releases the memory of the i-th received buffer
+		void release_buffer(size_t i);
+
+	///	checks for finished communication and posts receives for announced buffers. Doesn't block.
+		void progress();
+
+	///	waits until all sends and receives are completed
+		void wait_all();
+
+	///	number of bytes sent so far (without size messages)
+		size_t num_bytes_sent() const				{return m_numBytesSent;}
+
+	///	number of bytes received so far (without size messages)
+		size_t num_bytes_received() const			{return m_numBytesReceived;}
+
+	private:
+		struct SendInfo{
+			int toRank;
+			uint64 size;
+			ug::BinaryBuffer buf;
+			std::vector<MPI_Request> vRequests;
+		};
+
+		struct RecvInfo{
+			RecvInfo() : size(0), bSizeKnown(false), bDone(false) {}
+			int fromRank;
+			uint64 size;
+			bool bSizeKnown;
+			bool bDone;
+			MPI_Request sizeRequest;
+			ug::BinaryBuffer buf;
+			std::vector<MPI_Request> vRequests;
+		};
+
+	///	posts the chunk-receives for the i-th buffer
+		void post_chunk_receives(RecvInfo& info);
+
+	///	tests and releases finished sends
+		void test_sends();
+
+		ProcessCommunicator	m_procComm;
+		size_t				m_chunkSize;
+		int					m_tag;
+		size_t				m_maxPendingSendBytes;
+		size_t				m_pendingSendBytes;
+		size_t				m_numBytesSent;
+		size_t				m_numBytesReceived;
+
+		std::list<SendInfo>	m_sends;
+		std::vector<RecvInfo>	m_recvs;
+};
+
+// end group pcl
+/// \}
+
+}//	end of namespace
+
+#endif